@@ -1,38 +1,88 @@
 from PIL import Image
 
+# Encodes src/logo_small.jpg into src/logo.h as a QOI-style compressed RGB565
+# stream. The op layout is documented in src/image_decoder.h and must stay in
+# sync with image_decoder.cpp.
+
+INDEX_SIZE = 64
+MAX_RUN = 62
+OP_LITERAL = 0xFE
+
 def to_rgb565(r, g, b):
     return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
 
-try:
-    img = Image.open('src/logo_small.jpg')
-    width, height = img.size
-    img_rgb = img.convert('RGB')
+def index_hash(p):
+    return ((p >> 11) * 3 + ((p >> 5) & 0x3F) * 5 + (p & 0x1F) * 7) % INDEX_SIZE
+
+def encode_qoi565(pixels):
+    out = bytearray()
+    index = [0] * INDEX_SIZE
+    prev = 0
+    run = 0
+    for p in pixels:
+        if p == prev:
+            run += 1
+            if run == MAX_RUN:
+                out.append(0xC0 | (run - 1))
+                run = 0
+            continue
+        if run:
+            out.append(0xC0 | (run - 1))
+            run = 0
 
-    with open('src/logo.h', 'w') as f:
+        h = index_hash(p)
+        if index[h] == p:
+            out.append(h)
+        else:
+            index[h] = p
+            dr = (p >> 11) - (prev >> 11)
+            dg = ((p >> 5) & 0x3F) - ((prev >> 5) & 0x3F)
+            db = (p & 0x1F) - (prev & 0x1F)
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(0x40 | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+            elif -32 <= dg <= 31 and -8 <= dr - dg <= 7 and -8 <= db - dg <= 7:
+                out.append(0x80 | (dg + 32))
+                out.append(((dr - dg + 8) << 4) | (db - dg + 8))
+            else:
+                out.append(OP_LITERAL)
+                out.append(p >> 8)
+                out.append(p & 0xFF)
+        prev = p
+    if run:
+        out.append(0xC0 | (run - 1))
+    return out
+
+def write_header(path, width, height, pixels):
+    data = encode_qoi565(pixels)
+    with open(path, 'w') as f:
         f.write('// Auto-generated logo data\n')
         f.write(f'// Image size: {width}x{height} pixels\n')
-        f.write('// Format: RGB565\n\n')
+        f.write(f'// Format: QOI-style RGB565, {len(data)} bytes (raw: {width * height * 2})\n\n')
         f.write('#ifndef LOGO_H\n')
         f.write('#define LOGO_H\n\n')
         f.write('#include <stdint.h>\n\n')
         f.write(f'#define LOGO_WIDTH {width}\n')
         f.write(f'#define LOGO_HEIGHT {height}\n\n')
-        f.write(f'const uint16_t logo_data[{width}*{height}] = {{\n')
-
-        pixels = list(img_rgb.getdata())
-        for i, p in enumerate(pixels):
-            r, g, b = p
-            rgb565 = to_rgb565(r, g, b)
-            f.write(f'0x{rgb565:04X}, ')
-            if (i + 1) % 12 == 0:
+        f.write(f'const uint8_t logo_data[{len(data)}] = {{\n')
+        for i, b in enumerate(data):
+            f.write(f'0x{b:02X}, ')
+            if (i + 1) % 16 == 0:
                 f.write('\n')
-        
         f.write('\n};\n\n')
         f.write('#endif // LOGO_H\n')
 
-    print("logo.h generated successfully.")
+if __name__ == '__main__':
+    try:
+        img = Image.open('src/logo_small.jpg')
+        width, height = img.size
+        img_rgb = img.convert('RGB')
+
+        pixels = [to_rgb565(r, g, b) for r, g, b in img_rgb.getdata()]
+        write_header('src/logo.h', width, height, pixels)
+
+        print("logo.h generated successfully.")
 
-except FileNotFoundError:
-    print("Error: logo_small.jpg not found. Make sure the image is in the 'src' directory.")
-except Exception as e:
-    print(f"An error occurred: {e}")
+    except FileNotFoundError:
+        print("Error: logo_small.jpg not found. Make sure the image is in the 'src' directory.")
+    except Exception as e:
+        print(f"An error occurred: {e}")
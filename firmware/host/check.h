@@ -0,0 +1,32 @@
+#ifndef HOST_CHECK_H
+#define HOST_CHECK_H
+
+// Reporting for the host checks: a failed expectation is printed with its
+// location and counted, and main() returns check_result().
+#include <cstdint>
+#include <cstdio>
+
+inline int check_failures = 0;
+
+#define CHECK(cond, ...)                                          \
+    do {                                                          \
+        if (!(cond)) {                                            \
+            printf("FAIL %s:%d: ", __FILE__, __LINE__);           \
+            printf(__VA_ARGS__);                                  \
+            printf("\n");                                         \
+            check_failures++;                                     \
+        }                                                         \
+    } while (0)
+
+inline int check_result(const char* name) {
+    printf("%s: %s (%d failures)\n", name, check_failures ? "FAILED" : "passed", check_failures);
+    return check_failures ? 1 : 0;
+}
+
+// Deterministic noise, so every run sees the same traces
+inline uint32_t check_random(uint32_t& state) {
+    state = state * 1664525u + 1013904223u;
+    return state;
+}
+
+#endif // HOST_CHECK_H
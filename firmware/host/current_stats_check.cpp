@@ -0,0 +1,137 @@
+// Checks the fixed-point statistics kernel against double precision:
+// current_stats_isqrt() over its whole range, and the accumulator with
+// current_stats_finish() on sine, DC and clipped traces at the sampler's
+// scale (1/16 mV from the sensor's zero, 5 kHz on the current pin).
+#include "check.h"
+#include "current_stats.h"
+#include <cmath>
+#include <vector>
+
+#define UNITS_PER_A (10.1 * 16)   // WCS1800: 10.1 mV/A
+#define SAMPLES_PER_CYCLE 100     // 50 Hz at 5 kHz
+#define WINDOW 1000               // ADC_SAMPLER_STATS_WINDOW_SAMPLES
+#define ADC_LOW  (-1632 * 16)     // 0 mV at the pin
+#define ADC_HIGH ((3100 - 1632) * 16) // Full scale at 11 dB
+
+static bool isqrt_correct(uint64_t value, uint32_t root) {
+    unsigned __int128 r = root;
+    return r * r <= value && (r + 1) * (r + 1) > value;
+}
+
+static void check_isqrt() {
+    for (uint64_t v = 0; v <= (1u << 20); v++) {
+        uint32_t root = current_stats_isqrt(v);
+        if (!isqrt_correct(v, root)) {
+            CHECK(false, "isqrt(%llu) = %u", (unsigned long long)v, root);
+            return;
+        }
+    }
+
+    // Around every power of two and the perfect squares next to it
+    for (int bit = 20; bit < 64; bit++) {
+        uint64_t p = 1ULL << bit;
+        uint64_t s = (uint64_t)sqrtl((long double)p);
+        for (uint64_t v : {p - 1, p, p + 1, s * s - 1, s * s, s * s + 1}) {
+            uint32_t root = current_stats_isqrt(v);
+            CHECK(isqrt_correct(v, root), "isqrt(%llu) = %u", (unsigned long long)v, root);
+        }
+    }
+    CHECK(current_stats_isqrt(UINT64_MAX) == UINT32_MAX, "isqrt(UINT64_MAX) = %u", current_stats_isqrt(UINT64_MAX));
+
+    uint32_t seed = 1;
+    for (int i = 0; i < 1000000; i++) {
+        uint64_t v = (uint64_t)check_random(seed) << 32 | check_random(seed);
+        v >>= check_random(seed) % 64;
+        uint32_t root = current_stats_isqrt(v);
+        if (!isqrt_correct(v, root)) {
+            CHECK(false, "isqrt(%llu) = %u", (unsigned long long)v, root);
+            return;
+        }
+    }
+}
+
+// Runs a trace through the kernel and compares with the same statistics
+// in double precision on the same integer samples
+static void check_trace(const char* name, const std::vector<int32_t>& samples) {
+    CurrentStatsAccumulator acc;
+    CurrentStats stats;
+    current_stats_reset(acc);
+    double sum = 0, sum_sq = 0, peak = 0;
+    for (int32_t s : samples) {
+        current_stats_add(acc, s);
+        sum += s;
+        sum_sq += (double)s * s;
+        peak = std::max(peak, std::fabs((double)s));
+    }
+    current_stats_finish(acc, stats);
+
+    double n = samples.size();
+    double mean = sum / n;
+    double rms = std::sqrt(sum_sq / n);
+    double crest = rms > 0 ? peak / rms * 256 : 0;
+
+    printf("%-22s mean %7d (%9.2f)  rms %6u (%9.2f)  peak %6u  crest %4u (%7.2f)\n", name,
+           (int)stats.mean, mean, (unsigned)stats.rms, rms, (unsigned)stats.peak, (unsigned)stats.crest_q8, crest);
+
+    CHECK(stats.samples == samples.size(), "%s: %u samples", name, (unsigned)stats.samples);
+    // Integer division and the integer root both round down
+    CHECK(std::fabs(stats.mean - mean) < 1, "%s: mean %d, expected %.2f", name, (int)stats.mean, mean);
+    CHECK(stats.rms <= rms + 1e-9 && stats.rms > rms - 1, "%s: rms %u, expected %.2f", name, (unsigned)stats.rms, rms);
+    CHECK(stats.peak == (uint32_t)peak, "%s: peak %u, expected %.0f", name, (unsigned)stats.peak, peak);
+    // A root one unit low raises the ratio by up to crest / (rms - 1)
+    double crest_tolerance = rms > 1 ? crest / (rms - 1) + 1 : 1;
+    CHECK(std::fabs(stats.crest_q8 - crest) <= crest_tolerance, "%s: crest %u, expected %.2f",
+          name, (unsigned)stats.crest_q8, crest);
+}
+
+static std::vector<int32_t> sine(double peak_a, double dc_a, double noise_a, int count) {
+    std::vector<int32_t> samples(count);
+    uint32_t seed = 7;
+    for (int i = 0; i < count; i++) {
+        double noise = noise_a * ((double)(check_random(seed) >> 8) / (1 << 24) - 0.5);
+        double amps = dc_a + peak_a * std::sin(2 * M_PI * i / SAMPLES_PER_CYCLE) + noise;
+        samples[i] = (int32_t)std::lround(amps * UNITS_PER_A);
+    }
+    return samples;
+}
+
+static std::vector<int32_t> clip(std::vector<int32_t> samples) {
+    for (int32_t& s : samples) s = std::min(std::max(s, (int32_t)ADC_LOW), (int32_t)ADC_HIGH);
+    return samples;
+}
+
+int main() {
+    check_isqrt();
+
+    check_trace("sine 5 A", sine(5, 0, 0, WINDOW));
+    check_trace("sine 12 A + noise", sine(12, 0, 0.5, WINDOW));
+    check_trace("sine 0.05 A", sine(0.05, 0, 0, WINDOW));
+    check_trace("DC 3 A", sine(0, 3, 0, WINDOW));
+    check_trace("DC -2 A", sine(0, -2, 0, WINDOW));
+    check_trace("DC 4 A + 1 A ripple", sine(1, 4, 0.1, WINDOW));
+    check_trace("no current", sine(0, 0, 0, WINDOW));
+    check_trace("clipped 200 A sine", clip(sine(200, 0, 0, WINDOW)));
+    check_trace("clipped DC offset", clip(sine(150, 60, 0, WINDOW)));
+    // A full-scale square wave over a long window must not overflow the sums
+    std::vector<int32_t> square(1000000);
+    for (size_t i = 0; i < square.size(); i++) square[i] = (i / 50) % 2 ? ADC_LOW : ADC_HIGH;
+    check_trace("full-scale square, 1M", square);
+    check_trace("one sample", {-1234});
+
+    // An empty window reports nothing rather than dividing by zero
+    CurrentStatsAccumulator acc;
+    CurrentStats stats;
+    current_stats_reset(acc);
+    current_stats_finish(acc, stats);
+    CHECK(stats.samples == 0 && stats.mean == 0 && stats.rms == 0 && stats.crest_q8 == 0, "empty window");
+
+    // In amps, the kernel's RMS of a clean sine is the textbook peak / sqrt(2)
+    std::vector<int32_t> s = sine(5, 0, 0, WINDOW);
+    current_stats_reset(acc);
+    for (int32_t x : s) current_stats_add(acc, x);
+    current_stats_finish(acc, stats);
+    double rms_a = stats.rms / UNITS_PER_A;
+    CHECK(std::fabs(rms_a - 5 / std::sqrt(2.0)) < 0.01, "5 A sine reads %.4f A RMS", rms_a);
+
+    return check_result("current_stats_check");
+}
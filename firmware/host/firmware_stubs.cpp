@@ -0,0 +1,125 @@
+#include "firmware_stubs.h"
+#include "adc_sampler.h"
+#include "burst_capture.h"
+#include "config_manager.h"
+#include "current_log.h"
+#include "current_sensor.h"
+#include "spectrum.h"
+#include "status_snapshot.h"
+#include "web_events.h"
+#include "web_server.h"
+#include "wifi_manager.h"
+#include "zone_monitor.h"
+
+// --- ADC sampler: one steady window, refreshed on every read ---
+
+#define HOST_CURRENT_ZERO_MV 1632 // VREF_ZERO_CURRENT
+#define HOST_CURRENT_MV_PER_A 10.1f // SENSITIVITY
+#define HOST_BATTERY_MV 1960 // 3.92 V behind the divider
+
+static float host_current_a = 0.0f;
+static uint32_t host_windows = 0;
+
+void host_set_current(float amps) {
+    host_current_a = amps;
+}
+
+bool adc_sampler_start(uint16_t) {
+    return true;
+}
+
+bool adc_sampler_add_frame_hook(AdcFrameHook) {
+    return true;
+}
+
+bool adc_sampler_latest(AdcReading& out) {
+    uint32_t rms = (uint32_t)current_sensor_stats_units(host_current_a);
+    out.currentMv = (uint16_t)(HOST_CURRENT_ZERO_MV + host_current_a * HOST_CURRENT_MV_PER_A);
+    out.batteryMv = HOST_BATTERY_MV;
+    out.timestamp = millis();
+    out.frames = ++host_windows * 20;
+    out.currentStats.mean = 0;
+    out.currentStats.rms = rms;
+    out.currentStats.peak = (uint32_t)(rms * 1.414f);
+    out.currentStats.crest_q8 = rms ? 362 : 0; // sqrt(2), a sine
+    out.currentStats.samples = 1000;
+    out.statsWindows = host_windows;
+    return true;
+}
+
+// --- Configuration: the defaults, never stored ---
+
+SystemConfig systemConfig;
+uint32_t configRevision = 0;
+
+void markConfigChanged() {
+    configRevision++;
+}
+
+void initializeDefaultConfig() {
+    for (int i = 0; i < ZONE_COUNT; i++) {
+        sprintf(systemConfig.zoneNames[i], "Zone %d", i + 1);
+    }
+    strcpy(systemConfig.zoneNames[2], "Vegetable beds");
+    for (int c = 0; c < 3; c++) {
+        CycleConfig& cycle = systemConfig.cycles[c];
+        cycle.enabled = (c == 0);
+        cycle.startTime = {6, 0};
+        cycle.daysActive = MONDAY | WEDNESDAY | FRIDAY;
+        cycle.interZoneDelay = 1;
+        for (int z = 0; z < ZONE_COUNT; z++) cycle.zoneDurations[z] = 5;
+        snprintf(cycle.name, sizeof(cycle.name), "Cycle %c", 'A' + c);
+    }
+}
+
+bool loadConfig() {
+    initializeDefaultConfig();
+    return true;
+}
+
+bool saveConfig() {
+    markConfigChanged();
+    return true;
+}
+
+// --- WiFi: connected, clock synced ---
+
+void wifi_manager_init() {}
+void wifi_manager_handle() {}
+void wifi_manager_check_connection() {}
+bool wifi_manager_is_connected() { return true; }
+bool wifi_manager_is_connecting() { return false; }
+String wifi_manager_get_ssid() { return "Garden"; }
+String wifi_manager_get_ip() { return "192.168.1.50"; }
+uint32_t wifi_manager_get_ip_raw() { return 192u | 168u << 8 | 1u << 16 | 50u << 24; }
+String wifi_manager_get_mac_address() { return "40:4C:CA:12:34:56"; }
+int8_t wifi_manager_get_rssi() { return -58; }
+String wifi_manager_get_portal_ssid() { return "Irrigation-Setup"; }
+bool wifi_manager_is_time_synced() { return true; }
+unsigned long wifi_manager_get_last_ntp_sync() { return 0; }
+void wifi_manager_start_portal() {}
+void wifi_manager_reset_credentials() {}
+void wifi_manager_cancel_connection() {}
+void wifi_manager_update_system_time(SystemDateTime&) {}
+
+// --- Modules with nothing to show on screen ---
+
+void current_log_init() {}
+void current_log_append(const CurrentHistoryEntry&) {}
+void current_log_handle() {}
+void current_log_flush() {}
+
+void burst_capture_init() {}
+void burst_capture_trigger(uint8_t, bool) {}
+
+void spectrum_init() {}
+void spectrum_set_run(int) {}
+
+void zone_monitor_init() {}
+ZoneAnomalyType zone_monitor_update(int, bool, float) { return ZONE_ANOMALY_NONE; }
+
+void initWebServer() {}
+void web_server_handle() {}
+void web_events_handle() {}
+void status_snapshot_init() {}
+void status_snapshot_handle() {}
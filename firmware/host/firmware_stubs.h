@@ -0,0 +1,11 @@
+#ifndef FIRMWARE_STUBS_H
+#define FIRMWARE_STUBS_H
+
+// Fixtures behind the modules that need the radio, the ADC or the flash,
+// which are not built on the host. They report a connected station with a
+// synced clock, the default configuration and a steady sensor reading.
+
+// Current the sampler fixture reports, A RMS (DC until set)
+void host_set_current(float amps);
+
+#endif // FIRMWARE_STUBS_H
@@ -0,0 +1,11 @@
+#ifndef PNG_WRITER_H
+#define PNG_WRITER_H
+
+#include <cstdint>
+
+// Writes an RGB565 image as a 24-bit PNG. The image data is stored, not
+// compressed, so no zlib is needed. Returns false if the file can't be
+// written.
+bool png_write_rgb565(const char* path, const uint16_t* pixels, int width, int height);
+
+#endif // PNG_WRITER_H
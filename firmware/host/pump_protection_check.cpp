@@ -0,0 +1,123 @@
+// Drives pump_protection_frame() with current traces the way the sampler
+// does (10 ms frames of 50 samples at 5 kHz, 50 Hz sine plus noise) and
+// measures how long each fault takes to trip the pump, and that normal
+// starts, steady running and short dips do not trip it.
+#include "check.h"
+#include "pump_protection.h"
+#include "current_sensor.h"
+#include <cmath>
+
+#define PUMP_PIN 4
+#define FRAME_MS 10
+#define FRAME_SAMPLES 50        // Current pin conversions per frame
+#define SAMPLES_PER_CYCLE 100   // 50 Hz at 5 kHz
+
+struct Segment {
+    uint32_t ms;   // 0 ends the trace
+    float rms_a;
+};
+
+struct Scenario {
+    const char* name;
+    Segment trace[4];
+    PumpTripReason expected;
+    uint32_t expected_ms; // After the start of the last segment
+};
+
+// The relay is switched on at t = 0, after 2.5 s off: long enough to
+// clear the sampler's two-frame window and any dry-run timer
+static const Scenario scenarios[] = {
+    {"step 5 -> 20 A",     {{2500, 5.0f}, {500, 20.0f}},             PUMP_TRIP_OVERCURRENT, 10},
+    {"step 5 -> 13 A",     {{2500, 5.0f}, {500, 13.0f}},             PUMP_TRIP_OVERCURRENT, 20},
+    {"locked rotor 30 A",  {{1000, 30.0f}},                          PUMP_TRIP_OVERCURRENT, 500},
+    {"drop to 0.2 A",      {{2500, 5.0f}, {1000, 0.2f}},             PUMP_TRIP_DRY_RUN,     210},
+    {"inrush 300 ms 30 A", {{300, 30.0f}, {3000, 5.0f}},             PUMP_TRIP_NONE,        0},
+    {"steady 11 A",        {{5000, 11.0f}},                          PUMP_TRIP_NONE,        0},
+    {"100 ms dips 0.3 A",  {{2500, 5.0f}, {100, 0.3f}, {500, 5.0f}, {100, 0.3f}}, PUMP_TRIP_NONE, 0},
+};
+
+static uint32_t noise_seed = 11;
+static uint32_t phase = 0;
+
+// One frame of samples at the sampler's scale, as the frame hook sees it
+static CurrentStatsAccumulator frame_of(float rms_a) {
+    CurrentStatsAccumulator acc;
+    current_stats_reset(acc);
+    for (int i = 0; i < FRAME_SAMPLES; i++, phase++) {
+        double noise = 0.05 * ((double)(check_random(noise_seed) >> 8) / (1 << 24) - 0.5);
+        double amps = rms_a * M_SQRT2 * std::sin(2 * M_PI * phase / SAMPLES_PER_CYCLE) + noise;
+        current_stats_add(acc, current_sensor_stats_units((float)amps));
+    }
+    return acc;
+}
+
+// Feeds `ms` of frames, advancing the clock; returns the trip, if any
+static PumpTripReason run(uint32_t ms, float rms_a, uint32_t& trip_ms) {
+    for (uint32_t t = 0; t < ms; t += FRAME_MS) {
+        host_advance_ms(FRAME_MS);
+        PumpTripReason reason = pump_protection_frame(frame_of(rms_a), millis());
+        if (reason != PUMP_TRIP_NONE) {
+            trip_ms = t + FRAME_MS;
+            return reason;
+        }
+    }
+    return PUMP_TRIP_NONE;
+}
+
+static void check_scenario(const Scenario& s) {
+    pump_protection_reset();
+    pump_protection_set_pump_on(false);
+    uint32_t ignored;
+    run(2500, 0.0f, ignored);
+
+    digitalWrite(PUMP_PIN, HIGH);
+    pump_protection_set_pump_on(true);
+
+    PumpTripReason reason = PUMP_TRIP_NONE;
+    uint32_t trip_ms = 0;
+    int segments = 0, ran = 0;
+    for (const Segment& seg : s.trace) {
+        if (seg.ms == 0) break;
+        segments++;
+        if (reason == PUMP_TRIP_NONE) {
+            reason = run(seg.ms, seg.rms_a, trip_ms);
+            ran++;
+        }
+    }
+
+    PumpTripInfo info = pump_protection_last_trip();
+    if (reason != PUMP_TRIP_NONE) {
+        printf("%-20s %-12s after %4u ms at %5.1f A\n", s.name, pump_trip_reason_name(reason), (unsigned)trip_ms,
+               info.current);
+    } else {
+        printf("%-20s %-12s\n", s.name, "no trip");
+    }
+
+    CHECK(reason == s.expected, "%s: tripped %s, expected %s", s.name, pump_trip_reason_name(reason),
+          pump_trip_reason_name(s.expected));
+    if (s.expected == PUMP_TRIP_NONE) {
+        CHECK(!pump_protection_tripped() && host_pin_level(PUMP_PIN) == HIGH, "%s: pump stopped", s.name);
+        return;
+    }
+    CHECK(ran == segments && trip_ms == s.expected_ms, "%s: tripped after %u ms in segment %d, expected %u ms",
+          s.name, (unsigned)trip_ms, ran, (unsigned)s.expected_ms);
+    CHECK(pump_protection_tripped(), "%s: latch not set", s.name);
+    CHECK(host_pin_level(PUMP_PIN) == LOW, "%s: pump pin still high", s.name);
+    CHECK(info.reason == reason && info.timestamp == millis(), "%s: last trip %s at %u", s.name,
+          pump_trip_reason_name(info.reason), (unsigned)info.timestamp);
+
+    // Latched: a restart the loop should have refused does not trip again
+    pump_protection_set_pump_on(true);
+    uint32_t count = pump_protection_trip_count();
+    CHECK(run(100, 30.0f, ignored) == PUMP_TRIP_NONE && pump_protection_trip_count() == count,
+          "%s: tripped again while latched", s.name);
+}
+
+int main() {
+    pinMode(PUMP_PIN, OUTPUT);
+    pump_protection_init(PUMP_PIN);
+    for (const Scenario& s : scenarios) {
+        check_scenario(s);
+    }
+    return check_result("pump_protection_check");
+}
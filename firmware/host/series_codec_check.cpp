@@ -0,0 +1,207 @@
+// Checks the history block codec: points round-trip at every prefix class,
+// blocks fill up to their capacity, SeriesStore keeps its count, and
+// damaged blocks are either rejected by series_block_valid() or stop the
+// decoder at the end of the bits instead of reading past them.
+#include "check.h"
+#include "series_codec.h"
+#include <cmath>
+#include <vector>
+
+struct Point {
+    int64_t ts;
+    float value;
+};
+
+// Encodes points until the block is full; returns how many went in
+static size_t encode(SeriesBlock& block, const std::vector<Point>& points) {
+    SeriesEncoder enc;
+    series_encoder_begin(enc, &block);
+    size_t n = 0;
+    while (n < points.size() && series_encoder_add(enc, points[n].ts, points[n].value)) n++;
+    return n;
+}
+
+static std::vector<Point> decode(const SeriesBlock& block) {
+    std::vector<Point> out;
+    SeriesDecoder dec;
+    series_decoder_begin(dec, &block);
+    Point p;
+    while (series_decoder_next(dec, p.ts, p.value)) out.push_back(p);
+    return out;
+}
+
+static void check_round_trip(const char* name, const std::vector<Point>& points) {
+    SeriesBlock block;
+    size_t stored = encode(block, points);
+    std::vector<Point> decoded = decode(block);
+
+    printf("%-24s %4zu of %4zu points in one block, %.2f bytes each\n", name, stored, points.size(),
+           stored ? (double)SERIES_BLOCK_BYTES / stored : 0.0);
+    CHECK(stored > 0, "%s: nothing stored", name);
+    CHECK(series_block_valid(block), "%s: block rejected", name);
+    CHECK(decoded.size() == stored, "%s: %zu decoded, %zu stored", name, decoded.size(), stored);
+    for (size_t i = 0; i < decoded.size() && i < stored; i++) {
+        float expected = std::lround(points[i].value * SERIES_VALUE_SCALE) / (float)SERIES_VALUE_SCALE;
+        if (decoded[i].ts != points[i].ts || std::fabs(decoded[i].value - expected) > 1e-4f) {
+            CHECK(false, "%s: point %zu is %lld %.2f, expected %lld %.2f", name, i, (long long)decoded[i].ts,
+                  decoded[i].value, (long long)points[i].ts, expected);
+            break;
+        }
+    }
+    if (stored > 0) {
+        CHECK(block.header.first_ts == points[0].ts && block.header.last_ts == points[stored - 1].ts,
+              "%s: header spans %lld..%lld", name, (long long)block.header.first_ts, (long long)block.header.last_ts);
+    }
+}
+
+static void check_round_trips() {
+    std::vector<Point> steady, jitter, steps, gaps, rails;
+    uint32_t seed = 3;
+    int64_t ts = 1700000000000LL;
+    for (int i = 0; i < 2000; i++) {
+        steady.push_back({ts + i * 500LL, 4.2f});
+    }
+    for (int i = 0; i < 2000; i++) {
+        ts += 500 + (int64_t)(check_random(seed) % 23) - 11;
+        jitter.push_back({ts, 4.0f + 0.01f * (float)((int)(check_random(seed) % 41) - 20)});
+    }
+    // Value and timestamp deltas in every prefix class, both signs
+    static const int64_t dods[] = {0, 5, -60, 200, -250, 2000, -2047, 100000, -3000000};
+    static const float dvs[] = {0, 0.3f, -0.6f, 2.5f, -2.2f, 150.0f, -150.0f};
+    int64_t delta = 1000;
+    float value = 0;
+    ts = 0;
+    for (int i = 0; i < 300; i++) {
+        delta += dods[i % 9];
+        if (delta < 1) delta = 1;
+        ts += delta;
+        value += dvs[i % 7];
+        steps.push_back({ts, value});
+    }
+    // Long gaps between runs, and negative (restored) timestamps
+    ts = -86400000LL;
+    for (int i = 0; i < 300; i++) {
+        ts += (i % 10 == 9) ? 2000000000LL : 500;
+        gaps.push_back({ts, (i % 10 == 9) ? 0.0f : 3.5f});
+    }
+    // Currents beyond the int16 centiamp range are clamped
+    for (int i = 0; i < 100; i++) {
+        rails.push_back({i * 1000LL, (i % 2) ? 400.0f : -400.0f});
+    }
+
+    check_round_trip("steady", steady);
+    check_round_trip("jitter and noise", jitter);
+    check_round_trip("every prefix class", steps);
+    check_round_trip("gaps, negative time", gaps);
+
+    SeriesBlock block;
+    size_t stored = encode(block, rails);
+    std::vector<Point> decoded = decode(block);
+    CHECK(decoded.size() == stored && stored > 0, "rails: %zu of %zu decoded", decoded.size(), stored);
+    for (const Point& p : decoded) {
+        CHECK(std::fabs(p.value) >= 327.0f, "rails: %.2f not clamped", p.value);
+    }
+
+    // A gap that does not fit in 32 bits ends the block
+    SeriesEncoder enc;
+    series_encoder_begin(enc, &block);
+    CHECK(series_encoder_add(enc, 0, 1.0f), "first point refused");
+    CHECK(!series_encoder_add(enc, 1LL << 40, 1.0f), "40-bit gap accepted");
+    CHECK(block.header.count == 1, "refused point changed the block");
+}
+
+// The densest block the encoder can write, a repeated point at two bits
+// each, reaches the count series_block_valid() allows and no further
+static void check_capacity() {
+    std::vector<Point> flat;
+    for (int i = 0; i < 5000; i++) flat.push_back({1000, 1.0f});
+    SeriesBlock block;
+    size_t stored = encode(block, flat);
+    size_t capacity = 1 + sizeof(block.bits) * 8 / 2;
+    printf("%-24s %4zu points, capacity %zu\n", "densest block", stored, capacity);
+    CHECK(stored == capacity, "densest block holds %zu, capacity %zu", stored, capacity);
+    CHECK(series_block_valid(block), "densest block rejected");
+    CHECK(decode(block).size() == stored, "densest block decodes short");
+}
+
+static void check_damaged_blocks() {
+    std::vector<Point> points;
+    for (int i = 0; i < 100; i++) points.push_back({i * 500LL, 1.0f + 0.1f * (i % 7)});
+    SeriesBlock good;
+    encode(good, points);
+    size_t capacity = 1 + sizeof(good.bits) * 8 / 2;
+
+    SeriesBlock b = good;
+    b.header.magic = 0;
+    CHECK(!series_block_valid(b), "bad magic accepted");
+    b = good;
+    b.header.count = 0;
+    CHECK(!series_block_valid(b), "empty block accepted");
+    b = good;
+    b.header.count = capacity + 1;
+    CHECK(!series_block_valid(b), "count past capacity accepted");
+    b = good;
+    b.header.first_ts = b.header.last_ts + 1;
+    CHECK(!series_block_valid(b), "first_ts after last_ts accepted");
+
+    // A count the bits cannot back: decoding stops at the end of the block
+    // (the copy sits in a larger buffer so an overrun would read garbage
+    // rather than crash)
+    struct {
+        SeriesBlock block;
+        uint8_t after[64];
+    } padded;
+    memset(padded.after, 0xFF, sizeof(padded.after));
+    padded.block = good;
+    memset(padded.block.bits, 0xFF, sizeof(padded.block.bits));
+    padded.block.header.count = capacity;
+    std::vector<Point> decoded = decode(padded.block);
+    size_t max_points = 1 + sizeof(good.bits) * 8 / (4 + 32 + 3 + 17);
+    printf("%-24s %4zu points before the bits ran out\n", "all-ones body", decoded.size());
+    CHECK(decoded.size() <= max_points, "all-ones body decoded %zu points", decoded.size());
+
+    padded.block = good;
+    padded.block.header.count = capacity;
+    decoded = decode(padded.block);
+    CHECK(decoded.size() <= capacity, "overlong count decoded %zu points", decoded.size());
+    CHECK(decoded.size() >= points.size(), "overlong count lost the real points");
+
+    // Once stopped it stays stopped
+    SeriesDecoder dec;
+    series_decoder_begin(dec, &padded.block);
+    Point p;
+    while (series_decoder_next(dec, p.ts, p.value)) {}
+    CHECK(!series_decoder_next(dec, p.ts, p.value), "decoder resumed after stopping");
+}
+
+static void check_store() {
+    static SeriesStore<4> store;
+    int64_t ts = 0;
+    size_t pushed = 0;
+    for (int i = 0; i < 20000; i++) {
+        ts += 500 + i % 13;
+        store.push(ts, 2.0f + 0.01f * (i % 50));
+        pushed++;
+    }
+    size_t visited = 0;
+    int64_t last = INT64_MIN;
+    bool ordered = true;
+    store.forEachSince(INT64_MIN, [&](int64_t t, float) {
+        ordered = ordered && t > last;
+        last = t;
+        visited++;
+    });
+    printf("%-24s %4zu of %zu points kept in 4 blocks\n", "store", store.size(), pushed);
+    CHECK(store.full(), "store not full");
+    CHECK(visited == store.size(), "store visits %zu, size %zu", visited, store.size());
+    CHECK(ordered, "store out of order");
+    CHECK(last == ts && store.newestTimestamp() == ts, "newest point lost");
+}
+
+int main() {
+    check_round_trips();
+    check_capacity();
+    check_damaged_blocks();
+    check_store();
+    return check_result("series_codec_check");
+}
@@ -0,0 +1,12 @@
+#ifndef HOST_ADAFRUIT_ST7789_H
+#define HOST_ADAFRUIT_ST7789_H
+
+// Only the declarations st7789_dma_driver.h needs. On the host the driver
+// is replaced by host/st7789_emulator.cpp, which draws into RAM.
+#include "Adafruit_GFX.h"
+#include "SPI.h"
+
+#define ST77XX_BLACK 0x0000
+#define ST77XX_WHITE 0xFFFF
+
+#endif // HOST_ADAFRUIT_ST7789_H
@@ -0,0 +1,66 @@
+#include "Arduino.h"
+#include "LittleFS.h"
+#include "SPI.h"
+
+HardwareSerial Serial;
+EspClass ESP;
+SPIClass SPI;
+LittleFSFS LittleFS;
+
+// Starts a little after boot, as the device's clock would by the time
+// anything runs
+static uint64_t host_time_us = 1000000;
+static int pin_levels[64];
+
+size_t Print::print(const String& s) {
+    return write(s.c_str());
+}
+
+uint32_t millis() {
+    return (uint32_t)(host_time_us / 1000);
+}
+
+uint32_t micros() {
+    return (uint32_t)host_time_us;
+}
+
+int64_t esp_timer_get_time() {
+    return (int64_t)host_time_us;
+}
+
+void host_advance_ms(uint32_t ms) {
+    host_time_us += (uint64_t)ms * 1000;
+}
+
+void delay(uint32_t ms) {
+    host_advance_ms(ms);
+}
+
+void yield() {}
+
+uint32_t getCpuFrequencyMhz() {
+    return 160;
+}
+
+// A pulled-up input with nothing pressing it reads HIGH
+void pinMode(uint8_t pin, uint8_t mode) {
+    if (mode == INPUT_PULLUP) digitalWrite(pin, HIGH);
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    if (pin < sizeof(pin_levels) / sizeof(pin_levels[0])) pin_levels[pin] = value;
+}
+
+int digitalRead(uint8_t pin) {
+    return host_pin_level(pin);
+}
+
+int host_pin_level(uint8_t pin) {
+    return pin < sizeof(pin_levels) / sizeof(pin_levels[0]) ? pin_levels[pin] : LOW;
+}
+
+void attachInterrupt(uint8_t, void (*)(), int) {}
+
+uint32_t analogReadMilliVolts(uint8_t) {
+    return 0;
+}
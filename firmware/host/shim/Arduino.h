@@ -0,0 +1,106 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Just enough of the ESP32 Arduino core for the firmware sources to build
+// on a PC. Time is simulated: millis() and friends only move when a host
+// program calls host_advance_ms(), so every run draws and decides the same.
+#include <algorithm>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "Print.h"
+
+using std::abs;
+using std::max;
+using std::min;
+
+typedef uint8_t byte;
+
+#define HIGH 1
+#define LOW  0
+#define INPUT        0x01
+#define OUTPUT       0x03
+#define INPUT_PULLUP 0x05
+#define CHANGE       0x03
+
+#define PI      3.1415926535897932384626433832795
+#define HALF_PI 1.5707963267948966192313216916398
+#define TWO_PI  6.283185307179586476925286766559
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define IRAM_ATTR
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const unsigned char*)(addr))
+#define pgm_read_word(addr) (*(const unsigned short*)(addr))
+
+#define digitalPinToInterrupt(p) (p)
+
+uint32_t millis();
+uint32_t micros();
+int64_t esp_timer_get_time();
+void delay(uint32_t ms);
+void yield();
+uint32_t getCpuFrequencyMhz();
+
+// Moves the simulated clock on
+void host_advance_ms(uint32_t ms);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+// Last level written to a pin, for checks
+int host_pin_level(uint8_t pin);
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode);
+inline void noInterrupts() {}
+inline void interrupts() {}
+uint32_t analogReadMilliVolts(uint8_t pin);
+enum adc_attenuation_t { ADC_0db, ADC_2_5db, ADC_6db, ADC_11db };
+inline void analogSetPinAttenuation(uint8_t, adc_attenuation_t) {}
+
+class String {
+public:
+    String() {}
+    String(const char* s) : _s(s ? s : "") {}
+    String(const std::string& s) : _s(s) {}
+    explicit String(int value) : _s(std::to_string(value)) {}
+    explicit String(unsigned value) : _s(std::to_string(value)) {}
+    explicit String(long value) : _s(std::to_string(value)) {}
+    explicit String(unsigned long value) : _s(std::to_string(value)) {}
+
+    const char* c_str() const { return _s.c_str(); }
+    unsigned length() const { return (unsigned)_s.size(); }
+    bool isEmpty() const { return _s.empty(); }
+    String& operator+=(const String& other) { _s += other._s; return *this; }
+    String& operator+=(const char* other) { _s += other; return *this; }
+    String& operator+=(char c) { _s += c; return *this; }
+    friend String operator+(const String& a, const String& b) { return String(a._s + b._s); }
+    bool operator==(const String& other) const { return _s == other._s; }
+    bool operator!=(const String& other) const { return _s != other._s; }
+
+private:
+    std::string _s;
+};
+
+class HardwareSerial : public Print {
+public:
+    void begin(unsigned long) {}
+    size_t write(uint8_t c) override { return fputc(c, stdout) == EOF ? 0 : 1; }
+    using Print::write;
+};
+extern HardwareSerial Serial;
+
+class EspClass {
+public:
+    uint32_t getFreeHeap() { return 200000; }
+    uint8_t getChipRevision() { return 0; }
+    void restart() {}
+};
+extern EspClass ESP;
+
+#endif // HOST_ARDUINO_H
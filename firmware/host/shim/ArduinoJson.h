@@ -0,0 +1,8 @@
+#ifndef HOST_ARDUINOJSON_H
+#define HOST_ARDUINOJSON_H
+
+// Names used in declarations of modules that are not built on the host
+class JsonDocument;
+class JsonObject;
+
+#endif // HOST_ARDUINOJSON_H
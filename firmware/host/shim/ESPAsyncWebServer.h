@@ -0,0 +1,10 @@
+#ifndef HOST_ESPASYNCWEBSERVER_H
+#define HOST_ESPASYNCWEBSERVER_H
+
+// The web server is not built on the host; its headers only need the names
+#include "Arduino.h"
+
+class AsyncWebServer;
+class AsyncWebServerRequest;
+
+#endif // HOST_ESPASYNCWEBSERVER_H
@@ -0,0 +1,12 @@
+#ifndef HOST_LITTLEFS_H
+#define HOST_LITTLEFS_H
+
+// There is no file system on the host; mounting succeeds and nothing else
+// is offered
+class LittleFSFS {
+public:
+    bool begin(bool formatOnFail = false) { (void)formatOnFail; return true; }
+};
+extern LittleFSFS LittleFS;
+
+#endif // HOST_LITTLEFS_H
@@ -0,0 +1,64 @@
+#ifndef HOST_PRINT_H
+#define HOST_PRINT_H
+
+// Arduino's Print: formatting on top of a single-byte write()
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+class String;
+
+#define DEC 10
+#define HEX 16
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size) {
+        size_t n = 0;
+        while (size--) n += write(*buffer++);
+        return n;
+    }
+    size_t write(const char* str) { return str ? write((const uint8_t*)str, strlen(str)) : 0; }
+
+    size_t print(const char* s) { return write(s); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(const String& s);
+    size_t print(int n, int base = DEC) { return print((long)n, base); }
+    size_t print(unsigned n, int base = DEC) { return print((unsigned long)n, base); }
+    size_t print(long n, int base = DEC) { return formatted(base == HEX ? "%lx" : "%ld", n); }
+    size_t print(unsigned long n, int base = DEC) { return formatted(base == HEX ? "%lx" : "%lu", n); }
+    size_t print(double n, int digits = 2) { return formatted("%.*f", digits, n); }
+
+    size_t println() { return write("\r\n"); }
+    template <typename T>
+    size_t println(const T& value) { return print(value) + println(); }
+
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+        va_list args;
+        va_start(args, format);
+        size_t n = vformatted(format, args);
+        va_end(args);
+        return n;
+    }
+
+private:
+    size_t formatted(const char* format, ...) {
+        va_list args;
+        va_start(args, format);
+        size_t n = vformatted(format, args);
+        va_end(args);
+        return n;
+    }
+    size_t vformatted(const char* format, va_list args) {
+        char buf[256];
+        int len = vsnprintf(buf, sizeof(buf), format, args);
+        if (len < 0) return 0;
+        return write((const uint8_t*)buf, (size_t)len < sizeof(buf) ? (size_t)len : sizeof(buf) - 1);
+    }
+};
+
+#endif // HOST_PRINT_H
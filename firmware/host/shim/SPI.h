@@ -0,0 +1,8 @@
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+// The display driver's bus type; nothing is sent on the host
+class SPIClass {};
+extern SPIClass SPI;
+
+#endif // HOST_SPI_H
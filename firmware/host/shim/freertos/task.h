@@ -0,0 +1,19 @@
+#ifndef HOST_FREERTOS_TASK_H
+#define HOST_FREERTOS_TASK_H
+
+#include "FreeRTOS.h"
+
+typedef void (*TaskFunction_t)(void*);
+
+// Tasks are not run on the host: creation fails, as on a device out of
+// memory, and the modules fall back accordingly
+inline BaseType_t xTaskCreate(TaskFunction_t, const char*, uint32_t, void*, uint32_t, TaskHandle_t* handle) {
+    if (handle) *handle = nullptr;
+    return pdFALSE;
+}
+inline void vTaskDelete(TaskHandle_t) {}
+inline void vTaskDelay(TickType_t) {}
+inline void xTaskNotifyGive(TaskHandle_t) {}
+inline uint32_t ulTaskNotifyTake(BaseType_t, TickType_t) { return 0; }
+
+#endif // HOST_FREERTOS_TASK_H
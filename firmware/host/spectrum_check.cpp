@@ -0,0 +1,157 @@
+// Checks the pump current spectrum analysis: the fixed-point FFT against a
+// double precision DFT of the same input, and the metrics on windows of
+// 50 Hz pump current at the sampler's scale (1/16 mV, 5 kHz) that is
+// clean, distorted by a 3rd harmonic, amplitude modulated, or noisy. Each
+// window's metrics are also compared with the same reduction of the exact
+// spectrum, so FFT rounding cannot move a metric far.
+#include "check.h"
+#include "spectrum.h"
+#include "current_sensor.h"
+#include "current_stats.h"
+#include <cmath>
+#include <vector>
+
+#define UNITS_PER_A (10.1 * 16) // WCS1800: 10.1 mV/A
+#define BINS (SPECTRUM_SIZE / 2)
+
+// The sensor and sampler spectrum.cpp is linked against, at their real scale
+int32_t current_sensor_stats_units(float amps) {
+    return (int32_t)lround(amps * UNITS_PER_A);
+}
+
+float current_sensor_amps_per_stats_unit() {
+    return (float)(1.0 / UNITS_PER_A);
+}
+
+bool adc_sampler_add_frame_hook(AdcFrameHook) {
+    return true;
+}
+
+static void dft(const std::vector<double>& x, std::vector<double>& re, std::vector<double>& im) {
+    const size_t n = x.size();
+    re.assign(n, 0);
+    im.assign(n, 0);
+    for (size_t k = 0; k < n; k++) {
+        for (size_t t = 0; t < n; t++) {
+            double a = 2 * M_PI * (double)((k * t) % n) / n;
+            re[k] += x[t] * std::cos(a);
+            im[k] -= x[t] * std::sin(a);
+        }
+    }
+}
+
+static void check_fft(const char* name, const std::vector<int32_t>& input) {
+    std::vector<int32_t> re(input), im(SPECTRUM_SIZE, 0);
+    spectrum_fft(re.data(), im.data());
+
+    std::vector<double> x(input.begin(), input.end()), dre, dim;
+    dft(x, dre, dim);
+
+    double peak = 0, max_error = 0;
+    for (size_t k = 0; k < SPECTRUM_SIZE; k++) {
+        peak = std::max(peak, std::hypot(dre[k], dim[k]));
+        max_error = std::max(max_error, std::hypot(re[k] - dre[k], im[k] - dim[k]));
+    }
+    printf("%-24s peak %9.0f  max error %6.1f (%.5f%%)\n", name, peak, max_error, 100 * max_error / peak);
+    // Each of the ten stages rounds the rotated half down, and its Q15
+    // twiddles are good to 2^-15 of what they rotate
+    double bound = 512 + peak * 10 / 32768;
+    CHECK(max_error < bound, "%s: FFT off by %.1f, bound %.1f", name, max_error, bound);
+}
+
+static void check_ffts() {
+    std::vector<int32_t> impulse(SPECTRUM_SIZE, 0), tone(SPECTRUM_SIZE), noise(SPECTRUM_SIZE), full(SPECTRUM_SIZE);
+    impulse[0] = 32767;
+    uint32_t seed = 5;
+    for (int n = 0; n < SPECTRUM_SIZE; n++) {
+        tone[n] = (int32_t)lround(2000 * std::sin(2 * M_PI * 50.0 * n / SPECTRUM_RATE_HZ));
+        noise[n] = (int32_t)(check_random(seed) >> 17) - 16384;
+        full[n] = (n / 3) % 2 ? 32767 : -32767;
+    }
+    check_fft("impulse", impulse);
+    check_fft("50 Hz sine, 2000", tone);
+    check_fft("white noise, 2^14", noise);
+    check_fft("full-scale square", full);
+}
+
+// A window of current as the sampler delivers it, in amps per sample
+typedef double (*Waveform)(double t, uint32_t& seed);
+
+static double clean(double t, uint32_t&) {
+    return 8 * M_SQRT2 * std::sin(2 * M_PI * 50 * t);
+}
+
+static double third(double t, uint32_t& seed) {
+    return clean(t, seed) + 0.8 * M_SQRT2 * std::sin(2 * M_PI * 150 * t + 0.4);
+}
+
+static double modulated(double t, uint32_t& seed) {
+    return clean(t, seed) * (1 + 0.1 * std::sin(2 * M_PI * 173 * t));
+}
+
+static double noisy(double t, uint32_t& seed) {
+    return clean(t, seed) + 1.0 * ((double)(check_random(seed) >> 8) / (1 << 24) - 0.5);
+}
+
+// Windows the samples, transforms them and reduces the amplitudes as the
+// analysis task does; `exact` uses the double DFT instead of the FFT
+static SpectrumMetrics metrics_of(Waveform wave, bool exact) {
+    uint32_t seed = 9;
+    std::vector<int32_t> re(SPECTRUM_SIZE), im(SPECTRUM_SIZE, 0);
+    for (int n = 0; n < SPECTRUM_SIZE; n++) {
+        int32_t sample = (int32_t)lround(wave((double)n / SPECTRUM_RATE_HZ, seed) * UNITS_PER_A);
+        double hann = 0.5 * (1 - std::cos(2 * M_PI * n / SPECTRUM_SIZE));
+        re[n] = (int32_t)std::floor(sample * hann);
+    }
+
+    std::vector<uint32_t> amplitude(BINS);
+    if (exact) {
+        std::vector<double> x(re.begin(), re.end()), dre, dim;
+        dft(x, dre, dim);
+        for (int k = 0; k < BINS; k++) amplitude[k] = (uint32_t)std::hypot(dre[k], dim[k]);
+    } else {
+        spectrum_fft(re.data(), im.data());
+        for (int k = 0; k < BINS; k++) {
+            amplitude[k] = current_stats_isqrt((uint64_t)((int64_t)re[k] * re[k] + (int64_t)im[k] * im[k]));
+        }
+    }
+    SpectrumMetrics m;
+    spectrum_metrics(amplitude.data(), BINS, m);
+    return m;
+}
+
+struct Range {
+    uint16_t min, max;
+};
+
+static void check_metrics(const char* name, Waveform wave, Range thd, Range h3, Range sideband, Range noise) {
+    SpectrumMetrics m = metrics_of(wave, false);
+    SpectrumMetrics e = metrics_of(wave, true);
+    printf("%-24s f0 %4.1f Hz  thd %4u (%4u)  h3 %4u (%4u)  sideband %4u (%4u)  noise %4u (%4u)\n", name,
+           m.f0_dhz / 10.0, m.thd, e.thd, m.h3, e.h3, m.sideband, e.sideband, m.noise, e.noise);
+
+    CHECK(m.f0_dhz >= 495 && m.f0_dhz <= 505, "%s: f0 %u dHz", name, m.f0_dhz);
+    CHECK(m.thd >= thd.min && m.thd <= thd.max, "%s: thd %u", name, m.thd);
+    CHECK(m.h3 >= h3.min && m.h3 <= h3.max, "%s: h3 %u", name, m.h3);
+    CHECK(m.sideband >= sideband.min && m.sideband <= sideband.max, "%s: sideband %u", name, m.sideband);
+    CHECK(m.noise >= noise.min && m.noise <= noise.max, "%s: noise %u", name, m.noise);
+    CHECK(abs(m.thd - e.thd) <= 2 && abs(m.h3 - e.h3) <= 2 && abs(m.sideband - e.sideband) <= 2 &&
+          abs(m.noise - e.noise) <= 2, "%s: FFT metrics differ from the exact spectrum's", name);
+}
+
+int main() {
+    check_ffts();
+
+    // 8 A RMS at 50 Hz, which falls between bins (10.24 of them per 50 Hz):
+    // the Hann window's leakage is the floor every metric starts from
+    check_metrics("clean 50 Hz, 8 A", clean, {0, 5}, {0, 5}, {0, 20}, {0, 5});
+    // 10% 3rd harmonic: h3 and thd read 100 permille
+    check_metrics("10% 3rd harmonic", third, {95, 105}, {95, 105}, {0, 20}, {0, 5});
+    // 10% AM at 173 Hz: two sidebands of 5% each, sqrt(2) * 50 permille
+    check_metrics("10% AM at 173 Hz", modulated, {0, 5}, {0, 5}, {65, 80}, {0, 5});
+    // 1 A of broadband noise: the share above 1 kHz and between the
+    // harmonic lobes
+    check_metrics("1 A broadband noise", noisy, {0, 20}, {0, 20}, {0, 40}, {10, 40});
+
+    return check_result("spectrum_check");
+}
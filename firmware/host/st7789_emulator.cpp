@@ -0,0 +1,120 @@
+#include "st7789_emulator.h"
+
+static uint16_t panel[ST7789_EMULATOR_HEIGHT][ST7789_EMULATOR_WIDTH];
+static uint16_t palette_lut[256];
+static uint32_t pixels_pushed = 0;
+static st7789_frame_done_cb_t frame_done_cb = nullptr;
+
+// The queued frame, as the push task would hold it
+static bool frame_in_flight = false;
+static const uint8_t* job_buffer = nullptr;
+static int16_t job_stride = 0;
+static int16_t job_origin_y = 0;
+static DisplayRect job_rects[ST7789_MAX_RECTS];
+static uint8_t job_rect_count = 0;
+static st7789_pixel_source_t job_source = nullptr;
+static void* job_source_ctx = nullptr;
+
+static void st7789_emulator_check(const DisplayRect& r) {
+    if (r.x < 0 || r.y < 0 || r.w <= 0 || r.h <= 0 ||
+        r.x + r.w > ST7789_EMULATOR_WIDTH || r.y + r.h > ST7789_EMULATOR_HEIGHT) {
+        fprintf(stderr, "st7789: window %d,%d %dx%d is off the panel\n", r.x, r.y, r.w, r.h);
+        abort();
+    }
+}
+
+// Sends the queued frame, as the push task does in the background
+static void st7789_emulator_complete() {
+    if (!frame_in_flight) return;
+    for (uint8_t i = 0; i < job_rect_count; i++) {
+        const DisplayRect& r = job_rects[i];
+        for (int16_t row = 0; row < r.h; row++) {
+            uint16_t* dst = &panel[r.y + row][r.x];
+            if (job_source) {
+                job_source(dst, r.w, job_source_ctx);
+            } else {
+                const uint8_t* src = job_buffer + (size_t)(r.y - job_origin_y + row) * job_stride + r.x;
+                for (int16_t x = 0; x < r.w; x++) {
+                    dst[x] = palette_lut[src[x]];
+                }
+            }
+        }
+        pixels_pushed += (uint32_t)r.w * r.h;
+    }
+    frame_in_flight = false;
+    if (frame_done_cb) frame_done_cb();
+}
+
+const uint16_t* st7789_emulator_panel() {
+    st7789_emulator_complete();
+    return &panel[0][0];
+}
+
+uint32_t st7789_emulator_pixels_pushed() {
+    st7789_emulator_complete();
+    return pixels_pushed;
+}
+
+void st7789_init_display(int8_t, int8_t, int8_t, int8_t, SPIClass*) {
+    frame_in_flight = false;
+    memset(panel, 0, sizeof(panel));
+}
+
+void st7789_push_canvas(const uint8_t* buffer, int16_t w, int16_t h) {
+    st7789_wait_for_frame();
+    st7789_push_canvas_async(buffer, w, h);
+    st7789_wait_for_frame();
+}
+
+void st7789_set_backlight(bool) {}
+
+void st7789_set_palette(const uint16_t* palette) {
+    memcpy(palette_lut, palette, sizeof(palette_lut));
+}
+
+bool st7789_push_canvas_async(const uint8_t* buffer, int16_t w, int16_t h) {
+    DisplayRect full = {0, 0, w, h};
+    return st7789_push_canvas_rects_async(buffer, w, 0, &full, 1);
+}
+
+bool st7789_push_canvas_rects_async(const uint8_t* buffer, int16_t stride, int16_t origin_y, const DisplayRect* rects, uint8_t count) {
+    if (frame_in_flight) return false;
+    if (count > ST7789_MAX_RECTS) count = ST7789_MAX_RECTS;
+    for (uint8_t i = 0; i < count; i++) {
+        st7789_emulator_check(rects[i]);
+    }
+
+    job_buffer = buffer;
+    job_source = nullptr;
+    job_stride = stride;
+    job_origin_y = origin_y;
+    memcpy(job_rects, rects, count * sizeof(DisplayRect));
+    job_rect_count = count;
+    frame_in_flight = true;
+    return true;
+}
+
+bool st7789_push_pixels_async(const DisplayRect& rect, st7789_pixel_source_t source, void* ctx) {
+    if (frame_in_flight) return false;
+    st7789_emulator_check(rect);
+
+    job_buffer = nullptr;
+    job_source = source;
+    job_source_ctx = ctx;
+    job_rects[0] = rect;
+    job_rect_count = 1;
+    frame_in_flight = true;
+    return true;
+}
+
+bool st7789_frame_in_flight() {
+    return frame_in_flight;
+}
+
+void st7789_wait_for_frame() {
+    st7789_emulator_complete();
+}
+
+void st7789_set_frame_done_callback(st7789_frame_done_cb_t cb) {
+    frame_done_cb = cb;
+}
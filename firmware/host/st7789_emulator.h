@@ -0,0 +1,17 @@
+#ifndef ST7789_EMULATOR_H
+#define ST7789_EMULATOR_H
+
+#include "st7789_dma_driver.h"
+
+// The panel behind the host build of st7789_dma_driver.h, a 320x240 RGB565
+// frame in RAM. Like the DMA push task, a queued push only reads its buffer
+// later: the pixels are copied when the caller waits for the frame (or
+// queues the next one), so a buffer reused too early shows up on the panel.
+#define ST7789_EMULATOR_WIDTH  320
+#define ST7789_EMULATOR_HEIGHT 240
+
+const uint16_t* st7789_emulator_panel();
+// Pixels written since start, to see what damage tracking sends
+uint32_t st7789_emulator_pixels_pushed();
+
+#endif // ST7789_EMULATOR_H
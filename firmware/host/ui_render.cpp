@@ -0,0 +1,322 @@
+// Renders every UI state of the sketch on the PC and writes each panel to a
+// PNG, so layouts can be checked without a device. The sketch is built as
+// is, against the shims in host/shim and the emulated panel; the modules
+// that need the radio, ADC or flash are replaced by the fixtures in
+// firmware_stubs.cpp.
+//
+// For every state it reports the draw calls of one frame and summed over
+// the band passes, the pixels damage tracking sent, and the time to draw and
+// push a full redraw (the average of RENDER_RUNS, on this machine, so only
+// comparable between runs here). It also checks that:
+//   - no drawing call lands entirely off the screen (a layout bug),
+//   - what damage tracking sent matches a full redraw of the same state,
+//   - the glyph atlas draws text exactly like Adafruit_GFX::drawChar(), on
+//     every screen and for all 256 character codes (the ones outside the
+//     atlas going through its drawChar() fallback),
+//   - a scrollable list drawn band by band, skipping the rows outside each
+//     band, comes out exactly like the same list drawn in one full-frame
+//     pass, for every selection while scrolling down and back up.
+//
+// Usage: ui_render [output directory]. Exits non-zero if a check fails.
+#include "src.ino"
+#include "png_writer.h"
+#include "firmware_stubs.h"
+#include "st7789_emulator.h"
+#include <sys/stat.h>
+#include <chrono>
+#include <vector>
+
+#define PANEL_PIXELS (ST7789_EMULATOR_WIDTH * ST7789_EMULATOR_HEIGHT)
+#define RENDER_RUNS 50
+
+static const char* output_dir = ".";
+static int screen_number = 0;
+static int failures = 0;
+
+static std::vector<uint16_t> panel_copy() {
+  const uint16_t* panel = st7789_emulator_panel();
+  return std::vector<uint16_t>(panel, panel + PANEL_PIXELS);
+}
+
+// Pixels that differ, and the first of them for the report
+static int panel_diff(const std::vector<uint16_t>& a, const std::vector<uint16_t>& b, int& first) {
+  int count = 0;
+  first = -1;
+  for (int i = 0; i < PANEL_PIXELS; i++) {
+    if (a[i] != b[i]) {
+      if (first < 0) first = i;
+      count++;
+    }
+  }
+  return count;
+}
+
+static void check_same(const char* name, const char* what, const std::vector<uint16_t>& expected) {
+  int first;
+  int count = panel_diff(expected, panel_copy(), first);
+  if (count > 0) {
+    printf("FAIL %s: %s differs in %d pixels, first at %d,%d\n", name, what, count,
+           first % ST7789_EMULATOR_WIDTH, first / ST7789_EMULATOR_WIDTH);
+    failures++;
+  }
+}
+
+static void write_png(const char* name) {
+  char path[512];
+  snprintf(path, sizeof(path), "%s/%02d_%s.png", output_dir, screen_number++, name);
+  if (!png_write_rgb565(path, st7789_emulator_panel(), ST7789_EMULATOR_WIDTH, ST7789_EMULATOR_HEIGHT)) {
+    printf("FAIL %s: can't write %s\n", name, path);
+    failures++;
+  }
+}
+
+// Average microseconds to draw and push a full redraw of the current state
+static double full_redraw_us() {
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < RENDER_RUNS; i++) {
+    canvas.invalidate();
+    renderScreen(drawCurrentState);
+    st7789_wait_for_frame();
+  }
+  std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+  return elapsed.count() / RENDER_RUNS;
+}
+
+// Draws the current state as the loop would, on top of whatever the panel
+// showed before, then checks it against full redraws
+static void capture(const char* name) {
+  uint32_t pushedBefore = st7789_emulator_pixels_pushed();
+  canvas.resetDrawStats();
+  renderScreen(drawCurrentState);
+  st7789_wait_for_frame();
+  uint32_t drawCalls = canvas.drawCalls();
+  uint32_t frameDrawCalls = canvas.frameDrawCalls();
+  uint32_t offscreen = canvas.offscreenDraws();
+  uint32_t pushed = st7789_emulator_pixels_pushed() - pushedBefore;
+  std::vector<uint16_t> incremental = panel_copy();
+  write_png(name);
+
+  printf("%-20s %4u draw calls/frame (%5u over %d bands), %3u off-screen, %6u pixels sent, %7.1f us/redraw\n",
+         name, (unsigned)frameDrawCalls, (unsigned)drawCalls, SCREEN_HEIGHT / canvas.bandHeight(),
+         (unsigned)offscreen, (unsigned)pushed, full_redraw_us());
+  if (offscreen > 0) {
+    printf("FAIL %s: %u draws fall entirely off the screen\n", name, (unsigned)offscreen);
+    failures++;
+  }
+
+  canvas.invalidate();
+  renderScreen(drawCurrentState);
+  st7789_wait_for_frame();
+  check_same(name, "incremental frame", incremental);
+
+  canvas.useGlyphAtlas(false);
+  canvas.invalidate();
+  renderScreen(drawCurrentState);
+  st7789_wait_for_frame();
+  canvas.useGlyphAtlas(true);
+  check_same(name, "drawChar() text", incremental);
+}
+
+// Draws `list` on a canvas that holds the whole screen, in one pass
+static std::vector<uint8_t> list_full_frame(ScrollableList& list) {
+  CustomCanvas full(SCREEN_WIDTH, SCREEN_HEIGHT, SCREEN_HEIGHT);
+  full.beginBand(0);
+  drawScrollableList(full, list, true);
+  return std::vector<uint8_t>(full.getBuffer(), full.getBuffer() + SCREEN_WIDTH * SCREEN_HEIGHT);
+}
+
+// Draws `list` one band at a time, as display_render() replays it, and
+// stitches the bands together
+static std::vector<uint8_t> list_banded(ScrollableList& list) {
+  CustomCanvas banded(SCREEN_WIDTH, SCREEN_HEIGHT, DISPLAY_BAND_HEIGHT);
+  std::vector<uint8_t> frame(SCREEN_WIDTH * SCREEN_HEIGHT);
+  for (int16_t y = 0; y < SCREEN_HEIGHT; y += banded.bandHeight()) {
+    banded.beginBand(y);
+    drawScrollableList(banded, list, true);
+    int16_t rows = min(banded.bandHeight(), (int16_t)(SCREEN_HEIGHT - y));
+    memcpy(&frame[y * SCREEN_WIDTH], banded.getBuffer(), (size_t)rows * SCREEN_WIDTH);
+  }
+  return frame;
+}
+
+// Scrolls a list down to its last row and back up, one detent at a time,
+// and compares the banded and full-frame drawings at every step. Item rows
+// are 12, 20 and 28 pixels high at text sizes 1 to 3, so they straddle the
+// band edges at different offsets as the list scrolls.
+static void check_list_bands() {
+  static const char* items[] = {"Zone 1", "Zone 2", "Zone 3", "Zone 4", "Zone 5", "Zone 6",
+                                "Zone 7", "Zone 8", "Zone 9", "Zone 10", "Zone 11", "Zone 12",
+                                "Zone 13", "Zone 14", "Zone 15", "Zone 16", "Zone 17", "Zone 18"};
+  const int count = sizeof(items) / sizeof(items[0]);
+  int steps = 0;
+  for (int size = 1; size <= 3; size++) {
+    int selected = 0;
+    ScrollableList list = {};
+    list.items = items;
+    list.num_items = count;
+    list.selected_index_ptr = &selected;
+    list.x = 0;
+    list.y = HEADER_HEIGHT;
+    list.width = SCREEN_WIDTH;
+    list.height = SCREEN_HEIGHT - HEADER_HEIGHT;
+    list.item_text_size = size;
+    list.title = "List";
+    list.title_text_size = 2;
+    list.show_back_button = true;
+    setupScrollableListMetrics(list, canvas);
+
+    for (int step = 0; step < 2 * count + 1; step++) {
+      handleScrollableListInput(list, step <= count ? (step ? 1 : 0) : -1);
+      // Both drawings must start from the same scroll position
+      int top = list.top_visible_index;
+      std::vector<uint8_t> expected = list_full_frame(list);
+      list.top_visible_index = top;
+      std::vector<uint8_t> actual = list_banded(list);
+      steps++;
+      for (int i = 0; i < SCREEN_WIDTH * SCREEN_HEIGHT; i++) {
+        if (actual[i] != expected[i]) {
+          printf("FAIL list bands: size %d, selection %d, top %d: first difference at %d,%d\n", size,
+                 selected, top, i % SCREEN_WIDTH, i / SCREEN_WIDTH);
+          failures++;
+          break;
+        }
+      }
+    }
+  }
+  printf("list bands: %d scroll steps compared with full-frame drawings\n", steps);
+}
+
+// Every character code at text sizes 1 and 2, opaque and transparent, with
+// and without the glyph atlas, on a canvas that holds the whole screen
+static std::vector<uint8_t> glyph_sheet(bool atlas) {
+  CustomCanvas sheet(SCREEN_WIDTH, SCREEN_HEIGHT, SCREEN_HEIGHT);
+  sheet.beginBand(0);
+  sheet.useGlyphAtlas(atlas);
+  sheet.fillScreen(COLOR_BACKGROUND);
+  sheet.setTextWrap(false);
+  for (int size = 1; size <= 2; size++) {
+    for (int c = 0; c < 256; c++) {
+      int cell = (size - 1) * 256 + c;
+      sheet.setTextSize(size);
+      if (c % 2) {
+        sheet.setTextColor(COLOR_TEXT_PRIMARY, COLOR_ACCENT_SECONDARY);
+      } else {
+        sheet.setTextColor(COLOR_TEXT_PRIMARY);
+      }
+      sheet.setCursor((cell % 26) * 12, (cell / 26) * 12);
+      sheet.write((uint8_t)c);
+    }
+  }
+  return std::vector<uint8_t>(sheet.getBuffer(), sheet.getBuffer() + SCREEN_WIDTH * SCREEN_HEIGHT);
+}
+
+static void check_glyphs() {
+  std::vector<uint8_t> expected = glyph_sheet(false);
+  std::vector<uint8_t> actual = glyph_sheet(true);
+  for (int i = 0; i < SCREEN_WIDTH * SCREEN_HEIGHT; i++) {
+    if (actual[i] != expected[i]) {
+      printf("FAIL glyphs: atlas differs from drawChar() at %d,%d\n", i % SCREEN_WIDTH, i / SCREEN_WIDTH);
+      failures++;
+      return;
+    }
+  }
+  printf("glyphs: 256 character codes drawn alike with and without the atlas\n");
+}
+
+// One detent at a time, as the loop sees a knob being turned
+static void turn(int detents) {
+  for (int i = 0; i < detents; i++) {
+    encoderValue++;
+    encoderMoved = true;
+    handleEncoderMovement();
+  }
+}
+
+// Trips the pump protection the way the sampler would: a minute of
+// 30 A once the inrush allowance is over
+static void trip_pump() {
+  CurrentStatsAccumulator frame;
+  current_stats_reset(frame);
+  int32_t sample = current_sensor_stats_units(30.0f);
+  for (int i = 0; i < 50; i++) current_stats_add(frame, sample);
+  host_advance_ms(PUMP_PROTECTION_INRUSH_MS);
+  pump_protection_frame(frame, millis());
+  pump_protection_frame(frame, millis());
+  host_advance_ms(60000);
+}
+
+int main(int argc, char** argv) {
+  if (argc > 1) {
+    output_dir = argv[1];
+    mkdir(output_dir, 0755);
+  }
+
+  setup();
+  write_png("splash");
+
+  capture("main_menu");
+  turn(2);
+  capture("main_menu_test");
+
+  navigateTo(STATE_MANUAL_RUN);
+  capture("manual_run");
+  turn(6);
+  capture("manual_run_scrolled");
+  selectingDuration = true;
+  capture("manual_duration");
+  selectingDuration = false;
+
+  navigateTo(STATE_CYCLES_MENU);
+  capture("cycles");
+  navigateTo(STATE_CYCLE_A_MENU);
+  capture("cycle_a_menu");
+  navigateTo(STATE_PROG_A);
+  capture("cycle_a_config");
+  turn(11);
+  turn(3);
+  capture("cycle_a_zones");
+
+  navigateTo(STATE_SETTINGS);
+  capture("settings");
+  navigateTo(STATE_SET_SYSTEM_TIME);
+  capture("set_time");
+  navigateTo(STATE_WIFI_SETUP_LAUNCHER);
+  capture("wifi_setup");
+  navigateTo(STATE_SYSTEM_INFO);
+  capture("system_info");
+
+  // Entering these would reset WiFi or reboot; they are drawn in place
+  currentState = STATE_WIFI_RESET;
+  capture("wifi_reset");
+  currentState = STATE_RESTART_DEVICE;
+  capture("restart");
+
+  selectedManualDuration = 10;
+  startManualZone(3);
+  host_advance_ms(95000);
+  capture("running_zone");
+
+  startCycleRun(0, OP_MANUAL_CYCLE);
+  updateCycleRun();
+  host_advance_ms(42000);
+  capture("cycle_running");
+  inInterZoneDelay = true;
+  cycleInterZoneDelayStartTime = millis();
+  capture("cycle_delay");
+  stopAllActivity();
+
+  navigateTo(STATE_TEST_MODE);
+  host_advance_ms(3000);
+  capture("test_mode");
+
+  trip_pump();
+  stopTestMode();
+  navigateTo(STATE_PUMP_TRIPPED);
+  capture("pump_tripped");
+
+  check_list_bands();
+  check_glyphs();
+
+  printf("%d screens written to %s, %d failures\n", screen_number, output_dir, failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,424 @@
+#include "CustomCanvas.h"
+#include "glyph_atlas.h"
+#include "image_decoder.h"
+
+// Colour cube levels per channel; 6 * 8 * 5 = 240 slots after the theme
+#define CUBE_R 6
+#define CUBE_G 8
+#define CUBE_B 5
+
+static_assert(PALETTE_THEME_COLORS <= PALETTE_THEME_SLOTS, "Too many theme colours");
+static_assert(PALETTE_THEME_SLOTS + CUBE_R * CUBE_G * CUBE_B <= PALETTE_SIZE, "Colour cube does not fit");
+
+// The compiled-in theme, in PaletteSlot order
+static const uint16_t theme_colors[PALETTE_THEME_COLORS] = {
+    COLOR_BACKGROUND,
+#ifdef COLOR_SECONDARY_BACKGROUND
+    COLOR_SECONDARY_BACKGROUND,
+#else
+    COLOR_BACKGROUND,
+#endif
+    COLOR_TEXT_PRIMARY,
+    COLOR_TEXT_SECONDARY,
+    COLOR_ACCENT_PRIMARY,
+    COLOR_ACCENT_SECONDARY,
+    COLOR_SUCCESS,
+    COLOR_WARNING,
+    COLOR_ERROR,
+    COLOR_RGB565_WHITE,
+    COLOR_RGB565_BLACK,
+};
+
+CustomCanvas::CustomCanvas(uint16_t w, uint16_t h, uint16_t bandHeight)
+    : GFXcanvas8(w, bandHeight), _textSize(1), _bandY(0), _glyphAtlas(true),
+      _layerState(LAYER_UNUSED), _layerOnPanel(false), _layerKey(0), _layerY(0), _layerH(0),
+      _lastColor(theme_colors[0]), _lastIndex(0), _suspendTracking(0),
+      _drawCalls(0), _frameDrawCalls(0), _offscreenDraws(0) {
+    // Drawing and text wrapping work in screen coordinates; only the buffer
+    // is band sized.
+    _height = h;
+
+    _bandBuffers[0] = buffer;
+    _bandBuffers[1] = nullptr;
+    if (bandHeight < h) {
+        _bandBuffers[1] = (uint8_t*)malloc((size_t)w * bandHeight);
+        if (_bandBuffers[1]) memset(_bandBuffers[1], 0, (size_t)w * bandHeight);
+    }
+
+    glyph_atlas_init();
+
+    // Nothing is known about the panel yet: send every tile first time round
+    memset(_touched, 0, sizeof(_touched));
+    memset(_content, 0xFF, sizeof(_content));
+    memset(_forced, 0xFF, sizeof(_forced));
+    memset(_tileHash, 0, sizeof(_tileHash));
+}
+
+CustomCanvas::~CustomCanvas() {
+    // The base class frees the buffer it allocated
+    buffer = _bandBuffers[0];
+    free(_bandBuffers[1]);
+}
+
+bool CustomCanvas::swapBandBuffer() {
+    if (!_bandBuffers[1]) return false;
+    buffer = (buffer == _bandBuffers[0]) ? _bandBuffers[1] : _bandBuffers[0];
+    return true;
+}
+
+void CustomCanvas::buildPalette(uint16_t* palette, const uint16_t* themeColors) {
+    if (!themeColors) themeColors = theme_colors;
+    for (int i = 0; i < PALETTE_SIZE; i++) {
+        palette[i] = COLOR_RGB565_BLACK;
+    }
+    for (int i = 0; i < PALETTE_THEME_COLORS; i++) {
+        palette[i] = themeColors[i];
+    }
+    int i = PALETTE_THEME_SLOTS;
+    for (int r = 0; r < CUBE_R; r++) {
+        for (int g = 0; g < CUBE_G; g++) {
+            for (int b = 0; b < CUBE_B; b++) {
+                palette[i++] = ((r * 31 / (CUBE_R - 1)) << 11) | ((g * 63 / (CUBE_G - 1)) << 5) | (b * 31 / (CUBE_B - 1));
+            }
+        }
+    }
+}
+
+bool CustomCanvas::reuseLayer(int16_t y, int16_t h, uint32_t key) {
+    if (_layerState == LAYER_UNUSED) {
+        bool same = _layerOnPanel && key == _layerKey && y == _layerY && h == _layerH;
+        _layerState = same ? LAYER_RETAINED : LAYER_DRAWN;
+        _layerKey = key;
+        _layerY = y;
+        _layerH = h;
+    }
+    return _layerState == LAYER_RETAINED;
+}
+
+// Theme colours map to their own slot; anything else to the nearest cube entry
+uint8_t CustomCanvas::colorIndex(uint16_t color) {
+    if (color == _lastColor) return _lastIndex;
+
+    uint8_t index = 0;
+    bool found = false;
+    for (uint8_t i = 0; i < PALETTE_THEME_COLORS; i++) {
+        if (theme_colors[i] == color) {
+            index = i;
+            found = true;
+            break;
+        }
+    }
+    if (!found) {
+        uint8_t r = ((color >> 11) * (CUBE_R - 1) + 15) / 31;
+        uint8_t g = (((color >> 5) & 0x3F) * (CUBE_G - 1) + 31) / 63;
+        uint8_t b = ((color & 0x1F) * (CUBE_B - 1) + 15) / 31;
+        index = PALETTE_THEME_SLOTS + (r * CUBE_G + g) * CUBE_B + b;
+    }
+
+    _lastColor = color;
+    _lastIndex = index;
+    return index;
+}
+
+void CustomCanvas::markDamage(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (_suspendTracking) return;
+
+    _drawCalls++;
+    if (x >= SCREEN_WIDTH || y >= SCREEN_HEIGHT || x + w <= 0 || y + h <= 0) {
+        if (_bandY == 0) _frameDrawCalls++;
+        _offscreenDraws++;
+        return;
+    }
+    int16_t top = y < 0 ? 0 : y;
+    if (top >= _bandY && top < _bandY + HEIGHT) _frameDrawCalls++;
+
+    // Clip to the screen and the current band
+    if (x < 0) { w += x; x = 0; }
+    if (y < _bandY) { h -= _bandY - y; y = _bandY; }
+    if (x + w > SCREEN_WIDTH) w = SCREEN_WIDTH - x;
+    if (y + h > _bandY + HEIGHT) h = _bandY + HEIGHT - y;
+    if (y + h > SCREEN_HEIGHT) h = SCREEN_HEIGHT - y;
+    if (w <= 0 || h <= 0) return;
+
+    uint8_t c0 = x / DAMAGE_TILE_W;
+    uint8_t c1 = (x + w - 1) / DAMAGE_TILE_W;
+    uint8_t mask = (uint8_t)(((1u << (c1 + 1)) - 1) & ~((1u << c0) - 1));
+    uint8_t r0 = y / DAMAGE_TILE_H;
+    uint8_t r1 = (y + h - 1) / DAMAGE_TILE_H;
+
+    if (color == COLOR_BACKGROUND) {
+        for (uint8_t r = r0; r <= r1; r++) {
+            _touched[r] |= _content[r] & mask;
+        }
+    } else {
+        for (uint8_t r = r0; r <= r1; r++) {
+            _touched[r] |= mask;
+            _content[r] |= mask;
+        }
+    }
+}
+
+// Every pixel write ends up here, with x/y/w/h in screen coordinates
+void CustomCanvas::fillBandRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (x < 0) { w += x; x = 0; }
+    if (y < _bandY) { h -= _bandY - y; y = _bandY; }
+    if (x + w > WIDTH) w = WIDTH - x;
+    if (y + h > _bandY + HEIGHT) h = _bandY + HEIGHT - y;
+    if (w <= 0 || h <= 0) return;
+
+    uint8_t index = colorIndex(color);
+    uint8_t* row = buffer + (size_t)(y - _bandY) * WIDTH + x;
+    for (int16_t j = 0; j < h; j++, row += WIDTH) {
+        memset(row, index, w);
+    }
+}
+
+void CustomCanvas::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (x < 0 || x >= WIDTH || y < _bandY || y >= _bandY + HEIGHT) return;
+    if (!_suspendTracking && y < SCREEN_HEIGHT) {
+        uint8_t r = y / DAMAGE_TILE_H;
+        uint8_t bit = 1 << (x / DAMAGE_TILE_W);
+        if (color != COLOR_BACKGROUND) {
+            _touched[r] |= bit;
+            _content[r] |= bit;
+        } else {
+            _touched[r] |= _content[r] & bit;
+        }
+    }
+    buffer[(size_t)(y - _bandY) * WIDTH + x] = colorIndex(color);
+}
+
+void CustomCanvas::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    markDamage(x, y, w, 1, color);
+    fillBandRect(x, y, w, 1, color);
+}
+
+void CustomCanvas::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    markDamage(x, y, 1, h, color);
+    fillBandRect(x, y, 1, h, color);
+}
+
+void CustomCanvas::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    markDamage(x, y, w, h, color);
+    fillBandRect(x, y, w, h, color);
+}
+
+void CustomCanvas::fillScreen(uint16_t color) {
+    uint8_t r0 = _bandY / DAMAGE_TILE_H;
+    uint8_t r1 = min(_bandY + HEIGHT, SCREEN_HEIGHT) / DAMAGE_TILE_H;
+    for (uint8_t r = r0; r < r1; r++) {
+        if (color == COLOR_BACKGROUND) {
+            _touched[r] |= _content[r];
+            _content[r] = 0;
+        } else {
+            _touched[r] = 0xFF;
+            _content[r] = 0xFF;
+        }
+    }
+    memset(buffer, colorIndex(color), (size_t)WIDTH * HEIGHT);
+}
+
+// Draws one classic-font cell like Adafruit_GFX::drawChar(), but a row at a
+// time as runs from the glyph atlas, each scaled run being a single memset.
+void CustomCanvas::drawGlyph(int16_t x, int16_t y, uint8_t c, uint16_t color, uint16_t bg, uint8_t sx, uint8_t sy) {
+    int16_t cw = GLYPH_CELL_W * sx;
+    int16_t ch = GLYPH_ROWS * sy;
+    bool opaque = (bg != color);
+
+    // Before the clip, so off-screen glyphs are counted the same way as on
+    // the drawChar() path
+    markDamage(x, y, cw, ch, color);
+    if (opaque) {
+        markDamage(x, y, cw, ch, bg);
+    }
+    if (x >= _width || y >= _height || x + cw <= 0 || y + ch <= 0) return;
+
+    // Only the rows inside the current band
+    int16_t top = max((int)y, (int)_bandY);
+    int16_t bottom = min(y + ch, _bandY + HEIGHT);
+    if (top >= bottom) return;
+
+    const uint8_t* rows = glyph_atlas_rows(!_cp437 && c >= 176 ? c + 1 : c); // Same quirk as drawChar()
+    if (!rows) {
+        _suspendTracking++;
+        Adafruit_GFX::drawChar(x, y, c, color, bg, sx, sy);
+        _suspendTracking--;
+        return;
+    }
+    uint8_t fg_index = colorIndex(color);
+    uint8_t bg_index = opaque ? colorIndex(bg) : 0;
+
+    // Clip columns once; runs are clipped against [x0, x1)
+    int16_t x0 = max(0, (int)x);
+    int16_t x1 = min(x + cw, (int)WIDTH);
+
+    for (int16_t py = top; py < bottom; py++) {
+        uint8_t* line = buffer + (size_t)(py - _bandY) * WIDTH;
+        if (opaque) {
+            memset(line + x0, bg_index, x1 - x0);
+        }
+        const GlyphRuns& runs = glyph_atlas_runs(rows[(py - y) / sy]);
+        for (uint8_t i = 0; i < runs.count; i++) {
+            int16_t rx0 = max(x + runs.start[i] * sx, (int)x0);
+            int16_t rx1 = min(x + (runs.start[i] + runs.len[i]) * sx, (int)x1);
+            if (rx0 < rx1) {
+                memset(line + rx0, fg_index, rx1 - rx0);
+            }
+        }
+    }
+}
+
+size_t CustomCanvas::write(uint8_t c) {
+    if (!_glyphAtlas || gfxFont) {
+        _suspendTracking++;
+        size_t n = GFXcanvas8::write(c);
+        _suspendTracking--;
+
+        // The classic font advances the cursor by one 6x8 cell per glyph, so
+        // the cell just drawn ends at the new cursor position.
+        if (c != '\n' && c != '\r') {
+            int16_t cw = GLYPH_CELL_W * textsize_x;
+            markDamage(cursor_x - cw, cursor_y, cw, GLYPH_ROWS * textsize_y, textcolor);
+            if (textbgcolor != textcolor) {
+                markDamage(cursor_x - cw, cursor_y, cw, GLYPH_ROWS * textsize_y, textbgcolor);
+            }
+        }
+        return n;
+    }
+
+    // Cursor handling as in Adafruit_GFX::write() for the classic font
+    if (c == '\n') {
+        cursor_x = 0;
+        cursor_y += textsize_y * GLYPH_ROWS;
+    } else if (c != '\r') {
+        if (wrap && (cursor_x + textsize_x * GLYPH_CELL_W > _width)) {
+            cursor_x = 0;
+            cursor_y += textsize_y * GLYPH_ROWS;
+        }
+        drawGlyph(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x, textsize_y);
+        cursor_x += textsize_x * GLYPH_CELL_W;
+    }
+    return 1;
+}
+
+void CustomCanvas::drawRGBBitmap(int16_t x, int16_t y, const uint16_t* bitmap, int16_t w, int16_t h) {
+    markDamage(x, y, w, h, (uint16_t)~COLOR_BACKGROUND);
+
+    int16_t j0 = max(0, _bandY - y);
+    int16_t j1 = min((int)h, _bandY + HEIGHT - y);
+    int16_t i0 = max(0, -x);
+    int16_t i1 = min((int)w, WIDTH - x);
+    if (i0 >= i1) return;
+    for (int16_t j = j0; j < j1; j++) {
+        uint8_t* dst = buffer + (size_t)(y + j - _bandY) * WIDTH + x;
+        const uint16_t* src = bitmap + (size_t)j * w;
+        for (int16_t i = i0; i < i1; i++) {
+            dst[i] = colorIndex(src[i]);
+        }
+    }
+}
+
+void CustomCanvas::drawImage(int16_t x, int16_t y, const uint8_t* image, int16_t w, int16_t h) {
+    markDamage(x, y, w, h, (uint16_t)~COLOR_BACKGROUND);
+
+    int16_t j0 = max(0, _bandY - y);
+    int16_t j1 = min((int)h, _bandY + HEIGHT - y);
+    if (j0 >= j1) return;
+
+    ImageDecoder dec;
+    image_decoder_begin(dec, image);
+    image_decoder_skip(dec, j0 * w);
+    for (int16_t j = j0; j < j1; j++) {
+        uint8_t* dst = buffer + (size_t)(y + j - _bandY) * WIDTH;
+        // Decode the row in pieces; columns off the canvas are dropped
+        for (int16_t i = 0; i < w; ) {
+            uint16_t pixels[32];
+            int16_t n = min(32, w - i);
+            image_decoder_read(dec, pixels, n);
+            for (int16_t k = 0; k < n; k++) {
+                int16_t px = x + i + k;
+                if (px >= 0 && px < WIDTH) dst[px] = colorIndex(pixels[k]);
+            }
+            i += n;
+        }
+    }
+}
+
+// FNV-1a over the tile, four pixels at a time
+uint32_t CustomCanvas::hashTile(uint8_t col, uint8_t row) const {
+    uint32_t h = 2166136261u;
+    const uint8_t* base = buffer + (size_t)(row * DAMAGE_TILE_H - _bandY) * WIDTH + col * DAMAGE_TILE_W;
+    for (int y = 0; y < DAMAGE_TILE_H; y++) {
+        const uint32_t* p = (const uint32_t*)(base + y * WIDTH);
+        for (int i = 0; i < DAMAGE_TILE_W / 4; i++) {
+            h = (h ^ p[i]) * 16777619u;
+        }
+    }
+    return h;
+}
+
+uint8_t CustomCanvas::collectDamage(DisplayRect* rects, uint8_t maxRects) {
+    if (maxRects == 0) return 0;
+
+    uint8_t r0 = _bandY / DAMAGE_TILE_H;
+    uint8_t r1 = min(_bandY + HEIGHT, SCREEN_HEIGHT) / DAMAGE_TILE_H;
+    uint8_t count = 0;
+    for (uint8_t r = r0; r < r1; r++) {
+        // Retained rows were not drawn this frame; the panel keeps what it
+        // has. They may hold anything once the layer goes, so count them as
+        // content for the next background fill.
+        if (_layerState == LAYER_RETAINED && !_forced[r] &&
+            r >= _layerY / DAMAGE_TILE_H && r < (_layerY + _layerH) / DAMAGE_TILE_H) {
+            _touched[r] = 0;
+            _content[r] = 0xFF;
+            continue;
+        }
+
+        uint8_t changed = _forced[r];
+        uint8_t check = _touched[r] | _forced[r];
+        for (uint8_t c = 0; c < DAMAGE_TILE_COLS; c++) {
+            if (!(check & (1 << c))) continue;
+            uint32_t h = hashTile(c, r);
+            if (h != _tileHash[r][c]) {
+                _tileHash[r][c] = h;
+                changed |= 1 << c;
+            }
+        }
+        _touched[r] = 0;
+        _forced[r] = 0;
+
+        // Each run of changed tiles in this row either extends a rect from
+        // the row above with the same span or starts a new one.
+        uint8_t c = 0;
+        while (c < DAMAGE_TILE_COLS) {
+            if (!(changed & (1 << c))) { c++; continue; }
+            uint8_t start = c;
+            while (c < DAMAGE_TILE_COLS && (changed & (1 << c))) c++;
+
+            DisplayRect run = {(int16_t)(start * DAMAGE_TILE_W), (int16_t)(r * DAMAGE_TILE_H),
+                               (int16_t)((c - start) * DAMAGE_TILE_W), DAMAGE_TILE_H};
+            bool merged = false;
+            for (uint8_t i = 0; i < count; i++) {
+                if (rects[i].x == run.x && rects[i].w == run.w && rects[i].y + rects[i].h == run.y) {
+                    rects[i].h += DAMAGE_TILE_H;
+                    merged = true;
+                    break;
+                }
+            }
+            if (merged) continue;
+
+            if (count < maxRects) {
+                rects[count++] = run;
+            } else {
+                // Out of slots: grow the last rect to cover this run too
+                DisplayRect& last = rects[count - 1];
+                int16_t x0 = min(last.x, run.x);
+                int16_t y0 = min(last.y, run.y);
+                int16_t x1 = max(last.x + last.w, run.x + run.w);
+                int16_t y1 = max(last.y + last.h, run.y + run.h);
+                last = {x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0)};
+            }
+        }
+    }
+    return count;
+}
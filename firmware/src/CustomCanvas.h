@@ -5,13 +5,59 @@
 
 #include <Adafruit_GFX.h>
 
-class CustomCanvas : public GFXcanvas16 {
+// Damage is tracked on a grid of tiles. A tile row fits in one byte
+// (SCREEN_WIDTH / DAMAGE_TILE_W must stay <= 8).
+#define DAMAGE_TILE_W    40
+#define DAMAGE_TILE_H    8
+#define DAMAGE_TILE_COLS (SCREEN_WIDTH / DAMAGE_TILE_W)
+#define DAMAGE_TILE_ROWS (SCREEN_HEIGHT / DAMAGE_TILE_H)
+#define MAX_DAMAGE_RECTS 12
+
+// Rows held in RAM at a time. Each screen is drawn once per band and only
+// the pixels inside the current band are kept, so the canvas costs two
+// SCREEN_WIDTH * DISPLAY_BAND_HEIGHT byte buffers instead of a full frame.
+// Set to SCREEN_HEIGHT to render whole frames in one pass.
+#ifndef DISPLAY_BAND_HEIGHT
+#define DISPLAY_BAND_HEIGHT 24
+#endif
+
+static_assert(DISPLAY_BAND_HEIGHT % DAMAGE_TILE_H == 0, "Bands must cover whole damage tiles");
+
+// The canvas stores one palette index per pixel. The first slots hold the
+// theme colours; the rest form a 6x8x5 colour cube that bitmaps are
+// quantised to.
+#define PALETTE_SIZE        256
+#define PALETTE_THEME_SLOTS 16
+
+// Theme colours in palette slot order. Another theme can be shown by
+// building a palette from its colours in this same order.
+enum PaletteSlot {
+    PALETTE_BACKGROUND,
+    PALETTE_SECONDARY_BACKGROUND,
+    PALETTE_TEXT_PRIMARY,
+    PALETTE_TEXT_SECONDARY,
+    PALETTE_ACCENT_PRIMARY,
+    PALETTE_ACCENT_SECONDARY,
+    PALETTE_SUCCESS,
+    PALETTE_WARNING,
+    PALETTE_ERROR,
+    PALETTE_WHITE,
+    PALETTE_BLACK,
+    PALETTE_THEME_COLORS
+};
+
+// A GFX canvas with a logical size of w x h backed by a buffer of only
+// w x bandHeight pixels. Coordinates passed in are always screen
+// coordinates; writes outside the current band are clipped. Colours are
+// given in RGB565 as usual and mapped to palette indices as they are drawn.
+class CustomCanvas : public GFXcanvas8 {
 public:
-    CustomCanvas(uint16_t w, uint16_t h) : GFXcanvas16(w, h), _textSize(1) {}
+    CustomCanvas(uint16_t w, uint16_t h, uint16_t bandHeight);
+    ~CustomCanvas();
 
     void setTextSize(uint8_t s) {
         _textSize = s;
-        GFXcanvas16::setTextSize(s);
+        GFXcanvas8::setTextSize(s);
     }
 
     void setRelativeCursor(int16_t dx, int16_t dy) {
@@ -25,8 +71,111 @@ public:
         const int16_t textPadding = 3;
         setCursor(LEFT_PADDING, currentY + textHeight + textPadding + y_padding);
     }
+
+    // Drawing primitives are wrapped so every write marks the tiles it covers
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    void fillScreen(uint16_t color) override;
+    using GFXcanvas8::write;
+    size_t write(uint8_t c) override;
+    void drawRGBBitmap(int16_t x, int16_t y, const uint16_t* bitmap, int16_t w, int16_t h);
+    // Compressed image from convert_image.py (see image_decoder.h). Decoding
+    // stops after the last row inside the current band.
+    void drawImage(int16_t x, int16_t y, const uint8_t* image, int16_t w, int16_t h);
+
+    // Moves the buffer to hold screen rows y .. y + bandHeight() - 1
+    void beginBand(int16_t y) { _bandY = y; }
+    // Band mode keeps two band buffers so one can be drawn while the other
+    // is streamed out. Switches drawing to the other one and returns false
+    // if there is only one (full-frame mode). Nothing is carried over; the
+    // next band is drawn from scratch as always.
+    bool swapBandBuffer();
+    int16_t bandY() const { return _bandY; }
+    int16_t bandHeight() const { return HEIGHT; }
+    // True if any of rows y .. y + h - 1 fall inside the current band, so
+    // callers can skip building parts of the screen this pass won't keep
+    bool bandIntersects(int16_t y, int16_t h) const { return y < _bandY + HEIGHT && y + h > _bandY; }
+
+    // Fills `rects` with the regions of the current band that differ from
+    // what was last collected and returns how many there are (0 if nothing
+    // changed). Tiles that were drawn to but hashed the same as before are
+    // dropped, so redrawing an unchanged screen sends nothing. The caller
+    // must push the returned regions: the stored hashes assume the panel now
+    // matches the canvas.
+    uint8_t collectDamage(DisplayRect* rects, uint8_t maxRects);
+
+    // Forces every tile to be sent on the next pass
+    void invalidate() {
+        memset(_forced, 0xFF, sizeof(_forced));
+        _layerOnPanel = false;
+    }
+
+    // Frame boundaries, called by the renderer around all band passes
+    void beginFrame() { _layerState = LAYER_UNUSED; }
+    void endFrame() { _layerOnPanel = (_layerState != LAYER_UNUSED); }
+
+    // Classic-font text goes through the glyph atlas span blitter; turning
+    // it off falls back to Adafruit_GFX::drawChar() (for benchmarking).
+    void useGlyphAtlas(bool enable) { _glyphAtlas = enable; }
+
+    // Drawing calls seen since resetDrawStats(), over all band passes, and
+    // how many of them fell entirely outside the screen (a layout bug).
+    // frameDrawCalls() counts each call only in the pass for the band that
+    // holds its top row (off-screen ones in the first band's), so it is what
+    // one full-frame pass would have made.
+    uint32_t drawCalls() const { return _drawCalls; }
+    uint32_t frameDrawCalls() const { return _frameDrawCalls; }
+    uint32_t offscreenDraws() const { return _offscreenDraws; }
+    void resetDrawStats() { _drawCalls = 0; _frameDrawCalls = 0; _offscreenDraws = 0; }
+
+    // Retained layer: a full-width strip of rows (tile aligned) whose look is
+    // fully described by `key`. Returns true if the panel already shows the
+    // strip for this key, in which case the caller should skip drawing it;
+    // those rows are then neither drawn nor pushed for the whole frame, so
+    // the panel itself acts as the layer cache. The first call in a frame
+    // decides for every band pass.
+    bool reuseLayer(int16_t y, int16_t h, uint32_t key);
+
+    // Fills `palette` (PALETTE_SIZE RGB565 entries) for the current theme,
+    // or for `themeColors` (PALETTE_THEME_COLORS entries in PaletteSlot
+    // order) to switch themes without changing what is drawn.
+    static void buildPalette(uint16_t* palette, const uint16_t* themeColors = nullptr);
+
 private:
+    uint8_t colorIndex(uint16_t color);
+    void markDamage(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    uint32_t hashTile(uint8_t col, uint8_t row) const;
+    void fillBandRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void drawGlyph(int16_t x, int16_t y, uint8_t c, uint16_t color, uint16_t bg, uint8_t sx, uint8_t sy);
+
     uint8_t _textSize;
+    int16_t _bandY;
+    uint8_t* _bandBuffers[2]; // [1] is null in full-frame mode
+    bool _glyphAtlas;
+
+    enum LayerState { LAYER_UNUSED, LAYER_DRAWN, LAYER_RETAINED };
+    LayerState _layerState;
+    bool _layerOnPanel; // The panel shows the layer for _layerKey
+    uint32_t _layerKey;
+    int16_t _layerY, _layerH;
+    uint16_t _lastColor; // Most recent colorIndex() lookup
+    uint8_t _lastIndex;
+
+    // _touched: tiles drawn to since the last collect.
+    // _content: tiles that may hold pixels other than COLOR_BACKGROUND.
+    // Background-coloured draws can only change tiles with content, which
+    // keeps fillScreen(COLOR_BACKGROUND) at the start of every frame cheap.
+    uint8_t _touched[DAMAGE_TILE_ROWS];
+    uint8_t _content[DAMAGE_TILE_ROWS];
+    // _forced: tiles sent on the next collect whatever their hash.
+    uint8_t _forced[DAMAGE_TILE_ROWS];
+    uint32_t _tileHash[DAMAGE_TILE_ROWS][DAMAGE_TILE_COLS];
+    uint8_t _suspendTracking; // >0 while a wrapper calls into the base class
+    uint32_t _drawCalls;
+    uint32_t _frameDrawCalls;
+    uint32_t _offscreenDraws;
 };
 
 #endif // CUSTOM_CANVAS_H
@@ -0,0 +1,262 @@
+#include "adc_sampler.h"
+#include "esp_adc/adc_continuous.h"
+#include "esp_adc/adc_cali.h"
+#include "esp_adc/adc_cali_scheme.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define ADC_SAMPLER_POOL_SIZE (ADC_SAMPLER_FRAME_SIZE * 4) // DMA ring buffer
+#define ADC_SAMPLER_TASK_PRIO 3
+#define ADC_SAMPLER_ATTEN     ADC_ATTEN_DB_11 // Same range as analogSetPinAttenuation(ADC_11db)
+// Current pin conversions per statistics window (the pins take turns)
+#define ADC_SAMPLER_STATS_WINDOW_SAMPLES (ADC_SAMPLER_RATE_HZ / 2 * ADC_SAMPLER_STATS_WINDOW_MS / 1000)
+
+static adc_continuous_handle_t adc_handle = nullptr;
+static adc_cali_handle_t cali_handle = nullptr;
+static TaskHandle_t sampler_task = nullptr;
+static adc_channel_t current_channel;
+static adc_channel_t battery_channel;
+
+// Filtered raw readings, 8 fractional bits. Only used by the sampler task.
+static int32_t current_filtered = -1;
+static int32_t battery_filtered = -1;
+static uint32_t frame_count = 0;
+
+// Per-sample raw to 1/16 mV conversion, a straight line fitted to the
+// calibration curve at start (calling the calibration for every sample
+// would cost more than the statistics themselves)
+static int32_t mv_slope_q16 = 0;
+static int32_t mv_offset_q16 = 0;
+static int32_t current_zero = 0; // 1/16 mV
+static CurrentStatsAccumulator current_acc;
+static CurrentStats current_stats;
+static uint32_t stats_windows = 0;
+
+// Registered from setup() while the task may already be running: a hook is
+// stored before the count that makes it visible
+static AdcFrameHook frame_hooks[ADC_SAMPLER_MAX_FRAME_HOOKS];
+static volatile uint8_t frame_hook_count = 0;
+static int16_t frame_current[ADC_SAMPLER_FRAME_SIZE / SOC_ADC_DIGI_RESULT_BYTES];
+
+// Latest-value slots. The writer fills the slot readers are not pointed at,
+// then bumps latest_seq to publish it. The slot a reader copies from is
+// rewritten as soon as the next publish has gone out, so a reader that is
+// still copying by then may have a torn reading; any change of the
+// sequence during the copy makes it copy again.
+static AdcReading latest[2];
+static volatile uint32_t latest_seq = 0;
+
+static void adc_sampler_publish(const AdcReading& reading) {
+    uint32_t seq = latest_seq + 1;
+    latest[seq & 1] = reading;
+    __atomic_store_n(&latest_seq, seq, __ATOMIC_RELEASE);
+}
+
+bool adc_sampler_latest(AdcReading& out) {
+    uint32_t before, after;
+    do {
+        before = __atomic_load_n(&latest_seq, __ATOMIC_ACQUIRE);
+        out = latest[before & 1];
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        after = __atomic_load_n(&latest_seq, __ATOMIC_RELAXED);
+    } while (after != before);
+    return before != 0;
+}
+
+bool adc_sampler_add_frame_hook(AdcFrameHook hook) {
+    uint8_t count = frame_hook_count;
+    if (count == ADC_SAMPLER_MAX_FRAME_HOOKS) return false;
+    frame_hooks[count] = hook;
+    __atomic_store_n(&frame_hook_count, count + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+static uint16_t adc_sampler_to_mv(int32_t filtered) {
+    int raw = filtered >> 8;
+    int mv = 0;
+    if (!cali_handle || adc_cali_raw_to_voltage(cali_handle, raw, &mv) != ESP_OK) {
+        // Uncalibrated: assume the nominal 0-3.1 V range at this attenuation
+        mv = raw * 3100 / ((1 << SOC_ADC_DIGI_MAX_BITWIDTH) - 1);
+    }
+    return (uint16_t)mv;
+}
+
+static void adc_sampler_fit_mv() {
+    const int max_raw = (1 << SOC_ADC_DIGI_MAX_BITWIDTH) - 1;
+    const int lo = max_raw / 10;
+    const int hi = max_raw * 9 / 10;
+    int lo_mv = 0, hi_mv = 0;
+    if (!cali_handle ||
+        adc_cali_raw_to_voltage(cali_handle, lo, &lo_mv) != ESP_OK ||
+        adc_cali_raw_to_voltage(cali_handle, hi, &hi_mv) != ESP_OK) {
+        lo_mv = lo * 3100 / max_raw;
+        hi_mv = hi * 3100 / max_raw;
+    }
+    mv_slope_q16 = ((hi_mv - lo_mv) << 16) / (hi - lo);
+    mv_offset_q16 = (lo_mv << 16) - lo * mv_slope_q16;
+}
+
+static inline int32_t adc_sampler_to_mv_q4(uint32_t raw) {
+    return ((int32_t)raw * mv_slope_q16 + mv_offset_q16) >> (16 - CURRENT_STATS_FRAC_BITS);
+}
+
+// Single-pole low-pass in fixed point; the first frame seeds the filter
+static void adc_sampler_filter(int32_t& filtered, uint32_t sum, uint32_t count) {
+    if (count == 0) return;
+    int32_t mean = (int32_t)((sum << 8) / count);
+    if (filtered < 0) {
+        filtered = mean;
+    } else {
+        filtered += (mean - filtered) >> ADC_SAMPLER_FILTER_SHIFT;
+    }
+}
+
+static void adc_sampler_process(const uint8_t* frame, uint32_t length) {
+    uint32_t current_sum = 0, current_count = 0;
+    uint32_t battery_sum = 0, battery_count = 0;
+    AdcFrame hook_frame;
+    hook_frame.current = frame_current;
+    hook_frame.count = 0;
+    current_stats_reset(hook_frame.stats);
+
+    for (uint32_t i = 0; i + SOC_ADC_DIGI_RESULT_BYTES <= length; i += SOC_ADC_DIGI_RESULT_BYTES) {
+        const adc_digi_output_data_t* p = (const adc_digi_output_data_t*)&frame[i];
+        uint32_t channel = p->type2.channel;
+        uint32_t data = p->type2.data;
+        if (channel == current_channel) {
+            current_sum += data;
+            current_count++;
+            int32_t sample = adc_sampler_to_mv_q4(data) - current_zero;
+            current_stats_add(current_acc, sample);
+            current_stats_add(hook_frame.stats, sample);
+            if (hook_frame.count < sizeof(frame_current) / sizeof(frame_current[0])) {
+                frame_current[hook_frame.count++] = (int16_t)constrain(sample, INT16_MIN, INT16_MAX);
+            }
+            if (current_acc.count == ADC_SAMPLER_STATS_WINDOW_SAMPLES) {
+                current_stats_finish(current_acc, current_stats);
+                current_stats_reset(current_acc);
+                stats_windows++;
+            }
+        } else if (channel == battery_channel) {
+            battery_sum += data;
+            battery_count++;
+        }
+    }
+
+    uint8_t hooks = __atomic_load_n(&frame_hook_count, __ATOMIC_ACQUIRE);
+    if (hooks > 0 && hook_frame.count > 0) {
+        hook_frame.timestamp = millis();
+        for (uint8_t h = 0; h < hooks; h++) {
+            frame_hooks[h](hook_frame);
+        }
+    }
+
+    adc_sampler_filter(current_filtered, current_sum, current_count);
+    adc_sampler_filter(battery_filtered, battery_sum, battery_count);
+    if (current_filtered < 0 || battery_filtered < 0) return;
+
+    AdcReading reading;
+    reading.currentMv = adc_sampler_to_mv(current_filtered);
+    reading.batteryMv = adc_sampler_to_mv(battery_filtered);
+    reading.timestamp = millis();
+    reading.frames = ++frame_count;
+    reading.currentStats = current_stats;
+    reading.statsWindows = stats_windows;
+    adc_sampler_publish(reading);
+}
+
+static bool IRAM_ATTR adc_sampler_conv_done(adc_continuous_handle_t handle, const adc_continuous_evt_data_t* edata, void* user_data) {
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(sampler_task, &woken);
+    return woken == pdTRUE;
+}
+
+static void adc_sampler_task(void* arg) {
+    static uint8_t frame[ADC_SAMPLER_FRAME_SIZE];
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        uint32_t length = 0;
+        while (adc_continuous_read(adc_handle, frame, sizeof(frame), &length, 0) == ESP_OK) {
+            adc_sampler_process(frame, length);
+        }
+    }
+}
+
+bool adc_sampler_start(uint16_t current_zero_mv) {
+    if (adc_handle) return true;
+
+    adc_unit_t unit;
+    if (adc_continuous_io_to_channel(ADC_SAMPLER_CURRENT_PIN, &unit, &current_channel) != ESP_OK ||
+        adc_continuous_io_to_channel(ADC_SAMPLER_BATTERY_PIN, &unit, &battery_channel) != ESP_OK) {
+        Serial.println("ADC: sampler pins are not ADC inputs");
+        return false;
+    }
+
+    adc_cali_curve_fitting_config_t cali_cfg = {};
+    cali_cfg.unit_id = unit;
+    cali_cfg.atten = ADC_SAMPLER_ATTEN;
+    cali_cfg.bitwidth = ADC_BITWIDTH_DEFAULT;
+    if (adc_cali_create_scheme_curve_fitting(&cali_cfg, &cali_handle) != ESP_OK) {
+        Serial.println("ADC: no calibration data, readings are approximate");
+        cali_handle = nullptr;
+    }
+    adc_sampler_fit_mv();
+    current_zero = (int32_t)current_zero_mv << CURRENT_STATS_FRAC_BITS;
+    current_stats_reset(current_acc);
+
+    adc_continuous_handle_cfg_t handle_cfg = {};
+    handle_cfg.max_store_buf_size = ADC_SAMPLER_POOL_SIZE;
+    handle_cfg.conv_frame_size = ADC_SAMPLER_FRAME_SIZE;
+    esp_err_t err = adc_continuous_new_handle(&handle_cfg, &adc_handle);
+    if (err != ESP_OK) {
+        Serial.printf("ADC: adc_continuous_new_handle failed (%s)\n", esp_err_to_name(err));
+        adc_handle = nullptr;
+        return false;
+    }
+
+    adc_digi_pattern_config_t pattern[2] = {};
+    pattern[0].atten = ADC_SAMPLER_ATTEN;
+    pattern[0].channel = current_channel;
+    pattern[0].unit = unit;
+    pattern[0].bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+    pattern[1] = pattern[0];
+    pattern[1].channel = battery_channel;
+
+    adc_continuous_config_t dig_cfg = {};
+    dig_cfg.pattern_num = 2;
+    dig_cfg.adc_pattern = pattern;
+    dig_cfg.sample_freq_hz = ADC_SAMPLER_RATE_HZ;
+    dig_cfg.conv_mode = ADC_CONV_SINGLE_UNIT_1;
+    dig_cfg.format = ADC_DIGI_OUTPUT_FORMAT_TYPE2;
+    err = adc_continuous_config(adc_handle, &dig_cfg);
+    if (err != ESP_OK) {
+        Serial.printf("ADC: adc_continuous_config failed (%s)\n", esp_err_to_name(err));
+        adc_continuous_deinit(adc_handle);
+        adc_handle = nullptr;
+        return false;
+    }
+
+    xTaskCreate(adc_sampler_task, "adc_sampler", 3072, nullptr, ADC_SAMPLER_TASK_PRIO, &sampler_task);
+    if (!sampler_task) {
+        Serial.println("ADC: failed to start sampler task");
+        adc_continuous_deinit(adc_handle);
+        adc_handle = nullptr;
+        return false;
+    }
+
+    adc_continuous_evt_cbs_t cbs = {};
+    cbs.on_conv_done = adc_sampler_conv_done;
+    err = adc_continuous_register_event_callbacks(adc_handle, &cbs, nullptr);
+    if (err == ESP_OK) {
+        err = adc_continuous_start(adc_handle);
+    }
+    if (err != ESP_OK) {
+        Serial.printf("ADC: failed to start conversions (%s)\n", esp_err_to_name(err));
+        vTaskDelete(sampler_task);
+        sampler_task = nullptr;
+        adc_continuous_deinit(adc_handle);
+        adc_handle = nullptr;
+        return false;
+    }
+    return true;
+}
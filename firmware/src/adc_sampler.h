@@ -0,0 +1,57 @@
+#ifndef ADC_SAMPLER_H
+#define ADC_SAMPLER_H
+
+#include <Arduino.h>
+#include "current_stats.h"
+
+// Background ADC acquisition. The continuous ADC driver samples the current
+// sensor and battery pins at a fixed rate into its DMA ring buffer; a task
+// drains it, filters each channel and publishes the latest values. Readers
+// never touch the ADC and never block.
+#define ADC_SAMPLER_CURRENT_PIN 1 // WCS1800 output
+#define ADC_SAMPLER_BATTERY_PIN 0 // Battery sense divider
+
+#define ADC_SAMPLER_RATE_HZ    10000 // Conversions per second, shared by both pins
+#define ADC_SAMPLER_FRAME_SIZE 400   // Bytes per DMA frame (100 conversions, 10 ms)
+// Weight of each new frame in the running average, as a shift: the
+// readings settle with a time constant of about 2^shift frames (80 ms)
+#define ADC_SAMPLER_FILTER_SHIFT 3
+// Current statistics window: 10 cycles of 50 Hz mains or 12 of 60 Hz
+#define ADC_SAMPLER_STATS_WINDOW_MS 200
+
+struct AdcReading {
+    uint16_t currentMv; // Filtered WCS1800 output
+    uint16_t batteryMv; // Filtered voltage at the battery sense pin
+    uint32_t timestamp; // millis() of the frame the values were updated from
+    uint32_t frames;    // Frames processed since start
+    CurrentStats currentStats; // Last completed statistics window of the current pin
+    uint32_t statsWindows;     // Windows completed since start; 0 until the first
+};
+
+// Starts sampling. The current statistics are taken around current_zero_mv,
+// the sensor output at zero current. Returns false (and logs why) if the ADC
+// could not be set up; adc_sampler_latest() then keeps returning false.
+bool adc_sampler_start(uint16_t current_zero_mv);
+
+#define ADC_SAMPLER_MAX_FRAME_HOOKS 4
+
+// The current pin samples of one DMA frame (10 ms), in 1/16 mV around the
+// zero point, oldest first
+struct AdcFrame {
+    const int16_t* current;
+    uint16_t count;
+    CurrentStatsAccumulator stats; // Of the same samples
+    uint32_t timestamp;            // millis() when the frame was processed
+};
+
+// Called from the sampler task for every frame. Must be short and must not
+// block: it runs ahead of everything but interrupts. Returns false if all
+// ADC_SAMPLER_MAX_FRAME_HOOKS are taken.
+typedef void (*AdcFrameHook)(const AdcFrame& frame);
+bool adc_sampler_add_frame_hook(AdcFrameHook hook);
+
+// Copies the most recent reading. Lock-free and safe from any task; returns
+// false until the first frame has been processed.
+bool adc_sampler_latest(AdcReading& out);
+
+#endif // ADC_SAMPLER_H
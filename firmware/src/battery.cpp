@@ -1,8 +1,9 @@
 #include <Arduino.h>
 #include "battery.h"
+#include "adc_sampler.h"
 
 // Battery voltage reading configuration
-const int BATTERY_PIN = 0; // Battery voltage sense pin
+const int BATTERY_PIN = ADC_SAMPLER_BATTERY_PIN; // Battery voltage sense pin
 
 // The following voltage range is for a standard 3.7V LiPo battery.
 // A fully charged LiPo is 4.2V (100%), and it is considered fully discharged at 3.0V (0%).
@@ -15,11 +16,17 @@ const float VOLTAGE_MAX = 4.2; // Maximum voltage for 100%
  * @return The raw voltage in Volts.
  */
 float read_battery_voltage() {
-  // Set attenuation for the ADC pin to allow reading up to 3.3V
-  analogSetPinAttenuation(BATTERY_PIN, ADC_11db);
-
-  // Read the raw voltage in millivolts
-  float millivolts = analogReadMilliVolts(BATTERY_PIN);
+  // The pin is sampled continuously alongside the current sensor; a one-shot
+  // read would fight the continuous driver for the ADC.
+  AdcReading reading;
+  float millivolts;
+  if (adc_sampler_latest(reading)) {
+    millivolts = reading.batteryMv;
+  } else {
+    // Set attenuation for the ADC pin to allow reading up to 3.3V
+    analogSetPinAttenuation(BATTERY_PIN, ADC_11db);
+    millivolts = analogReadMilliVolts(BATTERY_PIN);
+  }
 
   // Convert millivolts to volts withvoltage divder
   float voltage = millivolts / 1000.0 * 2;
@@ -0,0 +1,149 @@
+#include "burst_capture.h"
+#include "current_sensor.h"
+#include "ring_buffer.h"
+
+#define BURST_CAPTURE_DECIMATION  (ADC_SAMPLER_RATE_HZ / 2 / BURST_CAPTURE_RATE_HZ)
+#define BURST_CAPTURE_PRE_SAMPLES (BURST_CAPTURE_PRE_MS * BURST_CAPTURE_RATE_HZ / 1000)
+// Recent samples kept for the pre-trigger part: the pre window plus the
+// time a switch takes to reach the sampler task (about a frame)
+#define BURST_CAPTURE_RECENT      256
+
+static_assert(BURST_CAPTURE_RECENT >= BURST_CAPTURE_PRE_SAMPLES, "Recent samples must cover the pre-trigger window");
+static_assert(BURST_CAPTURE_SAMPLES <= UINT16_MAX, "Capture sample indices are 16 bit");
+
+struct PendingTrigger {
+    uint32_t ms;
+    uint8_t relay;
+    uint8_t on;
+};
+
+// Switches from the loop to the sampler task; one writer, one reader
+static PendingTrigger triggers[BURST_CAPTURE_MAX_EVENTS];
+static volatile uint32_t trigger_head = 0; // Written by the loop
+static volatile uint32_t trigger_tail = 0; // Written by the sampler task
+
+// Sampler task state
+static RingBuffer<int16_t, BURST_CAPTURE_RECENT> recent;
+static uint32_t sample_seq = 0; // Decimated samples since start
+static int32_t decimation_sum = 0;
+static uint8_t decimation_count = 0;
+static BurstCapture* capturing = nullptr;
+static uint32_t capture_first_seq = 0;
+
+// Capture `id` lives in slots[id % BURST_CAPTURE_SLOTS]. started_id is
+// bumped before a slot is reused and finished_id once it is complete, so a
+// reader can tell whether the copy it just made was overwritten meanwhile.
+static BurstCapture slots[BURST_CAPTURE_SLOTS];
+static volatile uint32_t started_id = 0;
+static volatile uint32_t finished_id = 0;
+
+static void burst_capture_hook(const AdcFrame& frame) {
+    burst_capture_frame(frame);
+}
+
+void burst_capture_init() {
+    adc_sampler_add_frame_hook(burst_capture_hook);
+}
+
+void burst_capture_trigger(uint8_t relay, bool on) {
+    uint32_t head = trigger_head;
+    if (head - __atomic_load_n(&trigger_tail, __ATOMIC_ACQUIRE) == BURST_CAPTURE_MAX_EVENTS) {
+        return; // The sampler is not running or is far behind
+    }
+    PendingTrigger& trigger = triggers[head % BURST_CAPTURE_MAX_EVENTS];
+    trigger.ms = millis();
+    trigger.relay = relay;
+    trigger.on = on;
+    __atomic_store_n(&trigger_head, head + 1, __ATOMIC_RELEASE);
+}
+
+uint32_t burst_capture_latest_id() {
+    return __atomic_load_n(&finished_id, __ATOMIC_ACQUIRE);
+}
+
+bool burst_capture_copy(uint32_t id, BurstCapture& out) {
+    uint32_t finished = burst_capture_latest_id();
+    if (id == 0) id = finished;
+    if (id == 0 || id > finished) return false;
+
+    out = slots[id % BURST_CAPTURE_SLOTS];
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    uint32_t started = __atomic_load_n(&started_id, __ATOMIC_RELAXED);
+    return started - id < BURST_CAPTURE_SLOTS;
+}
+
+// Starts a capture around the switch at sample `seq`, taking as much of the
+// pre-trigger window as the recent samples still hold
+static void start_capture(uint32_t seq, const PendingTrigger& trigger) {
+    uint32_t id = started_id + 1;
+    __atomic_store_n(&started_id, id, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    uint32_t oldest_seq = sample_seq - recent.size();
+    uint32_t first_seq = seq - oldest_seq > BURST_CAPTURE_PRE_SAMPLES ? seq - BURST_CAPTURE_PRE_SAMPLES : oldest_seq;
+
+    capturing = &slots[id % BURST_CAPTURE_SLOTS];
+    BurstCaptureHeader& header = capturing->header;
+    header.magic = BURST_CAPTURE_MAGIC;
+    header.rate_hz = BURST_CAPTURE_RATE_HZ;
+    header.count = 0;
+    header.pre_samples = seq - first_seq;
+    header.id = id;
+    header.trigger_ms = trigger.ms;
+    header.amps_per_unit = current_sensor_amps_per_stats_unit();
+    header.event_count = 0;
+    memset(header.reserved, 0, sizeof(header.reserved));
+
+    for (size_t i = first_seq - oldest_seq; i < recent.size(); i++) {
+        capturing->samples[header.count++] = recent[i];
+    }
+    capture_first_seq = first_seq;
+}
+
+static void add_event(uint32_t seq, const PendingTrigger& trigger) {
+    BurstCaptureHeader& header = capturing->header;
+    if (header.event_count == BURST_CAPTURE_MAX_EVENTS) return;
+    BurstCaptureEvent& event = header.events[header.event_count++];
+    event.index = seq - capture_first_seq;
+    event.relay = trigger.relay;
+    event.on = trigger.on;
+}
+
+void burst_capture_frame(const AdcFrame& frame) {
+    for (uint16_t i = 0; i < frame.count; i++) {
+        decimation_sum += frame.current[i];
+        if (++decimation_count < BURST_CAPTURE_DECIMATION) continue;
+
+        int16_t sample = (int16_t)(decimation_sum / BURST_CAPTURE_DECIMATION);
+        decimation_sum = 0;
+        decimation_count = 0;
+        recent.push(sample);
+        sample_seq++;
+
+        if (capturing) {
+            capturing->samples[capturing->header.count++] = sample;
+            if (capturing->header.count == BURST_CAPTURE_SAMPLES) {
+                __atomic_store_n(&finished_id, capturing->header.id, __ATOMIC_RELEASE);
+                capturing = nullptr;
+            }
+        }
+    }
+
+    uint32_t head = __atomic_load_n(&trigger_head, __ATOMIC_ACQUIRE);
+    uint32_t tail = trigger_tail;
+    for (; tail != head; tail++) {
+        const PendingTrigger& trigger = triggers[tail % BURST_CAPTURE_MAX_EVENTS];
+
+        // Place the switch by how long before this frame it happened
+        int32_t lag_ms = (int32_t)(frame.timestamp - trigger.ms);
+        uint32_t lag = lag_ms > 0 ? (uint32_t)lag_ms * BURST_CAPTURE_RATE_HZ / 1000 : 0;
+        if (lag > recent.size()) lag = recent.size();
+        uint32_t seq = sample_seq - lag;
+
+        if (!capturing) {
+            start_capture(seq, trigger);
+        }
+        add_event(seq, trigger);
+    }
+    __atomic_store_n(&trigger_tail, tail, __ATOMIC_RELEASE);
+}
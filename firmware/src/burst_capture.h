@@ -0,0 +1,68 @@
+#ifndef BURST_CAPTURE_H
+#define BURST_CAPTURE_H
+
+#include <Arduino.h>
+#include "adc_sampler.h"
+
+// High-rate captures of the pump current around relay switching, for the
+// inrush and settling that the change-of-value history smooths away. The
+// sampler task keeps the last few hundred milliseconds of current at
+// BURST_CAPTURE_RATE_HZ; a relay switch freezes those as the pre-trigger
+// part of a capture and the following BURST_CAPTURE_POST_MS are appended.
+// Switches during a capture are marked in it rather than starting another.
+#define BURST_CAPTURE_RATE_HZ    1000 // Means of 5 sampler conversions each
+#define BURST_CAPTURE_PRE_MS     200
+#define BURST_CAPTURE_POST_MS    2000
+#define BURST_CAPTURE_SLOTS      4    // Captures kept, oldest overwritten
+#define BURST_CAPTURE_MAX_EVENTS 8
+#define BURST_CAPTURE_MAGIC      0x4342 // "BC"
+
+#define BURST_CAPTURE_SAMPLES ((BURST_CAPTURE_PRE_MS + BURST_CAPTURE_POST_MS) * BURST_CAPTURE_RATE_HZ / 1000)
+
+struct BurstCaptureEvent {
+    uint16_t index; // Sample at which the relay switched
+    uint8_t relay;  // Relay index, 0 is the pump
+    uint8_t on;
+};
+
+// Sent as is by /api/capture (little endian), followed by `count` int16
+// samples in 1/16 mV; `amps_per_unit` scales them to Amperes
+struct BurstCaptureHeader {
+    uint16_t magic;
+    uint16_t rate_hz;
+    uint16_t count;       // Samples captured
+    uint16_t pre_samples; // Samples before the first event
+    uint32_t id;          // Captures since boot, from 1
+    uint32_t trigger_ms;  // millis() of the first event
+    float amps_per_unit;
+    uint8_t event_count;
+    uint8_t reserved[3];
+    BurstCaptureEvent events[BURST_CAPTURE_MAX_EVENTS];
+};
+
+static_assert(sizeof(BurstCaptureHeader) == 24 + 4 * BURST_CAPTURE_MAX_EVENTS, "BurstCaptureHeader must have no padding");
+
+struct BurstCapture {
+    BurstCaptureHeader header;
+    int16_t samples[BURST_CAPTURE_SAMPLES];
+};
+
+// Hooks the capture into the ADC sampler's frames
+void burst_capture_init();
+
+// Marks a relay switch. Called from the loop right at the switch; the
+// sampler task picks it up with its next frame.
+void burst_capture_trigger(uint8_t relay, bool on);
+
+// The newest finished capture, 0 if none yet
+uint32_t burst_capture_latest_id();
+
+// Copies finished capture `id`, or the newest one if `id` is 0. Returns
+// false if it was never taken or has been overwritten since.
+bool burst_capture_copy(uint32_t id, BurstCapture& out);
+
+// Feeds one sampler frame. Runs in the sampler task; exposed for
+// simulation with injected traces.
+void burst_capture_frame(const AdcFrame& frame);
+
+#endif // BURST_CAPTURE_H
@@ -4,6 +4,7 @@
 
 // Global instance of the system configuration
 SystemConfig systemConfig;
+uint32_t configRevision = 0;
 
 // Path to the configuration file
 const char* configFile = "/config.json";
@@ -62,6 +63,8 @@ bool loadConfig() {
         return false;
     }
 
+    configRevision = doc["revision"] | 0;
+
     // Deserialize zone names
     JsonArrayConst zoneNamesArray = doc["zoneNames"];
     for (int i = 0; i < ZONE_COUNT; i++) {
@@ -96,6 +99,10 @@ bool loadConfig() {
 }
 
 bool saveConfig() {
+    // Bumped even if the write fails: the configuration in memory has
+    // changed either way
+    markConfigChanged();
+
     File file = LittleFS.open(configFile, "w");
     if (!file) {
         Serial.println("Failed to open config file for writing");
@@ -103,6 +110,7 @@ bool saveConfig() {
     }
 
     StaticJsonDocument<2048> doc;
+    doc["revision"] = configRevision;
 
     // Serialize zone names
     JsonArray zoneNamesArray = doc.createNestedArray("zoneNames");
@@ -139,3 +147,7 @@ bool saveConfig() {
     file.close();
     return true;
 }
+
+void markConfigChanged() {
+    configRevision++;
+}
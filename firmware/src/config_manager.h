@@ -11,6 +11,12 @@ struct SystemConfig {
 
 extern SystemConfig systemConfig;
 
+// Bumped by every change to the configuration in memory, and by every
+// save, and stored with the configuration. With a per-boot epoch it is the
+// ETag of the config endpoints: changes that were never saved can repeat a
+// revision after a restart.
+extern uint32_t configRevision;
+
 // Function to initialize the configuration with default values
 void initializeDefaultConfig();
 
@@ -18,4 +24,8 @@ void initializeDefaultConfig();
 bool loadConfig();
 bool saveConfig();
 
+// Call after changing systemConfig in memory, so the config endpoints stop
+// matching cached copies. saveConfig() does this itself.
+void markConfigChanged();
+
 #endif // CONFIG_MANAGER_H
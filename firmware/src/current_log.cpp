@@ -0,0 +1,264 @@
+#include "current_log.h"
+#include "wifi_manager.h"
+#include <LittleFS.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#define CURRENT_LOG_INDEX CURRENT_LOG_DIR "/index.bin"
+
+// Taken by every public call: flushes can come from the loop or, before a
+// restart, from the web server task
+static SemaphoreHandle_t log_mutex = nullptr;
+
+struct SegmentIndexEntry {
+    uint32_t id;      // File name number
+    uint32_t first_s; // Unix time of the first record
+};
+
+// Segments, oldest first. The start times bound each segment's time range
+// (it ends where the next one starts), so a range can be found without
+// opening the files.
+static SegmentIndexEntry segment_index[CURRENT_LOG_MAX_SEGMENTS];
+static uint8_t segment_count = 0;
+static uint32_t next_segment_id = 0;
+static uint32_t tail_blocks = 0; // Blocks in the newest segment
+
+// Block being filled, in Unix milliseconds. Once part of it has been
+// flushed it is the last block of the newest segment and is rewritten
+// there until full.
+static SeriesBlock log_block;
+static SeriesEncoder log_encoder;
+static bool block_on_flash = false;
+
+// Entries from before the clock was synced, in milliseconds since boot
+static RingBuffer<CurrentHistoryEntry, CURRENT_LOG_BATCH> pending;
+static unsigned long last_flush_ms = 0;
+static bool restored = false;
+
+// The boot-to-Unix offset survives a failed resync, unlike the synced flag
+static bool clock_known() {
+    return get_unix_time_ms_from_millis(0) != 0;
+}
+
+static void segment_path(char* path, size_t size, uint32_t id) {
+    snprintf(path, size, CURRENT_LOG_DIR "/%08lu.bin", (unsigned long)id);
+}
+
+static void write_index() {
+    File file = LittleFS.open(CURRENT_LOG_INDEX, "w");
+    if (!file) {
+        Serial.println("Current log: failed to write index");
+        return;
+    }
+    file.write((const uint8_t*)segment_index, segment_count * sizeof(SegmentIndexEntry));
+    file.close();
+}
+
+// Starts a new segment, dropping the oldest one if the log is at its limit
+static void start_segment(uint32_t first_s) {
+    char path[32];
+    if (segment_count == CURRENT_LOG_MAX_SEGMENTS) {
+        segment_path(path, sizeof(path), segment_index[0].id);
+        LittleFS.remove(path);
+        memmove(&segment_index[0], &segment_index[1], (segment_count - 1) * sizeof(SegmentIndexEntry));
+        segment_count--;
+    }
+    segment_index[segment_count].id = next_segment_id++;
+    segment_index[segment_count].first_s = first_s;
+    segment_count++;
+    tail_blocks = 0;
+    write_index();
+}
+
+// Writes the current block: over its earlier partial copy if there is one,
+// otherwise appended to the newest segment
+static bool write_block() {
+    char path[32];
+    if (!block_on_flash && (segment_count == 0 || tail_blocks == CURRENT_LOG_SEGMENT_BLOCKS)) {
+        start_segment((uint32_t)(log_block.header.first_ts / 1000));
+    }
+    segment_path(path, sizeof(path), segment_index[segment_count - 1].id);
+
+    File file = LittleFS.open(path, block_on_flash ? "r+" : "a");
+    if (!file) {
+        Serial.println("Current log: failed to open segment");
+        return false;
+    }
+    if (block_on_flash) {
+        file.seek((tail_blocks - 1) * sizeof(SeriesBlock));
+    }
+    file.write((const uint8_t*)&log_block, sizeof(SeriesBlock));
+    file.close();
+
+    if (!block_on_flash) {
+        tail_blocks++;
+        block_on_flash = true;
+    }
+    return true;
+}
+
+static void add_locked(const CurrentHistoryEntry& entry) {
+    int64_t unix_ms = (int64_t)get_unix_time_ms_from_millis(entry.timestamp);
+    if (series_encoder_add(log_encoder, unix_ms, entry.current)) return;
+
+    // Full: write it out for the last time and start the next one
+    write_block();
+    series_encoder_begin(log_encoder, &log_block);
+    block_on_flash = false;
+    series_encoder_add(log_encoder, unix_ms, entry.current);
+}
+
+static void drain_pending_locked() {
+    for (const CurrentHistoryEntry& entry : pending) {
+        add_locked(entry);
+    }
+    pending.clear();
+}
+
+static void flush_locked() {
+    if (!clock_known()) return;
+    drain_pending_locked();
+    if (log_block.header.count > 0) {
+        write_block();
+    }
+    last_flush_ms = millis();
+}
+
+// Walks the log backwards from the newest block, moving each to the boot
+// time base and prepending it to the history until it is full or the log
+// runs out. Only the blocks that end up in RAM are read: a segment that
+// starts at or after the oldest point already in the history could only
+// add blocks the time order check drops, so it is not opened.
+static void restore_locked() {
+    const CurrentHistory& history = get_current_history();
+    int64_t offset_ms = (int64_t)get_unix_time_ms_from_millis(0);
+    SeriesBlock block;
+    char path[32];
+    uint32_t restored_count = 0;
+
+    for (int seg = segment_count - 1; seg >= 0 && !history.full(); seg--) {
+        int64_t start_ms = (int64_t)segment_index[seg].first_s * 1000 - offset_ms;
+        if (!history.empty() && start_ms >= history.oldestTimestamp()) continue;
+
+        segment_path(path, sizeof(path), segment_index[seg].id);
+        File file = LittleFS.open(path, "r");
+        if (!file) continue;
+
+        size_t remaining = file.size() / sizeof(SeriesBlock);
+        while (remaining > 0 && !history.full()) {
+            remaining--;
+            file.seek(remaining * sizeof(SeriesBlock));
+            if (file.read((uint8_t*)&block, sizeof(SeriesBlock)) != sizeof(SeriesBlock)) break;
+            if (!series_block_valid(block)) continue;
+
+            series_block_shift(block, -offset_ms);
+            // Keep the history in time order even if the clock was off
+            if (!history.empty() && block.header.last_ts >= history.oldestTimestamp()) continue;
+            current_history_prepend(block);
+            restored_count += block.header.count;
+        }
+        file.close();
+    }
+
+    Serial.printf("Current log: restored %lu entries\n", (unsigned long)restored_count);
+}
+
+void current_log_init() {
+    if (!log_mutex) {
+        log_mutex = xSemaphoreCreateMutex();
+    }
+    xSemaphoreTake(log_mutex, portMAX_DELAY);
+
+    if (!LittleFS.exists(CURRENT_LOG_DIR)) {
+        LittleFS.mkdir(CURRENT_LOG_DIR);
+    }
+
+    segment_count = 0;
+    File index = LittleFS.open(CURRENT_LOG_INDEX, "r");
+    if (index) {
+        segment_count = index.read((uint8_t*)segment_index, sizeof(segment_index)) / sizeof(SegmentIndexEntry);
+        index.close();
+    }
+
+    tail_blocks = 0;
+    if (segment_count > 0) {
+        next_segment_id = segment_index[segment_count - 1].id + 1;
+        char path[32];
+        segment_path(path, sizeof(path), segment_index[segment_count - 1].id);
+        File tail = LittleFS.open(path, "r");
+        if (tail) {
+            tail_blocks = tail.size() / sizeof(SeriesBlock);
+            tail.close();
+        }
+    }
+
+    // A partial block left by the previous boot stays as it is
+    series_encoder_begin(log_encoder, &log_block);
+    block_on_flash = false;
+    last_flush_ms = millis();
+
+    xSemaphoreGive(log_mutex);
+}
+
+void current_log_append(const CurrentHistoryEntry& entry) {
+    if (!log_mutex) return;
+    xSemaphoreTake(log_mutex, portMAX_DELAY);
+    if (clock_known()) {
+        drain_pending_locked();
+        add_locked(entry);
+    } else {
+        // Until the clock is synced this keeps the newest CURRENT_LOG_BATCH entries
+        pending.push(entry);
+    }
+    xSemaphoreGive(log_mutex);
+}
+
+void current_log_handle() {
+    if (!log_mutex) return;
+    xSemaphoreTake(log_mutex, portMAX_DELAY);
+
+    // Restore before the first write, so only earlier boots are read back
+    if (!restored && clock_known()) {
+        restore_locked();
+        restored = true;
+    }
+
+    if (millis() - last_flush_ms >= CURRENT_LOG_FLUSH_INTERVAL_MS) {
+        flush_locked();
+    }
+
+    xSemaphoreGive(log_mutex);
+}
+
+void current_log_flush() {
+    if (!log_mutex) return;
+    xSemaphoreTake(log_mutex, portMAX_DELAY);
+    flush_locked();
+    xSemaphoreGive(log_mutex);
+}
+
+uint32_t current_log_benchmark(uint32_t records) {
+    const char* path = CURRENT_LOG_DIR "/bench.bin";
+    SeriesBlock block;
+    SeriesEncoder enc;
+    int64_t ts = 1700000000000LL;
+
+    uint32_t start = micros();
+    series_encoder_begin(enc, &block);
+    for (uint32_t i = 0; i < records; i++) {
+        ts += 500 + (i % 7);
+        float current = 4.0f + 0.01f * (float)(i % 13);
+        if (!series_encoder_add(enc, ts, current)) {
+            File file = LittleFS.open(path, "a");
+            if (!file) break;
+            file.write((const uint8_t*)&block, sizeof(SeriesBlock));
+            file.close();
+            series_encoder_begin(enc, &block);
+            series_encoder_add(enc, ts, current);
+        }
+    }
+    uint32_t elapsed = micros() - start;
+
+    LittleFS.remove(path);
+    return elapsed;
+}
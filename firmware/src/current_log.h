@@ -0,0 +1,40 @@
+#ifndef CURRENT_LOG_H
+#define CURRENT_LOG_H
+
+#include <Arduino.h>
+#include "current_sensor.h"
+
+// Append-only log of the current history on LittleFS, so it survives
+// restarts. Entries are compressed into the same blocks as the RAM history
+// (series_codec.h), with Unix time stamps, and the blocks are written to
+// segment files under CURRENT_LOG_DIR; an index file lists each segment's
+// first timestamp. The block being filled is rewritten in place on each
+// flush until it is full. Nothing is written until the clock has been
+// synced.
+#define CURRENT_LOG_DIR              "/clog"
+#define CURRENT_LOG_SEGMENT_BLOCKS   128    // 32 KB per segment file
+#define CURRENT_LOG_MAX_SEGMENTS     8      // Oldest segment is deleted beyond this
+#define CURRENT_LOG_BATCH            64     // Entries held until the clock is synced; must stay a power of two
+#define CURRENT_LOG_FLUSH_INTERVAL_MS (5UL * 60 * 1000) // Write the partial block this often
+
+// Loads the segment index. Call after LittleFS is mounted.
+void current_log_init();
+
+// Adds a history entry to the block being filled, writing the block out
+// when it is full
+void current_log_append(const CurrentHistoryEntry& entry);
+
+// Flushes the partial block when the interval has passed. Once the clock is
+// first synced, also prepends the logged blocks from earlier boots to the
+// current history, reading only as many blocks from the tail as fit.
+void current_log_handle();
+
+// Writes out the partial block (if the clock is synced). Call before an
+// intentional restart.
+void current_log_flush();
+
+// Encodes `records` synthetic entries into blocks, appends them to a
+// scratch segment and returns the total time spent in microseconds.
+uint32_t current_log_benchmark(uint32_t records);
+
+#endif // CURRENT_LOG_H
@@ -1,43 +1,101 @@
 #include <Arduino.h>
 #include "current_sensor.h"
-#include <vector>
+#include "adc_sampler.h"
+#include "current_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 #include <cstdint>
 #include <cmath>
 
 // WCS1800 Current Sensor Configuration for ESP32
-const int WCS1800_PIN = 1;       // WCS1800 connected to ESP32 analog pin 1 (ADC1_CH0)
+const int WCS1800_PIN = ADC_SAMPLER_CURRENT_PIN; // WCS1800 connected to ESP32 analog pin 1 (ADC1_CH1)
 
 // Using user-provided calibration values
 const float SENSITIVITY = 0.0101;   // Sensitivity in V/A from calibration
 const float VREF_ZERO_CURRENT = 1.632; // Reference voltage at zero current from calibration (in Volts)
 
+// Amps per 1/16 mV of sensor output, for the fixed-point statistics
+const float AMPS_PER_STATS_UNIT = 1.0f / ((1 << CURRENT_STATS_FRAC_BITS) * SENSITIVITY * 1000.0f);
+
+// Guards the raw history's blocks while the web server copies them out.
+// The loop is the only writer, so its own reads go without it.
+static SemaphoreHandle_t history_mutex = nullptr;
+
 /**
- * @brief Initializes the current sensor pin.
- * On the ESP32, setting the attenuation is good practice for analog inputs.
- * ADC_11db gives a full-range of approx. 0-3.3V.
+ * @brief Starts background sampling of the sensor.
+ * The ADC sampler converts the pin continuously into a DMA buffer and keeps
+ * a filtered reading and windowed statistics ready, so nothing has to wait
+ * on the ADC later.
  */
 void setup_current_sensor() {
-  analogSetPinAttenuation(WCS1800_PIN, ADC_11db);
+  if (!history_mutex) {
+    history_mutex = xSemaphoreCreateMutex();
+  }
+  if (!adc_sampler_start((uint16_t)(VREF_ZERO_CURRENT * 1000.0f + 0.5f))) {
+    // Readings fall back to single blocking conversions
+    analogSetPinAttenuation(WCS1800_PIN, ADC_11db);
+  }
 }
 
 /**
- * @brief Reads the current from the WCS1800 sensor with averaging.
- * 
+ * @brief Returns the statistics of the last mains-aligned sample window.
+ * The sampler computes them in fixed point from every conversion; this only
+ * scales them to Amperes.
+ *
+ * @return false until the sampler has completed a window.
+ */
+bool read_wcs1800_stats(CurrentSensorStats& out) {
+  AdcReading reading;
+  if (!adc_sampler_latest(reading) || reading.statsWindows == 0) {
+    return false;
+  }
+
+  const CurrentStats& stats = reading.currentStats;
+  out.rms = stats.rms * AMPS_PER_STATS_UNIT;
+  out.mean = stats.mean * AMPS_PER_STATS_UNIT;
+  out.peak = stats.peak * AMPS_PER_STATS_UNIT;
+  out.crest = stats.crest_q8 / 256.0f;
+  out.window = reading.statsWindows;
+  return true;
+}
+
+/**
+ * @brief Converts a current to the sampler's fixed-point statistics units,
+ * so limits can be compared with raw sample sums.
+ */
+int32_t current_sensor_stats_units(float amps) {
+  return (int32_t)lroundf(amps / AMPS_PER_STATS_UNIT);
+}
+
+float current_sensor_amps_per_stats_unit() {
+  return AMPS_PER_STATS_UNIT;
+}
+
+/**
+ * @brief Returns the pump current.
+ * This is the true RMS over the last window, so it is meaningful for AC
+ * pumps too (for DC it is the magnitude). Until the sampler has a window,
+ * it falls back to an instantaneous reading. Cheap and non-blocking once
+ * the sampler runs.
+ *
  * @return The current in Amperes.
  */
 float read_wcs1800_current() {
-  const int NUM_SAMPLES = 5;
-  float total_voltage_mv = 0;
+  CurrentSensorStats stats;
+  if (read_wcs1800_stats(stats)) {
+    return stats.rms;
+  }
 
-  for (int i = 0; i < NUM_SAMPLES; i++) {
-    total_voltage_mv += analogReadMilliVolts(WCS1800_PIN);
-    delay(1); // Small delay for stability
+  AdcReading reading;
+  float voltage_mv;
+  if (adc_sampler_latest(reading)) {
+    voltage_mv = reading.currentMv;
+  } else {
+    voltage_mv = analogReadMilliVolts(WCS1800_PIN);
   }
 
-  float average_voltage_mv = total_voltage_mv / NUM_SAMPLES;
-  
   // Convert measured millivolts to volts
-  float voltage = average_voltage_mv / 1000.0;
+  float voltage = voltage_mv / 1000.0;
 
   // Calculate the current in Amperes using the provided calibration values
   // Formula: Current = (MeasuredVoltage - VoltageAtZeroCurrent) / Sensitivity
@@ -49,13 +107,76 @@ float read_wcs1800_current() {
 // --- Current History ---
 const float COV_THRESHOLD = 0.01f; // 200 mA
 const uint64_t MIN_TIME_INTERVAL_US = 900000ULL * 1000; // 15 minutes in microseconds
-const size_t MAX_HISTORY_SIZE = 200;
 const uint64_t MIN_SAMPLE_INTERVAL_US = 500ULL * 1000; // Minimum time between samples in microseconds
 
-static std::vector<CurrentHistoryEntry> current_history;
+static CurrentHistory current_history;
 static uint64_t last_update_time_us = 0;
 static float last_recorded_current = 0.0f;
 
+static void lock_history() {
+    if (history_mutex) xSemaphoreTake(history_mutex, portMAX_DELAY);
+}
+
+static void unlock_history() {
+    if (history_mutex) xSemaphoreGive(history_mutex);
+}
+
+// One rollup tier: closed buckets plus the one still being filled
+struct RollupTier {
+    uint32_t period_s;
+    CurrentRollupHistory buckets;
+    CurrentRollupEntry open;
+    float open_sum;
+};
+
+static RollupTier rollup_tiers[CURRENT_TIER_COUNT - 1] = {
+    {60},
+    {15 * 60},
+    {60 * 60},
+};
+
+// Adds `count` samples (or an already closed finer bucket) taken at time_s
+// to a tier. When time_s falls into a new period, the open bucket is closed
+// and copied to `closed`, and true is returned.
+static bool rollup_add(RollupTier& tier, uint32_t time_s, uint32_t count, float min, float max, float sum,
+                       CurrentRollupEntry& closed) {
+    uint32_t start_s = time_s - time_s % tier.period_s;
+    bool did_close = false;
+
+    if (tier.open.count > 0 && tier.open.start_s != start_s) {
+        tier.open.mean = tier.open_sum / tier.open.count;
+        tier.buckets.push(tier.open);
+        closed = tier.open;
+        tier.open.count = 0;
+        did_close = true;
+    }
+
+    if (tier.open.count == 0) {
+        tier.open.start_s = start_s;
+        tier.open.min = min;
+        tier.open.max = max;
+        tier.open_sum = 0.0f;
+    } else {
+        if (min < tier.open.min) tier.open.min = min;
+        if (max > tier.open.max) tier.open.max = max;
+    }
+    tier.open.count += count;
+    tier.open_sum += sum;
+    return did_close;
+}
+
+// Feeds one sample through the tiers; each closed bucket cascades upwards
+static void rollup_sample(uint32_t time_s, float current) {
+    CurrentRollupEntry closed;
+    if (!rollup_add(rollup_tiers[0], time_s, 1, current, current, current, closed)) return;
+    for (int t = 1; t < CURRENT_TIER_COUNT - 1; t++) {
+        if (!rollup_add(rollup_tiers[t], closed.start_s, closed.count, closed.min, closed.max,
+                        closed.mean * closed.count, closed)) {
+            return;
+        }
+    }
+}
+
 void update_current_history() {
     static uint64_t last_sample_time_us = 0;
     uint64_t current_time_us = esp_timer_get_time();
@@ -67,21 +188,70 @@ void update_current_history() {
     last_sample_time_us = current_time_us;
 
     float current_now = read_wcs1800_current();
+    rollup_sample((uint32_t)(current_time_us / 1000000), current_now);
 
     bool cov_triggered = abs(current_now - last_recorded_current) > COV_THRESHOLD;
     bool time_triggered = (current_time_us - last_update_time_us) > MIN_TIME_INTERVAL_US;
 
     if (cov_triggered || time_triggered) {
-        if (current_history.size() >= MAX_HISTORY_SIZE) {
-            current_history.erase(current_history.begin());
-        }
-        // Store timestamp in milliseconds for downstream processes
-        current_history.push_back({current_time_us / 1000, current_now});
+        // Store timestamp in milliseconds for downstream processes. Once
+        // full, the oldest block is dropped.
+        CurrentHistoryEntry entry = {(int64_t)(current_time_us / 1000), current_now};
+        lock_history();
+        current_history.push(entry.timestamp, entry.current);
+        unlock_history();
+        current_log_append(entry);
         last_update_time_us = current_time_us;
         last_recorded_current = current_now;
     }
+
+    current_log_handle();
 }
 
-const std::vector<CurrentHistoryEntry>& get_current_history() {
+const CurrentHistory& get_current_history() {
     return current_history;
 }
+
+bool current_history_block_since(int64_t since, SeriesBlock& out) {
+    bool found = false;
+    lock_history();
+    current_history.forEachBlockSinceWhile(since, [&](const SeriesBlock& block) {
+        out = block;
+        found = true;
+        return false;
+    });
+    unlock_history();
+    return found;
+}
+
+bool current_history_prepend(const SeriesBlock& block) {
+    lock_history();
+    bool added = current_history.pushFront(block);
+    unlock_history();
+    return added;
+}
+
+const CurrentRollupHistory& get_current_rollup(CurrentHistoryTier tier) {
+    return rollup_tiers[tier - CURRENT_TIER_1MIN].buckets;
+}
+
+uint32_t get_current_rollup_period_s(CurrentHistoryTier tier) {
+    return rollup_tiers[tier - CURRENT_TIER_1MIN].period_s;
+}
+
+CurrentHistoryTier current_history_tier_for_span(uint32_t span_s) {
+    uint32_t now_s = (uint32_t)(esp_timer_get_time() / 1000000);
+    uint32_t from_s = (span_s < now_s) ? now_s - span_s : 0;
+
+    // A tier that has never wrapped holds everything since boot
+    if (!current_history.full() || current_history.oldestTimestamp() / 1000 <= (int64_t)from_s) {
+        return CURRENT_TIER_RAW;
+    }
+    for (int t = CURRENT_TIER_1MIN; t < CURRENT_TIER_1HOUR; t++) {
+        const CurrentRollupHistory& buckets = get_current_rollup((CurrentHistoryTier)t);
+        if (!buckets.full() || buckets.oldest().start_s <= from_s) {
+            return (CurrentHistoryTier)t;
+        }
+    }
+    return CURRENT_TIER_1HOUR;
+}
@@ -2,17 +2,74 @@
 #ifndef CURRENT_SENSOR_H
 #define CURRENT_SENSOR_H
 
-#include <vector>
 #include <cstdint>
+#include "ring_buffer.h"
+#include "series_codec.h"
 
 struct CurrentHistoryEntry {
-  uint64_t timestamp; // Using uint64_t to store milliseconds for long-running applications
+  int64_t timestamp; // Milliseconds since boot; negative for entries restored from the flash log
   float current;
 };
 
+// Change-of-value history, compressed into blocks (see series_codec.h).
+// 64 blocks take the 16 KB the 1024 plain entries used to and hold about
+// 6500 points. Must stay a power of two.
+#define CURRENT_HISTORY_BLOCKS 64
+typedef SeriesStore<CURRENT_HISTORY_BLOCKS> CurrentHistory;
+
+// Rolled-up history. Every sample also feeds a 1 minute bucket; closed
+// buckets are merged into the next coarser tier, so each tier is a fixed
+// size ring and memory stays constant while the 1 hour tier reaches back
+// three weeks.
+enum CurrentHistoryTier {
+  CURRENT_TIER_RAW,   // Change-of-value points (get_current_history)
+  CURRENT_TIER_1MIN,
+  CURRENT_TIER_15MIN,
+  CURRENT_TIER_1HOUR,
+  CURRENT_TIER_COUNT
+};
+
+struct CurrentRollupEntry {
+  uint32_t start_s; // Bucket start, seconds since boot
+  uint32_t count;   // Samples summarised
+  float min;
+  float max;
+  float mean;
+};
+
+#define CURRENT_ROLLUP_CAPACITY 512 // Per tier; must stay a power of two
+typedef RingBuffer<CurrentRollupEntry, CURRENT_ROLLUP_CAPACITY> CurrentRollupHistory;
+
+// Statistics of one mains-aligned window of raw samples, in Amperes
+struct CurrentSensorStats {
+  float rms;   // True RMS
+  float mean;  // Signed average (the DC component)
+  float peak;  // Largest magnitude
+  float crest; // peak / rms
+  uint32_t window; // Sequence number, to tell a new window from a repeat
+};
+
 void setup_current_sensor();
-float read_wcs1800_current();
+float read_wcs1800_current(); // RMS current
+bool read_wcs1800_stats(CurrentSensorStats& out);
+// Amperes in the 1/16 mV units of CurrentStats and its accumulator
+int32_t current_sensor_stats_units(float amps);
+// Amperes per 1/16 mV unit, to scale raw samples
+float current_sensor_amps_per_stats_unit();
 void update_current_history();
-const std::vector<CurrentHistoryEntry>& get_current_history();
+// The raw history. Only the loop may read it in place; it is the only task
+// that changes it.
+const CurrentHistory& get_current_history();
+// Copies the oldest block that reaches past `since`, the open block last.
+// Safe from any task: the history is locked for the copy only.
+bool current_history_block_since(int64_t since, SeriesBlock& out);
+// Inserts a block from the flash log before the oldest one (see
+// SeriesStore::pushFront). Called from the loop.
+bool current_history_prepend(const SeriesBlock& block);
+// Closed buckets of a rollup tier (not CURRENT_TIER_RAW), oldest first
+const CurrentRollupHistory& get_current_rollup(CurrentHistoryTier tier);
+uint32_t get_current_rollup_period_s(CurrentHistoryTier tier);
+// The finest tier that still reaches back span_s seconds, or the coarsest
+CurrentHistoryTier current_history_tier_for_span(uint32_t span_s);
 
 #endif // CURRENT_SENSOR_H
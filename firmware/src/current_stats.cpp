@@ -0,0 +1,69 @@
+#include "current_stats.h"
+
+#define CURRENT_STATS_BENCH_WINDOW 1000
+#define CURRENT_STATS_BENCH_PERIOD 100 // Samples per cycle (50 Hz at 5 kHz)
+
+uint32_t current_stats_isqrt(uint64_t value) {
+    uint64_t root = 0;
+    uint64_t bit = 1ULL << 62;
+    while (bit > value) bit >>= 2;
+    while (bit != 0) {
+        if (value >= root + bit) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)root;
+}
+
+void current_stats_finish(const CurrentStatsAccumulator& acc, CurrentStats& out) {
+    out.samples = acc.count;
+    out.peak = acc.peak;
+    if (acc.count == 0) {
+        out.mean = 0;
+        out.rms = 0;
+        out.crest_q8 = 0;
+        return;
+    }
+
+    out.mean = (int32_t)(acc.sum / (int64_t)acc.count);
+    out.rms = current_stats_isqrt(acc.sum_sq / acc.count);
+
+    if (out.rms == 0) {
+        out.crest_q8 = 0;
+    } else {
+        uint32_t crest = (uint32_t)(((uint64_t)out.peak << 8) / out.rms);
+        out.crest_q8 = crest > UINT16_MAX ? UINT16_MAX : (uint16_t)crest;
+    }
+}
+
+uint32_t current_stats_benchmark(uint32_t samples) {
+    // 5 A peak sine at 10.1 mV/A, built before the clock starts
+    int32_t wave[CURRENT_STATS_BENCH_PERIOD];
+    for (int i = 0; i < CURRENT_STATS_BENCH_PERIOD; i++) {
+        wave[i] = (int32_t)lroundf(50.5f * 16 * sinf(2 * PI * i / CURRENT_STATS_BENCH_PERIOD));
+    }
+
+    CurrentStatsAccumulator acc;
+    CurrentStats stats;
+    current_stats_reset(acc);
+    volatile uint32_t sink = 0; // Keeps the results live
+
+    uint32_t start = micros();
+    int phase = 0;
+    for (uint32_t i = 0; i < samples; i++) {
+        current_stats_add(acc, wave[phase]);
+        if (++phase == CURRENT_STATS_BENCH_PERIOD) phase = 0;
+        if (acc.count == CURRENT_STATS_BENCH_WINDOW) {
+            current_stats_finish(acc, stats);
+            sink = sink + stats.rms;
+            current_stats_reset(acc);
+        }
+    }
+    uint32_t elapsed = micros() - start;
+    (void)sink;
+    return elapsed;
+}
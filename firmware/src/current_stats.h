@@ -0,0 +1,54 @@
+#ifndef CURRENT_STATS_H
+#define CURRENT_STATS_H
+
+#include <Arduino.h>
+
+// Windowed statistics over the raw current sensor samples, in integer
+// arithmetic only (the ESP32-C6 has no FPU). Samples are signed offsets
+// from the sensor's zero-current output in 1/16 mV, so the RMS is the true
+// RMS of the current, DC component included. A window should span whole
+// mains cycles so a partial half-wave does not skew the result.
+#define CURRENT_STATS_FRAC_BITS 4 // Fractional bits of the sample and result values
+
+struct CurrentStatsAccumulator {
+    int64_t sum;
+    uint64_t sum_sq;
+    uint32_t peak; // Largest magnitude seen
+    uint32_t count;
+};
+
+struct CurrentStats {
+    int32_t mean;      // 1/16 mV from zero
+    uint32_t rms;      // 1/16 mV
+    uint32_t peak;     // 1/16 mV, largest magnitude
+    uint16_t crest_q8; // peak / rms with 8 fractional bits; 0 if rms is 0
+    uint32_t samples;  // Samples in the window
+};
+
+inline void current_stats_reset(CurrentStatsAccumulator& acc) {
+    acc.sum = 0;
+    acc.sum_sq = 0;
+    acc.peak = 0;
+    acc.count = 0;
+}
+
+// Called for every sample, so kept inline
+inline void current_stats_add(CurrentStatsAccumulator& acc, int32_t sample) {
+    uint32_t magnitude = sample < 0 ? (uint32_t)-sample : (uint32_t)sample;
+    acc.sum += sample;
+    acc.sum_sq += (uint64_t)magnitude * magnitude;
+    if (magnitude > acc.peak) acc.peak = magnitude;
+    acc.count++;
+}
+
+// Computes the statistics of the samples added since the last reset
+void current_stats_finish(const CurrentStatsAccumulator& acc, CurrentStats& out);
+
+// Integer square root, rounded down
+uint32_t current_stats_isqrt(uint64_t value);
+
+// Feeds `samples` samples of a synthetic waveform through the kernel in
+// 1000-sample windows and returns the time spent in microseconds
+uint32_t current_stats_benchmark(uint32_t samples);
+
+#endif // CURRENT_STATS_H
@@ -0,0 +1,62 @@
+#include "display_renderer.h"
+#include "st7789_dma_driver.h"
+#include "image_decoder.h"
+
+extern CustomCanvas canvas;
+
+// Owned by the push task while an image is in flight
+static ImageDecoder image_decoder;
+
+static void image_source(uint16_t* dst, int n, void* ctx) {
+    image_decoder_read(*(ImageDecoder*)ctx, dst, n);
+}
+
+void display_render(display_draw_fn_t draw) {
+    canvas.beginFrame();
+    for (int16_t y = 0; y < SCREEN_HEIGHT; y += canvas.bandHeight()) {
+        // With two band buffers this band is drawn into the one that is not
+        // being streamed out, so drawing overlaps the previous band's DMA.
+        // With only one, it can't be redrawn until the push has finished.
+        bool pingPong = canvas.swapBandBuffer();
+        if (!pingPong) {
+            st7789_wait_for_frame();
+        }
+
+        canvas.beginBand(y);
+        draw();
+
+        // Collecting damage commits the tile hashes, so the push must not
+        // be refused: wait for the previous band to leave the other buffer.
+        DisplayRect rects[MAX_DAMAGE_RECTS];
+        uint8_t count = canvas.collectDamage(rects, MAX_DAMAGE_RECTS);
+        if (count > 0) {
+            st7789_wait_for_frame();
+            st7789_push_canvas_rects_async(canvas.getBuffer(), SCREEN_WIDTH, y, rects, count);
+        } else if (pingPong) {
+            // Nothing was queued from this buffer; keep drawing into it so
+            // the next band doesn't land in the one still in flight
+            canvas.swapBandBuffer();
+        }
+    }
+    canvas.endFrame();
+}
+
+void display_set_palette(const uint16_t* palette) {
+    st7789_wait_for_frame();
+    st7789_set_palette(palette);
+    canvas.invalidate();
+
+    if (canvas.bandHeight() >= SCREEN_HEIGHT) {
+        DisplayRect rects[MAX_DAMAGE_RECTS];
+        uint8_t count = canvas.collectDamage(rects, MAX_DAMAGE_RECTS);
+        st7789_push_canvas_rects_async(canvas.getBuffer(), SCREEN_WIDTH, 0, rects, count);
+    }
+}
+
+void display_show_image(int16_t x, int16_t y, const uint8_t* image, int16_t w, int16_t h) {
+    st7789_wait_for_frame();
+    image_decoder_begin(image_decoder, image);
+    DisplayRect rect = {x, y, w, h};
+    st7789_push_pixels_async(rect, image_source, &image_decoder);
+    canvas.invalidate();
+}
@@ -0,0 +1,28 @@
+#ifndef DISPLAY_RENDERER_H
+#define DISPLAY_RENDERER_H
+
+#include "CustomCanvas.h"
+
+// Draws a whole screen into the global canvas. It is called once per band
+// and must draw the same thing each time: no state changes, delays or
+// pushes of its own.
+typedef void (*display_draw_fn_t)(void);
+
+// Replays `draw` for every band of the screen and pushes the parts of each
+// band that changed. Each band is drawn while the previous one is still
+// being sent. Returns once the last band is queued for DMA.
+void display_render(display_draw_fn_t draw);
+
+// Switches the colours the canvas palette indices are shown with (see
+// CustomCanvas::buildPalette). Nothing is redrawn: in full-frame mode the
+// existing frame is re-sent straight away, otherwise every tile is sent
+// again on the next render.
+void display_set_palette(const uint16_t* palette);
+
+// Decodes a compressed image (see image_decoder.h) straight into a window
+// of the panel, bypassing the canvas. Returns as soon as the transfer is
+// queued; the push task decodes while the caller carries on. The canvas no
+// longer matches the panel afterwards, so the next render resends it all.
+void display_show_image(int16_t x, int16_t y, const uint8_t* image, int16_t w, int16_t h);
+
+#endif // DISPLAY_RENDERER_H
@@ -0,0 +1,61 @@
+#include "frame_scheduler.h"
+
+// Written from the encoder ISR, so only touched with atomic operations
+static volatile uint8_t pending_reasons = 0;
+static volatile uint32_t request_count = 0;
+static volatile uint32_t merged_count = 0;
+
+static uint32_t last_frame_ms = 0;
+static uint16_t periodic_interval_ms = FRAME_PERIODIC_INTERVAL_MS;
+static uint32_t rendered_count = 0;
+static uint32_t last_render_us = 0;
+static uint32_t max_render_us = 0;
+
+void IRAM_ATTR frame_invalidate(uint8_t reasons) {
+    uint8_t before = __atomic_fetch_or(&pending_reasons, reasons, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&request_count, 1, __ATOMIC_RELAXED);
+    if (before != 0) {
+        // A frame is already pending; this request rides along with it
+        __atomic_fetch_add(&merged_count, 1, __ATOMIC_RELAXED);
+    }
+}
+
+bool frame_due(uint32_t now_ms) {
+    uint8_t reasons = pending_reasons;
+    if (reasons == 0) return false;
+
+    uint32_t since_last = now_ms - last_frame_ms;
+    if (reasons & FRAME_REASONS_URGENT) {
+        return since_last >= FRAME_INPUT_INTERVAL_MS;
+    }
+    return since_last >= periodic_interval_ms;
+}
+
+uint8_t frame_begin(uint32_t now_ms) {
+    last_frame_ms = now_ms;
+    return __atomic_exchange_n(&pending_reasons, 0, __ATOMIC_RELAXED);
+}
+
+void frame_end(uint32_t render_us) {
+    rendered_count++;
+    last_render_us = render_us;
+    if (render_us > max_render_us) max_render_us = render_us;
+}
+
+void frame_discard() {
+    if (__atomic_exchange_n(&pending_reasons, 0, __ATOMIC_RELAXED) != 0) {
+        __atomic_fetch_add(&merged_count, 1, __ATOMIC_RELAXED);
+    }
+}
+
+void frame_set_periodic_interval(uint16_t interval_ms) {
+    periodic_interval_ms = interval_ms;
+}
+
+void frame_get_stats(FrameStats& stats) {
+    stats.requests = request_count;
+    stats.rendered = rendered_count;
+    stats.skipped = merged_count;
+    stats.lastRenderUs = last_render_us;
+    stats.maxRenderUs = max_render_us;
+}
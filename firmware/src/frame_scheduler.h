@@ -0,0 +1,48 @@
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+#include <Arduino.h>
+
+// Why a frame was requested. Input and state changes are drawn as soon as
+// the display allows; periodic reasons are batched and rate capped.
+#define FRAME_REASON_INPUT 0x01 // Encoder or button
+#define FRAME_REASON_STATE 0x02 // Screen change or a value changed by the controller
+#define FRAME_REASON_CLOCK 0x04 // Software clock tick
+#define FRAME_REASON_LIVE  0x08 // Battery, sensor readings, run progress
+
+#define FRAME_REASONS_URGENT (FRAME_REASON_INPUT | FRAME_REASON_STATE)
+
+// Minimum spacing of input-driven frames. Fast encoder spins are coalesced
+// into one frame per interval instead of one frame per detent.
+#define FRAME_INPUT_INTERVAL_MS    16
+// Default spacing of periodic frames; screens can change it
+#define FRAME_PERIODIC_INTERVAL_MS 1000
+
+struct FrameStats {
+    uint32_t requests;     // frame_invalidate() calls
+    uint32_t rendered;     // Frames actually drawn
+    uint32_t skipped;      // Requests merged into another frame or dropped while dimmed
+    uint32_t lastRenderUs; // Duration of the last frame
+    uint32_t maxRenderUs;
+};
+
+// Request a frame. Safe to call from an ISR.
+void frame_invalidate(uint8_t reasons);
+
+// True if a frame is pending and its rate limit has passed
+bool frame_due(uint32_t now_ms);
+
+// Bracket the drawing of a frame. frame_begin() returns the reasons the
+// frame covers and clears them.
+uint8_t frame_begin(uint32_t now_ms);
+void frame_end(uint32_t render_us);
+
+// Drop pending requests without drawing (screen off)
+void frame_discard();
+
+// Cap for periodic frames on the current screen
+void frame_set_periodic_interval(uint16_t interval_ms);
+
+void frame_get_stats(FrameStats& stats);
+
+#endif // FRAME_SCHEDULER_H
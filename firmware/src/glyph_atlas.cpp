@@ -0,0 +1,54 @@
+#include "glyph_atlas.h"
+#include <Adafruit_GFX.h>
+
+static uint8_t glyph_rows[GLYPH_ATLAS_LAST - GLYPH_ATLAS_FIRST + 1][GLYPH_ROWS];
+static GlyphRuns row_runs[1 << GLYPH_COLS];
+static bool atlas_ready = false;
+
+void glyph_atlas_init() {
+    if (atlas_ready) return;
+
+    // The font table is private to the GFX library, so each glyph is drawn
+    // once through drawChar() and read back as row masks
+    GFXcanvas8 cell(GLYPH_COLS, GLYPH_ROWS);
+    cell.cp437(true); // Index the table directly; callers apply the quirk
+    for (int c = GLYPH_ATLAS_FIRST; c <= GLYPH_ATLAS_LAST; c++) {
+        cell.fillScreen(0);
+        cell.drawChar(0, 0, c, 1, 1, 1, 1);
+        const uint8_t* pixels = cell.getBuffer();
+        for (int r = 0; r < GLYPH_ROWS; r++) {
+            uint8_t mask = 0;
+            for (int i = 0; i < GLYPH_COLS; i++) {
+                if (pixels[r * GLYPH_COLS + i]) {
+                    mask |= 1 << i;
+                }
+            }
+            glyph_rows[c - GLYPH_ATLAS_FIRST][r] = mask;
+        }
+    }
+
+    for (int mask = 0; mask < (1 << GLYPH_COLS); mask++) {
+        GlyphRuns& runs = row_runs[mask];
+        runs.count = 0;
+        int i = 0;
+        while (i < GLYPH_COLS) {
+            if (!(mask & (1 << i))) { i++; continue; }
+            int start = i;
+            while (i < GLYPH_COLS && (mask & (1 << i))) i++;
+            runs.start[runs.count] = start;
+            runs.len[runs.count] = i - start;
+            runs.count++;
+        }
+    }
+
+    atlas_ready = true;
+}
+
+const uint8_t* glyph_atlas_rows(uint8_t c) {
+    if (c < GLYPH_ATLAS_FIRST || c > GLYPH_ATLAS_LAST) return nullptr;
+    return glyph_rows[c - GLYPH_ATLAS_FIRST];
+}
+
+const GlyphRuns& glyph_atlas_runs(uint8_t rowMask) {
+    return row_runs[rowMask];
+}
@@ -0,0 +1,35 @@
+#ifndef GLYPH_ATLAS_H
+#define GLYPH_ATLAS_H
+
+#include <Arduino.h>
+
+// The Adafruit GFX classic font, pre-rasterised for span blitting. Each glyph
+// is stored as GLYPH_ROWS row masks (bit i = column i) instead of the
+// column-major bytes drawChar() walks pixel by pixel. Every 5-bit row mask
+// maps to at most three horizontal runs, so a glyph row at any text size is
+// a handful of span fills.
+//
+// Only printable ASCII is kept, 760 bytes of RAM, since that is all the UI
+// prints; other characters are drawn with drawChar().
+#define GLYPH_COLS  5
+#define GLYPH_ROWS  8
+#define GLYPH_CELL_W 6 // Glyph plus one column of spacing
+#define GLYPH_ATLAS_FIRST 0x20
+#define GLYPH_ATLAS_LAST  0x7E
+
+struct GlyphRuns {
+    uint8_t count;
+    uint8_t start[3];
+    uint8_t len[3];
+};
+
+void glyph_atlas_init();
+
+// Row masks for character c (already remapped for cp437 by the caller), or
+// nullptr if c is not in the atlas
+const uint8_t* glyph_atlas_rows(uint8_t c);
+
+// Horizontal runs of set pixels in a row mask
+const GlyphRuns& glyph_atlas_runs(uint8_t rowMask);
+
+#endif // GLYPH_ATLAS_H
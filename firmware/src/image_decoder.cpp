@@ -0,0 +1,80 @@
+#include "image_decoder.h"
+
+#define IMAGE_OP_LITERAL 0xFE
+
+static inline uint8_t image_hash(uint16_t p) {
+    return ((p >> 11) * 3 + ((p >> 5) & 0x3F) * 5 + (p & 0x1F) * 7) & (IMAGE_INDEX_SIZE - 1);
+}
+
+static inline uint16_t image_pack(int r, int g, int b) {
+    return ((r & 0x1F) << 11) | ((g & 0x3F) << 5) | (b & 0x1F);
+}
+
+void image_decoder_begin(ImageDecoder& dec, const uint8_t* data) {
+    dec.src = data;
+    dec.prev = 0;
+    dec.run = 0;
+    memset(dec.index, 0, sizeof(dec.index));
+}
+
+// dst may be null to skip pixels
+static void image_decode(ImageDecoder& dec, uint16_t* dst, int n) {
+    const uint8_t* s = dec.src;
+    uint16_t prev = dec.prev;
+
+    while (n > 0) {
+        if (dec.run > 0) {
+            int count = (dec.run < n) ? dec.run : n;
+            if (dst) {
+                for (int i = 0; i < count; i++) *dst++ = prev;
+            }
+            dec.run -= count;
+            n -= count;
+            continue;
+        }
+
+        uint8_t op = pgm_read_byte(s++);
+        uint16_t p;
+        if (op == IMAGE_OP_LITERAL) {
+            p = (pgm_read_byte(s) << 8) | pgm_read_byte(s + 1);
+            s += 2;
+        } else if ((op >> 6) == 3) {
+            dec.run = (op & 0x3F) + 1;
+            continue;
+        } else if ((op >> 6) == 0) {
+            p = dec.index[op];
+        } else {
+            int r = prev >> 11;
+            int g = (prev >> 5) & 0x3F;
+            int b = prev & 0x1F;
+            if ((op >> 6) == 1) {
+                r += ((op >> 4) & 3) - 2;
+                g += ((op >> 2) & 3) - 2;
+                b += (op & 3) - 2;
+            } else {
+                int dg = (op & 0x3F) - 32;
+                uint8_t rb = pgm_read_byte(s++);
+                r += dg + (rb >> 4) - 8;
+                g += dg;
+                b += dg + (rb & 0x0F) - 8;
+            }
+            p = image_pack(r, g, b);
+        }
+
+        dec.index[image_hash(p)] = p;
+        prev = p;
+        if (dst) *dst++ = p;
+        n--;
+    }
+
+    dec.src = s;
+    dec.prev = prev;
+}
+
+void image_decoder_read(ImageDecoder& dec, uint16_t* dst, int n) {
+    image_decode(dec, dst, n);
+}
+
+void image_decoder_skip(ImageDecoder& dec, int n) {
+    image_decode(dec, nullptr, n);
+}
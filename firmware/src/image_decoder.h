@@ -0,0 +1,33 @@
+#ifndef IMAGE_DECODER_H
+#define IMAGE_DECODER_H
+
+#include <Arduino.h>
+
+// Streaming decoder for the QOI-style RGB565 images written by
+// convert_image.py. Pixels come out in row-major order, any number at a
+// time, so an image can be sent to the panel or drawn into a band without
+// ever being held decompressed. Each byte starts one op:
+//
+//   00iiiiii          pixel from the 64-entry recent colour index
+//   01rrggbb          small step from the previous pixel (each -2..1)
+//   10gggggg rrrrbbbb green step -32..31, red/blue step relative to it -8..7
+//   11nnnnnn          previous pixel repeated n + 1 times (n < 62)
+//   11111110 hi lo    literal RGB565 pixel
+#define IMAGE_INDEX_SIZE 64
+
+struct ImageDecoder {
+    const uint8_t* src;
+    uint16_t prev;
+    uint8_t run; // Repeats of prev still owed from the last run op
+    uint16_t index[IMAGE_INDEX_SIZE];
+};
+
+void image_decoder_begin(ImageDecoder& dec, const uint8_t* data);
+
+// Writes the next n pixels (native RGB565) to dst
+void image_decoder_read(ImageDecoder& dec, uint16_t* dst, int n);
+
+// Discards the next n pixels
+void image_decoder_skip(ImageDecoder& dec, int n);
+
+#endif // IMAGE_DECODER_H
@@ -1,6 +1,6 @@
 // Auto-generated logo data
 // Image size: 165x60 pixels
-// Format: RGB565
+// Format: QOI-style RGB565, 7517 bytes (raw: 19800)
 
 #ifndef LOGO_H
 #define LOGO_H
@@ -10,833 +10,477 @@
 #define LOGO_WIDTH 165
 #define LOGO_HEIGHT 60
 
-const uint16_t logo_data[165*60] = {
-0xF7FF, 0xFFFE, 0xF7FF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xF7FF, 0xFFDF, 0xFFDE, 0xF7FF, 
-0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xF7FF, 
-0xFFFF, 0xFFFF, 0xF7DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFE, 0xE73C, 0x8C93, 0x8C94, 0x94B4, 0x94B4, 0x8C93, 0x9494, 0xC65A, 0xFFFF, 0xF7BE, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC73C, 
-0x9E7B, 0xA69B, 0x9E9A, 0x9E7B, 0x9EBB, 0xA67A, 0xEF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xD75C, 0x9E7A, 0xA69A, 0x9EBB, 0xA67A, 0x9E9A, 0xA6BB, 0xDF7D, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF9, 0x1085, 
-0x0886, 0x1086, 0x10A6, 0x10C6, 0x0004, 0x94D4, 0xF7BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFDC, 0xD758, 0xC6F5, 0xB672, 
-0xAE51, 0xAE50, 0xAE51, 0xB693, 0xBED5, 0xD738, 0xF7FD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xF7FE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0x9E7A, 0x5D78, 0x5DB8, 0x5DD8, 
-0x5D78, 0x5DB9, 0x65B7, 0xD75E, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xAEDB, 
-0x5D98, 0x65F9, 0x5DD9, 0x65D8, 0x5DD8, 0x6DB8, 0xC73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE3B, 0x1086, 0x2109, 0x1908, 0x1908, 
-0x2129, 0x0867, 0x9CF4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 
-0xFFFF, 0xFFDD, 0xF7FD, 0xD759, 0xAE73, 0x8DCD, 0x7D6B, 0x7D6A, 0x7D6A, 0x7D8A, 0x7D8A, 0x7D8A, 
-0x7D8A, 0x7D8A, 0x856A, 0x8DAD, 0xA673, 0xDF7A, 0xFFDE, 0xFFBF, 0xFFFF, 0xF7FF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9EBB, 0x5DB9, 0x661A, 0x661A, 0x65DA, 0x65DA, 0x5DF9, 
-0xD79F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xB6DC, 0x5DB9, 0x663B, 0x65DA, 
-0x6DFA, 0x5DFA, 0x65B8, 0xCF5E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC63A, 0x1085, 0x18E8, 0x10C7, 0x1908, 0x18E7, 0x0887, 0x9CF4, 
-0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xEFFC, 0xAE31, 
-0x856C, 0x7D6A, 0x7DAA, 0x85CB, 0x85CC, 0x85CC, 0x85AB, 0x7DAB, 0x85CB, 0x85CB, 0x7DCB, 0x85EC, 
-0x7D89, 0x7DAA, 0x856B, 0xB674, 0xF7FD, 0xF7DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0x9E9A, 0x5D99, 0x65B9, 0x65D9, 0x6DB9, 0x65B9, 0x65F9, 0xD77F, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB6FC, 0x6DB9, 0x6DFA, 0x6DDA, 0x6DFA, 0x661A, 0x6DD9, 
-0xCF5D, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xBDF9, 0x10C6, 0x1908, 0x18E7, 0x1928, 0x18E7, 0x0886, 0x94D4, 0xFFFF, 0xFFDF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFE, 0xDF99, 0x856D, 0x754A, 0x85CB, 0x85CB, 0x85AC, 
-0x7D8B, 0x7DAB, 0x85CB, 0x85CA, 0x85CB, 0x85CB, 0x85CC, 0x7DAC, 0x7D8B, 0x7DAB, 0x7DCA, 0x85EB, 
-0x754A, 0x9DEF, 0xEFBB, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9E9B, 
-0x65BA, 0x65DA, 0x65D9, 0x65DA, 0x5DD9, 0x6D99, 0xDF7E, 0xFFFF, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xB6DB, 0x6DB9, 0x65D9, 0x65F9, 0x65F8, 0x5DF9, 0x65B8, 0xCF5D, 0xFFDF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC61A, 0x10C6, 
-0x18E8, 0x10C8, 0x10C7, 0x1908, 0x0887, 0x9D15, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xE799, 0x8D8C, 0x7D8A, 0x7DEB, 0x7DAA, 0x7D8A, 0x858A, 0x860B, 0x7DAA, 0x7D6A, 
-0x7D6A, 0x7D6A, 0x7D8A, 0x7D8A, 0x7DAA, 0x85CB, 0x7D8B, 0x85AC, 0x7DCB, 0x7E0A, 0x7D8A, 0x958F, 
-0xF79B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x9E7B, 0x65BA, 0x65DA, 0x5DD9, 
-0x65FA, 0x5DD9, 0x65B8, 0xD79E, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xAEFB, 
-0x65D9, 0x65FA, 0x6619, 0x65F9, 0x5DFA, 0x65D9, 0xC75D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC61A, 0x1086, 0x18E8, 0x18E8, 0x1908, 
-0x1909, 0x0866, 0x94D4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFDE, 0x95B0, 
-0x7D6A, 0x85CB, 0x7DCB, 0x7DCB, 0x85EB, 0x85AA, 0x854B, 0x95CE, 0xAE72, 0xC6D6, 0xC6F7, 0xBED5, 
-0xA651, 0x95EE, 0x858A, 0x858B, 0x85CC, 0x7D8A, 0x7DAA, 0x85CB, 0x856C, 0xA652, 0xF7DE, 0xFFFF, 
-0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9E9A, 0x5D98, 0x65F9, 0x5DD9, 0x65DA, 0x65D9, 0x65D9, 
-0xCF7E, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xB6DC, 0x5DB9, 0x65FA, 0x65D9, 
-0x6DD9, 0x65DA, 0x6DD9, 0xC75D, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC619, 0x10A6, 0x18E8, 0x10C7, 0x1907, 0x18E7, 0x0886, 0x9CF4, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB6D3, 0x7D4B, 0x85AA, 0x85AB, 0x7D8B, 
-0x85CB, 0x756A, 0x960F, 0xDF39, 0xF7DD, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xF7BD, 0xBEF5, 
-0x85AD, 0x7D8A, 0x85CB, 0x858B, 0x858B, 0x7DAB, 0x758A, 0xDEFA, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0x9E9B, 0x5D99, 0x65D9, 0x65F9, 0x65DA, 0x65D9, 0x65D9, 0xD79E, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xAEFC, 0x65B9, 0x661A, 0x661A, 0x65F9, 0x65FA, 0x6DB9, 
-0xCF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 
-0xFFFF, 0xC63A, 0x10C6, 0x18E8, 0x18E8, 0x18E8, 0x18E8, 0x0866, 0x9CF4, 0xFFFF, 0xFFDF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFDF, 0xFFDF, 0xE7FC, 0x85CE, 0x7D6B, 0x85AA, 0x7DCB, 0x7DAB, 0x856B, 0xAE32, 0xEFDC, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE77C, 0x956F, 0x7D8A, 
-0x7DCB, 0x7DAB, 0x7D8A, 0x858B, 0x95F0, 0xFFFD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9E9B, 
-0x5D99, 0x65D9, 0x65F9, 0x65DA, 0x65D9, 0x65D9, 0xDF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xAEFC, 0x65B9, 0x6619, 0x65F9, 0x65D9, 0x65FA, 0x65B8, 0xCF7D, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC63A, 0x10C6, 
-0x18E8, 0x18E8, 0x18E8, 0x18E8, 0x0866, 0x9CF4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFDF, 0xFFFF, 
-0xC6F7, 0x754B, 0x85CB, 0x7D69, 0x7DAA, 0x85CC, 0x95CF, 0xEFDA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFF, 0xCF37, 0x8DAC, 0x7D8A, 0x7DAB, 0x85CB, 
-0x7D6A, 0x8D8D, 0xE79A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9E9B, 0x5DB9, 0x65D9, 0x65F9, 
-0x65DA, 0x65D9, 0x65D9, 0xDF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xAEFC, 
-0x65B9, 0x65F9, 0x65F9, 0x65D9, 0x65FA, 0x65B8, 0xCF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC63A, 0x10C6, 0x18E8, 0x18E8, 0x18E8, 
-0x18E8, 0x0866, 0x9D15, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFDF, 0xF7DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0xAE73, 0x758A, 0x85AB, 
-0x85AB, 0x7D8A, 0x858C, 0xBED5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFE, 0xFFFF, 0xF7FE, 0xAE51, 0x7D6B, 0x7D8A, 0x85CB, 0x7D8B, 0x7D4B, 0xCEF6, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9E9B, 0x5DB9, 0x65D9, 0x65F9, 0x65DA, 0x65D9, 0x6DD9, 
-0xDF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB6DC, 0x65B9, 0x65F9, 0x65FA, 
-0x6DF9, 0x661A, 0x65B8, 0xCF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xC63A, 0x10C6, 0x18E8, 0x18E8, 0x18E8, 0x18E8, 0x0866, 0x9CF4, 
-0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0x9DF0, 0x75AA, 0x7D6B, 0x85AC, 0x7DAA, 0x858C, 
-0xEFDC, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFE, 
-0xFFDF, 0xFFFF, 0xCF37, 0x856B, 0x7D8A, 0x7DAA, 0x85CC, 0x7D6A, 0xB674, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0x9E9B, 0x5DB9, 0x65D9, 0x65F9, 0x65DA, 0x65D9, 0x6DD9, 0xDF9E, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB6DC, 0x65B9, 0x65F9, 0x65F9, 0x6DF9, 0x65FA, 0x65B8, 
-0xCF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 
-0xFFFF, 0xC63A, 0x10C6, 0x18E8, 0x18E8, 0x18E8, 0x18E8, 0x0866, 0x9CD4, 0xFFFF, 0xFFFF, 0xFFDF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFFE, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFDE, 0x95CF, 0x758A, 0x7D8C, 0x7D8B, 0x7DAA, 0x95EF, 0xFFFE, 0xFFDF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xE7BA, 
-0x858C, 0x7DAB, 0x7DAB, 0x7DAB, 0x7D8A, 0xAE32, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9E9B, 
-0x5DB9, 0x65FA, 0x65F9, 0x65DA, 0x65D9, 0x6DD9, 0xDF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xB6FC, 0x65B9, 0x65F9, 0x65F9, 0x6DD9, 0x65FA, 0x65B8, 0xCF5D, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFE, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFE, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC63A, 0x10C6, 
-0x18E8, 0x18E8, 0x18E8, 0x18E8, 0x0866, 0x9CF4, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xFFFF, 0xFFFF, 0xF7DF, 0xFFFF, 0xF7FE, 
-0x8DAE, 0x7DAB, 0x85AC, 0x7DAC, 0x756A, 0x9E10, 0xFFFE, 0xFFFF, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFDB, 0x8DAD, 0x7DAA, 0x7DAC, 
-0x7DAB, 0x7D8A, 0xAE32, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9E9B, 0x5DB9, 0x65FA, 0x65F9, 
-0x65DA, 0x65D9, 0x6DD9, 0xDF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xB6DC, 
-0x65B9, 0x65D9, 0x65F9, 0x6DD9, 0x65FA, 0x65B8, 0xCF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xF7FF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 
-0xFFFF, 0xFFFF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BF, 0xE73D, 0xCE7A, 0xAD97, 0x9CF5, 0x9CF5, 0xAD77, 
-0xCE5A, 0xE75D, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0xC63A, 0x10C6, 0x18E8, 0x18E8, 0x18E8, 
-0x18E8, 0x0866, 0x9CF4, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7E, 0xC619, 
-0xA536, 0x9CF5, 0x9D16, 0xB5B8, 0xDEFC, 0xFFDF, 0xFFFF, 0xFFFF, 0xF7DE, 0x95EF, 0x756A, 0x7D8B, 
-0x7DAB, 0x7569, 0x95EF, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xE7BA, 0x85AC, 0x758B, 0x7DAC, 0x85AB, 0x756A, 0xAE53, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9EBB, 0x5DB9, 0x65FA, 0x65F9, 0x65DA, 0x65D9, 0x6DD9, 
-0xDF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xB6DC, 0x6599, 0x65D9, 0x65FA, 
-0x6DF9, 0x65FA, 0x65B8, 0xCF5D, 0xFFFF, 0xFFDF, 0xF7DE, 0xA67B, 0xA69B, 0x9E9B, 0x9E9B, 0x9E9B, 
-0x9639, 0xAEBB, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE7FF, 0xAE9A, 0x9E5A, 0x9E7A, 0x9E7B, 
-0x9E7B, 0x9E39, 0xB6DC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xDEBB, 0x94B4, 0x52AD, 0x2948, 0x10A6, 0x0886, 0x0886, 0x0866, 0x1087, 0x10A6, 0x2107, 0x4A6C, 
-0x9CF5, 0xE71D, 0xFFFF, 0xFFFF, 0xC63A, 0x10C6, 0x18E8, 0x18E8, 0x18E8, 0x18E8, 0x0866, 0x94D4, 
-0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xBDF7, 0x634E, 0x738F, 0x6B6F, 0x73B0, 0x632E, 
-0x9493, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC639, 0x634F, 0x2948, 0x10A6, 0x0886, 0x0866, 0x0866, 
-0x0885, 0x2105, 0x4A4A, 0xB5B7, 0xFFDF, 0xFFFF, 0x9E30, 0x7569, 0x7DAB, 0x7589, 0x7DAA, 0x8DAF, 
-0xEFBC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xDF79, 0x7D6B, 0x7DCC, 0x7DAC, 0x85AA, 0x7D6B, 0xB674, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFDF, 0xFFFF, 0x9E9B, 0x659A, 0x65B9, 0x5DF9, 0x65FA, 0x65D9, 0x6DB9, 0xDFBF, 0xFFFF, 0xFFDF, 
-0xFFFF, 0xFFDF, 0xFFFF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xEFDF, 0xE7BE, 0xE7BE, 0xE7DE, 
-0xEFFF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFDF, 0xC71C, 0xA69A, 0x75B8, 0x65D9, 0x5E1A, 0x65B8, 
-0xC75E, 0xFFFF, 0xFFDF, 0xFFFF, 0x963A, 0x5DF8, 0x5DF9, 0x6DF9, 0x6DB9, 0x6DFA, 0x5DB7, 0xC75D, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC73D, 0x65B7, 0x65D9, 0x6DB9, 0x6598, 0x5DD9, 0x5D97, 0xAEBB, 
-0xFFFE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0xE71D, 0x6B91, 0x1907, 0x10A6, 0x0865, 
-0x18E7, 0x18E8, 0x18E8, 0x18E8, 0x18E8, 0x1908, 0x1907, 0x08A6, 0x08A6, 0x08A6, 0x2127, 0x8C53, 
-0xFFFF, 0xCE7B, 0x10A5, 0x18E8, 0x18E8, 0x10C7, 0x1908, 0x0886, 0x9CD4, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0x94B4, 0x0004, 0x0886, 0x0866, 0x10A7, 0x0045, 0x39EA, 0xFFDF, 0xFFFF, 
-0xF7BE, 0x6B8F, 0x10A6, 0x0886, 0x10C7, 0x18E8, 0x1908, 0x18C8, 0x2107, 0x10E8, 0x10E8, 0x0044, 
-0x9493, 0xFFFF, 0xFFFE, 0xBE76, 0x7589, 0x7D8C, 0x7D8B, 0x7DCA, 0x7D6B, 0xD718, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFD, 0xB6B3, 
-0x7D8B, 0x7DAB, 0x858A, 0x85AB, 0x854B, 0xCEF8, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFF, 0xFFDE, 0x9EBA, 
-0x5DD9, 0x5DD9, 0x6DFA, 0x6599, 0x65FA, 0x6E19, 0xCF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xF7FF, 0xBF5D, 0xA6FB, 0x9679, 0x7E17, 0x75F6, 0x75D6, 0x75D6, 0x75F6, 0x7DB6, 0x8E18, 0x9E79, 
-0xB6FB, 0xD7BE, 0xF7FF, 0xFFFF, 0xFFFF, 0xEFBF, 0xA6DC, 0x6DD8, 0x6D57, 0xCF3E, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xC73D, 0x6DF8, 0x661A, 0x6DD9, 0x6DFA, 0x661A, 0x65D8, 0x9E7A, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0x9E9A, 0x65F8, 0x65F9, 0x6DFA, 0x65D9, 0x65F9, 0x75F8, 0xDF9E, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFDF, 0xFFFF, 0xFFFF, 0xA536, 0x2107, 0x0886, 0x10C7, 0x10C7, 0x2129, 0x10A7, 0x18E8, 0x18E8, 
-0x2128, 0x1908, 0x10C7, 0x10C7, 0x1908, 0x10C8, 0x10C8, 0x18E8, 0x0845, 0x5AED, 0xAD78, 0x18E7, 
-0x18E8, 0x10C7, 0x1908, 0x18E8, 0x0866, 0x9CD4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0x94B4, 0x0886, 0x1908, 0x18E8, 0x1909, 0x10A7, 0x39CA, 0xFFFF, 0xF79E, 0x4A6C, 0x0865, 0x18E8, 
-0x10C8, 0x1929, 0x10E7, 0x10C7, 0x1928, 0x1907, 0x10C8, 0x10E8, 0x1906, 0xE71D, 0xFFDF, 0xFFFE, 
-0xDF59, 0x7D89, 0x7D8B, 0x7D8B, 0x7DAB, 0x7D6A, 0xA610, 0xFFFD, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xEFDD, 0x856E, 0x7DAA, 0x7D8B, 0x7DAC, 
-0x758B, 0x8D8E, 0xE7BB, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0x9E79, 0x5DB8, 0x65FA, 0x65FA, 
-0x6DDA, 0x5DB8, 0x7DD8, 0xE7BF, 0xFFDF, 0xFFDE, 0xEFFF, 0xD7BD, 0xA6B9, 0x85F6, 0x6E16, 0x65F5, 
-0x5DD5, 0x5DF5, 0x5DF6, 0x5DF6, 0x5DF5, 0x5DD5, 0x6DD6, 0x65B5, 0x5DB5, 0x65B6, 0x6DB6, 0x85B6, 
-0xB699, 0xE7BE, 0xFFFF, 0xF7FF, 0xD79F, 0xAE5A, 0xCF3C, 0xF7FF, 0xFFFF, 0xFFFF, 0xEFDF, 0x8E19, 
-0x6619, 0x6DFA, 0x6DFA, 0x6619, 0x6E19, 0x75D8, 0xDFBE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xDFBE, 0x75D8, 0x6E19, 
-0x5E19, 0x6E19, 0x6DF9, 0x65D8, 0x9E5A, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFE, 0xFFFF, 0xFFFF, 0x73D1, 
-0x0845, 0x10C8, 0x18E7, 0x18E8, 0x10C7, 0x18E8, 0x1908, 0x18E8, 0x1908, 0x10C7, 0x18E8, 0x1908, 
-0x1908, 0x18E8, 0x2129, 0x10C8, 0x18C8, 0x18E8, 0x10A6, 0x2969, 0x2128, 0x10C7, 0x18E8, 0x18E8, 
-0x18E8, 0x1087, 0x9CD4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CD4, 0x0886, 0x10C8, 
-0x1908, 0x1908, 0x18E7, 0x31AA, 0xE75F, 0x5ACD, 0x0045, 0x1908, 0x10C8, 0x1909, 0x18E8, 0x18E7, 
-0x18E7, 0x18E7, 0x10C7, 0x2129, 0x08A6, 0x4A6B, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FE, 0x9E2F, 0x7D4A, 
-0x7DCB, 0x758B, 0x7D8A, 0x7D6A, 0xBED4, 0xFFFF, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFE, 0xFFFE, 0xFFDF, 0xEFFC, 0x95F0, 0x858C, 0x85AC, 0x7DAC, 0x758B, 0x758A, 0xB674, 0xFFFF, 
-0xFFFF, 0xFFBE, 0xFFFF, 0xFFDF, 0xFFFF, 0xA69A, 0x6579, 0x6DFB, 0x5DF9, 0x65B8, 0x8659, 0xDF7F, 
-0xFFDF, 0xFFDF, 0xD75C, 0x9677, 0x6DB4, 0x6DD5, 0x6E36, 0x75F7, 0x75D6, 0x6DD6, 0x6DD6, 0x6DD6, 
-0x6DD6, 0x6DD6, 0x75F7, 0x6DD6, 0x6DD6, 0x65D6, 0x65D6, 0x65F6, 0x6DD6, 0x6DB5, 0x75D6, 0xAEB9, 
-0xDF7E, 0xFFFF, 0xFFDF, 0xF7DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB6DC, 0x65D8, 0x6E1A, 0x6DF9, 
-0x5E39, 0x6E1A, 0x65B9, 0xB6FB, 0xFFFF, 0xFFFF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xFFDF, 0xFFFF, 0xB6FB, 0x65B8, 0x6DF9, 0x5E39, 0x65D9, 0x6DD9, 
-0x65B8, 0xC6FC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6B4F, 0x0845, 0x18E8, 0x18E9, 0x1907, 
-0x10E7, 0x18E8, 0x1908, 0x18E8, 0x18C8, 0x0886, 0x10A6, 0x0866, 0x0846, 0x1086, 0x10A6, 0x18E8, 
-0x1908, 0x18E8, 0x18E8, 0x1908, 0x10A7, 0x10C7, 0x10C7, 0x18E8, 0x1908, 0x18E8, 0x0866, 0x9CD4, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CD4, 0x0866, 0x18E8, 0x18E8, 0x18E8, 0x10A7, 
-0x298A, 0x6B51, 0x0845, 0x1908, 0x1908, 0x10E8, 0x1908, 0x18E8, 0x18E8, 0x1908, 0x10A7, 0x1908, 
-0x1908, 0x0885, 0x8431, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFE, 0xCEF8, 0x854C, 0x7DA9, 0x7DAB, 0x85CC, 
-0x758A, 0x752A, 0xB673, 0xEFDC, 0xFFFE, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFE, 0xEFBB, 
-0x9E2F, 0x7DAA, 0x7D8B, 0x7D6B, 0x7DCA, 0x7DAA, 0x858C, 0xE7BB, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xA6BB, 0x65BA, 0x65DA, 0x5DB8, 0x9E5A, 0xE7BE, 0xFFFF, 0xE7BE, 0xA699, 0x75F5, 
-0x7617, 0x6DD7, 0x5CF5, 0x4C74, 0x3BD3, 0x33D3, 0x33B2, 0x2B92, 0x3392, 0x3BD3, 0x4414, 0x4C55, 
-0x5515, 0x6597, 0x6DF8, 0x6DF7, 0x6DD6, 0x65D6, 0x65D6, 0x65F6, 0x6DD6, 0x75B5, 0xBEFB, 0xFFFF, 
-0xFFFF, 0xFFDE, 0xFFFF, 0xFFDF, 0xFFFF, 0xDFBF, 0x75F8, 0x6DFA, 0x6E19, 0x6619, 0x6DF9, 0x65DA, 
-0x8638, 0xF7FF, 0xFFFF, 0xF7FF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 
-0xF7FE, 0xFFFF, 0xF7FF, 0x8618, 0x65D9, 0x6DD9, 0x6619, 0x65D8, 0x65B8, 0x8639, 0xE7DF, 0xFFFF, 
-0xFFFF, 0xFFDE, 0xFFFF, 0x8C93, 0x0024, 0x2109, 0x10A7, 0x18E8, 0x10C7, 0x1908, 0x18E7, 0x0885, 
-0x0865, 0x2969, 0x528C, 0x6B70, 0x7BF2, 0x73B1, 0x52AD, 0x31A9, 0x10A5, 0x0886, 0x1908, 0x1908, 
-0x10C8, 0x294A, 0x10C7, 0x1908, 0x10C7, 0x1908, 0x1908, 0x0866, 0x9CD4, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFE, 0xFFFF, 0x9CD4, 0x0046, 0x2129, 0x10C8, 0x10C7, 0x18E8, 0x18E8, 0x18C8, 0x18E8, 
-0x10E7, 0x1908, 0x18E7, 0x0865, 0x0885, 0x18E7, 0x2108, 0x18E7, 0x10A5, 0x0865, 0x1085, 0xBDF8, 
-0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xB694, 0x7D6B, 0x7D89, 0x7D8A, 0x7DEC, 0x7DCB, 0x7D49, 
-0x95B0, 0xB674, 0xD758, 0xE79B, 0xE7BB, 0xDF79, 0xC6D6, 0xAE33, 0x856B, 0x758A, 0x7DAA, 0x85AC, 
-0x7D8A, 0x7DA8, 0x856B, 0xD719, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9EBB, 
-0x5599, 0x65D9, 0x9E9A, 0xF7FF, 0xFFFF, 0xC77B, 0x9637, 0x6D75, 0x5514, 0x3C13, 0x2B32, 0x2313, 
-0x2313, 0x2334, 0x2314, 0x2314, 0x2314, 0x2314, 0x2313, 0x22F3, 0x22F3, 0x22F1, 0x2B52, 0x3BF3, 
-0x54F5, 0x6DB7, 0x6E17, 0x6DF6, 0x65F6, 0x65D6, 0x6617, 0x65B6, 0x8E18, 0xDF9F, 0xFFFF, 0xFFDF, 
-0xFFFF, 0xFFFE, 0xF7FF, 0x9E7A, 0x6DB8, 0x6E3A, 0x65F8, 0x6DF9, 0x6DFA, 0x6DB7, 0xCF7E, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD79F, 
-0x6DB7, 0x6DFA, 0x6DD9, 0x6DF9, 0x6DD9, 0x6D97, 0xAEFB, 0xFFFF, 0xFFFF, 0xFFDD, 0xFFFF, 0xC63A, 
-0x0885, 0x1909, 0x18E8, 0x10E7, 0x10E7, 0x18E9, 0x18E8, 0x1086, 0x39CA, 0x9CF5, 0xE73D, 0xFFFF, 
-0xFFFF, 0xFFFE, 0xFFFF, 0xFFFF, 0xEF5E, 0xAD77, 0x528C, 0x1086, 0x18C8, 0x10E8, 0x10A7, 0x1908, 
-0x18E8, 0x18E7, 0x18E7, 0x18E8, 0x0886, 0x9CD4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFF, 
-0x9CD4, 0x0046, 0x18E8, 0x10C7, 0x18E8, 0x1909, 0x10A7, 0x1909, 0x10C8, 0x2129, 0x0865, 0x1906, 
-0x634F, 0xAD77, 0xCE7B, 0xD6BB, 0xD6BB, 0xBDD8, 0x8412, 0x630E, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFDF, 
-0xFFFF, 0xFFFF, 0xF7FD, 0xAE53, 0x7D4B, 0x7D8A, 0x758A, 0x7DCA, 0x85CA, 0x758A, 0x7D8A, 0x7D8B, 
-0x7D8B, 0x7D6C, 0x7D6B, 0x7D8B, 0x7D8A, 0x7DCA, 0x7DCC, 0x7DAC, 0x7D8B, 0x7D8A, 0x858D, 0xCEF7, 
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9EFC, 0x5D77, 0x9E7A, 0xF7FF, 
-0xF7FF, 0xBEFB, 0x7DD6, 0x5CF5, 0x3BF4, 0x3373, 0x3354, 0x3396, 0x33B7, 0x2BF7, 0x3BD7, 0x33B7, 
-0x33B7, 0x33B7, 0x33B7, 0x33B6, 0x3395, 0x2B55, 0x2B14, 0x2AF3, 0x22D1, 0x1AF0, 0x33B2, 0x4CB4, 
-0x6577, 0x6DF8, 0x65D6, 0x6DF7, 0x6618, 0x5DD6, 0x7E18, 0xC71D, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 
-0xCF3D, 0x75D8, 0x661A, 0x6DF9, 0x6E19, 0x6DFA, 0x65D8, 0x9E9B, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xA6BB, 0x65B8, 0x6DF9, 0x6DF8, 
-0x6DD9, 0x65D9, 0x8619, 0xDF9D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0x422B, 0x10A7, 0x10C8, 0x10E8, 
-0x18E7, 0x18E7, 0x18E8, 0x10A6, 0x6B70, 0xF79F, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFF, 0xFFFE, 0xFFDE, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x9495, 0x18C7, 0x18E8, 0x2129, 0x18C7, 0x18E8, 0x1908, 0x18E8, 
-0x18E8, 0x0866, 0x9CD4, 0xFFFF, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0x9CF5, 0x0886, 0x18E8, 
-0x18E8, 0x18E8, 0x10C8, 0x1908, 0x10C7, 0x1908, 0x0865, 0x528D, 0xD69B, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFFF, 
-0xF7FE, 0xC735, 0x8DEC, 0x7D89, 0x85EB, 0x75AA, 0x7DCA, 0x7DAB, 0x7DAB, 0x7DCC, 0x7DCC, 0x7DAB, 
-0x7DCB, 0x7DCB, 0x7DAA, 0x85CC, 0x756A, 0x7DCA, 0x962E, 0xE7DB, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFBF, 0xFFFF, 0x969A, 0x95F9, 0xFFDF, 0xFFFF, 0xB6FB, 0x5D95, 0x3BF3, 
-0x2B74, 0x3396, 0x33D7, 0x2B96, 0x2B97, 0x2B96, 0x3374, 0x2376, 0x2B76, 0x2B96, 0x2BB7, 0x2BB7, 
-0x33D7, 0x33D7, 0x33D7, 0x33F6, 0x2B95, 0x2B34, 0x2AF4, 0x22B2, 0x22D0, 0x33B2, 0x5CF6, 0x75F9, 
-0x6DD7, 0x65F7, 0x6E17, 0x65F6, 0x6DB5, 0xB6DA, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0x8639, 0x5DF9, 
-0x6E19, 0x6619, 0x6E19, 0x6DFA, 0x75D8, 0xE7DF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xEFFF, 0x7DF8, 0x65D9, 0x6DF8, 0x65F8, 0x75FA, 0x65B9, 0xA6DC, 
-0xFFFF, 0xFFDE, 0xFFDF, 0xFFFF, 0xAD77, 0x0865, 0x18E8, 0x10E7, 0x18E7, 0x18E8, 0x1908, 0x08A4, 
-0x7C11, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDE, 
-0xFFFF, 0xFFFF, 0xA535, 0x10C7, 0x18E7, 0x18C7, 0x18E8, 0x18C8, 0x10C7, 0x1928, 0x0886, 0x9CD4, 
-0xFFFF, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0x9CF5, 0x0866, 0x18E8, 0x18E8, 0x10C7, 0x18E8, 
-0x18E8, 0x1928, 0x0886, 0x5AED, 0xF7DF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFBF, 0xFFFF, 0xFFDE, 
-0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFF, 0xEF7C, 0xB694, 0x85AD, 
-0x858A, 0x7D8A, 0x7DCC, 0x858A, 0x85AB, 0x85CB, 0x7DAB, 0x7DAB, 0x85CB, 0x85AB, 0x7DAA, 0x85AA, 
-0x85AA, 0x7DCA, 0x7DAA, 0x95ED, 0xC674, 0xF7BD, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xBEDB, 0xDF9E, 0xFFFF, 0xBEDA, 0x5514, 0x3394, 0x2395, 0x33B6, 0x4BF6, 0x6477, 
-0x8538, 0x9DDA, 0x9DB9, 0xA5FA, 0x95B9, 0x7D38, 0x6CB8, 0x43F6, 0x2B75, 0x3397, 0x3397, 0x33B7, 
-0x33B6, 0x33F7, 0x2BB5, 0x3394, 0x2B12, 0x22D2, 0x2313, 0x1AD1, 0x4434, 0x6DB8, 0x6DF7, 0x5DF6, 
-0x6638, 0x65D8, 0x75D7, 0x9EB9, 0xF7FF, 0xFFFF, 0xFFFF, 0xBF1C, 0x65B7, 0x5E1A, 0x661A, 0x6DD9, 
-0x6DFA, 0x5DF8, 0xBF1D, 0xFFBF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFE, 0xFFFF, 0xF7FF, 0xFFFF, 
-0xFFDF, 0xC71D, 0x65D8, 0x6DD9, 0x6DD8, 0x75F9, 0x6D98, 0x9E7A, 0xF7FF, 0xFFFF, 0xFFDF, 0xFFFF, 
-0xFFFF, 0x52AD, 0x0886, 0x18E8, 0x10C7, 0x10E8, 0x1909, 0x0866, 0x630D, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0x7BD0, 0x1085, 0x18E8, 0x10C8, 0x18E8, 0x18E8, 0x18E8, 0x0866, 0x9CD5, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0x9CF5, 0x0866, 0x18E8, 0x18E7, 0x18C8, 0x10C8, 0x1929, 0x10A6, 0x39E9, 
-0xF7BE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xC6F6, 0x85ED, 0x758A, 0x858A, 0x856B, 0x85EC, 0x75EB, 
-0x7DCB, 0x7DCB, 0x7DAA, 0x7D8A, 0x7D8B, 0x7DAB, 0x7DAB, 0x7DAB, 0x7DEC, 0x7DAA, 0x85AB, 0x7D8C, 
-0x7D8B, 0x7589, 0x8DCE, 0xCF38, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFE, 
-0xFFFE, 0xBF3C, 0x5495, 0x2B32, 0x4BF5, 0x7CB6, 0xB65C, 0xE7BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFBF, 0xBEBC, 0x7D38, 0x4415, 0x2B94, 0x2B97, 0x3BB5, 0x3BD5, 
-0x2B96, 0x33D7, 0x2B33, 0x22B0, 0x2B53, 0x1AD0, 0x2B72, 0x6557, 0x6E18, 0x6618, 0x65F7, 0x65D7, 
-0x6DB7, 0xA6BA, 0xF7FF, 0xFFDF, 0xEFDF, 0x75D8, 0x5DFA, 0x661A, 0x6E18, 0x65FA, 0x5E18, 0x8E59, 
-0xF7FF, 0xFFFF, 0xF7FF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9699, 0x5DF7, 
-0x6DB8, 0x5E19, 0x5DB7, 0x9639, 0xF7FF, 0xE79F, 0xE7DE, 0xFFFF, 0xFFDF, 0xDEDC, 0x2127, 0x10A7, 
-0x1928, 0x10C7, 0x18E8, 0x18E8, 0x2108, 0xD69B, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71D, 0x3188, 0x18C7, 
-0x1909, 0x18E8, 0x10C7, 0x2129, 0x0846, 0x9CD4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0x9CF5, 0x0866, 0x18E7, 0x18E7, 0x10C7, 0x10E8, 0x18E8, 0x10A5, 0xBDD8, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFE, 0xBEB3, 0x7D2B, 0x7D8B, 0x7DCC, 0x7DAB, 0x85CA, 0x7D89, 0x7DAA, 0x7D6A, 0x8DAC, 0x95EE, 
-0x9E10, 0xA630, 0x9E0F, 0x95CD, 0x8DAB, 0x7D4A, 0x7DAA, 0x7DCA, 0x85EC, 0x756B, 0x8DEB, 0x7D8A, 
-0x7D4C, 0xC6B5, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFDE, 0xE79E, 0x54D5, 0x2B53, 
-0x84F9, 0xC73E, 0xFFFF, 0xFFFF, 0xFFDF, 0xD6BA, 0xB575, 0x9CD4, 0x8C52, 0x8412, 0x94B4, 0xB576, 
-0xDE9A, 0xFFBE, 0xFFFF, 0xFFFF, 0xDF9F, 0x95D9, 0x4BB4, 0x3375, 0x33B6, 0x2B97, 0x3396, 0x3BD6, 
-0x2B54, 0x2312, 0x22F1, 0x22F2, 0x2B12, 0x5D17, 0x6E18, 0x65F6, 0x5DD7, 0x65FA, 0x5D76, 0x9EBA, 
-0xEFFF, 0xFFDF, 0xD73E, 0x7E19, 0x5DD8, 0x65F8, 0x6DDA, 0x6E19, 0x6DB7, 0xD77E, 0xFFFF, 0xFFFE, 
-0xFFFF, 0xFFFF, 0xFFBF, 0xF7DF, 0xF7FE, 0xFFFF, 0xDFBF, 0x6DD7, 0x65F8, 0x75F9, 0x65D8, 0x9E7A, 
-0xF7FF, 0xE77D, 0xB69A, 0xF7FF, 0xFFDE, 0xFFFF, 0xA536, 0x0865, 0x18E8, 0x10E7, 0x18E7, 0x1908, 
-0x0886, 0x6B70, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x634F, 0x0865, 0x10C8, 0x18E8, 0x10C7, 
-0x2129, 0x0866, 0x9CD4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CF5, 0x0866, 0x1908, 
-0x10C7, 0x18E8, 0x10C8, 0x08A6, 0x422B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FE, 0xB694, 0x6D48, 0x85CB, 
-0x85AB, 0x7DAB, 0x75CB, 0x7DEA, 0x858B, 0xA5EF, 0xCEF7, 0xDF7A, 0xF7FD, 0xFFFF, 0xFFFF, 0xF7FE, 
-0xEFBC, 0xDF59, 0xBE94, 0x8DAE, 0x7D8B, 0x7DAB, 0x7D8A, 0x7D8A, 0x85CA, 0x7DEB, 0x8D8B, 0xCEF7, 
-0xFFFF, 0xFFFF, 0xFFFE, 0xFFFE, 0xFFDE, 0xF7FF, 0x6D37, 0x3BD2, 0xBEBC, 0xFFFF, 0xFFFF, 0xD69B, 
-0x73B0, 0x39C9, 0x10A5, 0x0024, 0x0024, 0x0003, 0x0043, 0x0025, 0x0045, 0x18C6, 0x39CA, 0x7B90, 
-0xCE59, 0xFFFF, 0xFFBE, 0xDF3E, 0x6476, 0x2334, 0x3BD7, 0x3396, 0x33B6, 0x33D6, 0x2B75, 0x2B53, 
-0x22F3, 0x22D3, 0x2311, 0x54F6, 0x6DF8, 0x6618, 0x5DF9, 0x65F9, 0x55B7, 0x8E9A, 0xEFFF, 0xFFBE, 
-0xE79D, 0x8E59, 0x65B9, 0x6DD9, 0x6E1A, 0x65D9, 0xA6BB, 0xFFDF, 0xFFDD, 0xFFFE, 0xFFFF, 0xFFDF, 
-0xFFFF, 0xFFFF, 0xFFDF, 0xB6DC, 0x65D9, 0x6DF9, 0x6DB9, 0xBEBC, 0xF7FF, 0xE7DF, 0x8555, 0xDF7D, 
-0xFFDF, 0xFFFF, 0xFFFF, 0x73B1, 0x1086, 0x18E8, 0x10C7, 0x18E7, 0x1908, 0x10A6, 0xBE1A, 0xFFFF, 
-0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xAD77, 0x1085, 0x18E8, 0x1908, 0x10C7, 0x18E8, 0x0866, 0x94D4, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CF5, 0x0866, 0x1908, 0x10C7, 0x1908, 0x18E8, 
-0x0865, 0x8453, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 
-0xFFFF, 0xF7DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCF17, 0x754B, 0x7DCB, 0x7DAB, 0x7D8B, 0x85CB, 0x7DCB, 
-0x7D8C, 0xC6F7, 0xF7BD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xEFDC, 0xA673, 0x856C, 0x85EC, 0x7D8B, 0x7DAB, 0x7DAB, 0x7D89, 0x8D6E, 0xE79C, 0xF7DE, 0xFFFF, 
-0xFFFE, 0xFFFF, 0x95F8, 0x5493, 0xDF9F, 0xFFDE, 0xD679, 0x62EE, 0x1085, 0x2948, 0x39C9, 0x39EA, 
-0x420B, 0x4A2B, 0x4A4B, 0x4A2A, 0x4A4A, 0x420A, 0x3A0A, 0x31E9, 0x31C9, 0x424A, 0x9492, 0xFFBE, 
-0xFFFF, 0xF7FF, 0x95B9, 0x2B33, 0x33D6, 0x33B6, 0x33D7, 0x2BD7, 0x2B53, 0x2313, 0x2313, 0x22F3, 
-0x1AD0, 0x54F7, 0x6E19, 0x5DD7, 0x5DF9, 0x65D9, 0x65B8, 0x8638, 0xD79D, 0xFFFF, 0xFFFF, 0xB71D, 
-0x7E59, 0x6DD8, 0x5DD8, 0x7E19, 0xEFDF, 0xFFFF, 0xF7FE, 0xFFFF, 0xF7FF, 0xFFFF, 0xFFBE, 0xEFDF, 
-0x7638, 0x65D7, 0x9E5A, 0xD75E, 0xFFFF, 0xDFDF, 0x7DD7, 0x8D76, 0xFFFF, 0xFFFF, 0xF7DF, 0xFFFE, 
-0x52AD, 0x0886, 0x1908, 0x1908, 0x10E7, 0x10C7, 0x3189, 0xEF7E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xD69B, 0x10C6, 0x2109, 0x18E8, 0x10C7, 0x1908, 0x0846, 0x94D4, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0x9CF5, 0x0866, 0x18E8, 0x18E8, 0x10C7, 0x1908, 0x0886, 0xA536, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFDF, 0xEFBC, 0x8D8F, 0x75AA, 0x7DCC, 0x7DAC, 0x7DAB, 0x7DA9, 0x856B, 0xDF9A, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xC6D5, 
-0x856C, 0x8DEC, 0x7D8B, 0x85CD, 0x7DCB, 0x7D6B, 0xA632, 0xF7FE, 0xFFDF, 0xFFFF, 0xD73E, 0x84F5, 
-0xEF9F, 0xFFBF, 0x9494, 0x1907, 0x0866, 0x10C7, 0xC67C, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0xFFFF, 
-0xFFDF, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xEF7E, 0xF7DF, 0xF7FF, 0xFFFE, 0xFFFF, 
-0xBE9C, 0x3353, 0x2B96, 0x33B7, 0x3396, 0x33D5, 0x2374, 0x2333, 0x22F3, 0x22D2, 0x22F1, 0x54F6, 
-0x6DF8, 0x65F9, 0x6DB9, 0x6DD9, 0x5DD8, 0x6DF8, 0xB6FC, 0xF7FF, 0xFFFF, 0xEFFF, 0xC6FC, 0x9639, 
-0x7D96, 0xC6DC, 0xFFFF, 0xF7DF, 0xFFDF, 0xFFDE, 0xFFFF, 0xFFFF, 0xD77D, 0x9E79, 0xCF5D, 0xFFFF, 
-0xFFFE, 0xC77C, 0x75D8, 0x4C52, 0xDFBE, 0xF7FF, 0xFFFF, 0xFFFF, 0xF7DE, 0x3A0B, 0x0886, 0x18E8, 
-0x18E8, 0x1908, 0x0886, 0x528D, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEDC, 0x2128, 
-0x10A7, 0x18E8, 0x18E8, 0x1908, 0x0866, 0x94B4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0x9CF5, 0x0866, 0x18E8, 0x18C7, 0x18E8, 0x18E8, 0x10C6, 0xB5D8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC6D6, 0x750B, 
-0x7DEB, 0x7DAB, 0x7DAB, 0x7DEB, 0x7D6A, 0xD777, 0xFFFF, 0xFFBF, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFDF, 
-0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xB694, 0x7D6B, 0x8DEB, 
-0x7D8A, 0x7DAC, 0x85CA, 0x856B, 0xDF9B, 0xFFFF, 0xFFFF, 0xA5B7, 0xEFDF, 0xFFDF, 0x62CE, 0x0046, 
-0x08C8, 0x10E8, 0x10C7, 0xCE9C, 0xF7DF, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0xC6DD, 0x3BB4, 
-0x33B6, 0x3B95, 0x33B6, 0x33D6, 0x2B74, 0x2313, 0x22F3, 0x22F2, 0x22F1, 0x4C96, 0x6DFA, 0x65D9, 
-0x65D9, 0x65FA, 0x5DFA, 0x65D9, 0x85D8, 0xD73D, 0xFFFF, 0xFFFF, 0xFFFF, 0xE79E, 0xE79E, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xDF9E, 0x9EB9, 0x65B8, 0x3B90, 
-0xA5F9, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xEFDF, 0x31CA, 0x10A7, 0x10C8, 0x10A7, 0x1908, 0x0886, 
-0x5AEE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71D, 0x3189, 0x10A7, 0x18E8, 0x1908, 
-0x18E8, 0x0866, 0x94B4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CF5, 0x0865, 0x1908, 
-0x10A7, 0x18E8, 0x18E8, 0x10A6, 0xC639, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FE, 0x9DF0, 0x7D8A, 0x75AA, 0x85CB, 0x7DAA, 
-0x7D8A, 0xAE72, 0xF7FE, 0xFFDF, 0xFFFF, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFDF, 0xFFFF, 0xF7FD, 0x95CF, 0x7D8A, 0x85EB, 0x7DAC, 0x7DAA, 
-0x858B, 0xB674, 0xFFFF, 0xDF5E, 0xEF9D, 0xE75C, 0x3A2A, 0x0065, 0x18E8, 0x18E8, 0x10C8, 0x18E6, 
-0xCE7A, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBE9B, 0x4393, 0x2B97, 0x3396, 
-0x33B6, 0x2BD5, 0x2B74, 0x2312, 0x22D2, 0x22F3, 0x1AD2, 0x3C74, 0x65FA, 0x6E1A, 0x65B9, 0x65F9, 
-0x65F9, 0x5DD9, 0x5DD9, 0x8639, 0xB6BB, 0xE79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFF, 
-0xFFDF, 0xFFFF, 0xEFDF, 0xCF5C, 0x9679, 0x7E19, 0x5D78, 0x2B54, 0x7475, 0xFFFF, 0xFFBF, 0xFFDE, 
-0xFFFF, 0xFFFF, 0xF77E, 0x31AA, 0x10A7, 0x18E8, 0x18E7, 0x18E8, 0x1087, 0x5AEE, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71D, 0x2128, 0x18E8, 0x10C8, 0x18E7, 0x1908, 0x0866, 0x94B4, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CF5, 0x0865, 0x2108, 0x18E7, 0x10C7, 0x1909, 
-0x10A6, 0xBDD8, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFDE, 0xFFFF, 0xFFFF, 0xE7BC, 0x858C, 0x7DAA, 0x7DAB, 0x758C, 0x7DCA, 0x7D6B, 0xD759, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFE, 0xFFFF, 0xFFFF, 0xC6D5, 0x856B, 0x75CC, 0x85AC, 0x85AB, 0x858B, 0x9DF0, 0xF7FD, 
-0xFFDF, 0xFFFF, 0x634F, 0x0046, 0x1908, 0x10C7, 0x18C8, 0x10C7, 0x10C7, 0xCE7A, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFDF, 0xFFFF, 0xFFFF, 0xF7DF, 0xFFFF, 0xFFFE, 0xB67B, 0x3B74, 0x3397, 0x33B7, 0x33D5, 0x2BD5, 
-0x2B74, 0x2313, 0x22D2, 0x2AF2, 0x1AB1, 0x33D4, 0x5D38, 0x6E1A, 0x661A, 0x65D9, 0x65FA, 0x65DB, 
-0x65B9, 0x6599, 0x6DB8, 0x7E19, 0x967B, 0xA6DB, 0xAEDC, 0xB6DC, 0xAEDB, 0xA69B, 0x8E3B, 0x75D9, 
-0x65B7, 0x6DF7, 0x54F7, 0x2334, 0x5372, 0xDF5F, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 
-0x39EA, 0x10A6, 0x18E7, 0x1907, 0x1908, 0x0886, 0x528C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 
-0xFFFE, 0xE71D, 0x2108, 0x10C8, 0x18E8, 0x10C7, 0x1908, 0x0866, 0x94B4, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFE, 0xFFFF, 0x9CF5, 0x0866, 0x18E7, 0x18E7, 0x10C8, 0x1908, 0x10C6, 0xBDF9, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 
-0xCF38, 0x7D8A, 0x7DCA, 0x858B, 0x7DAB, 0x7DAA, 0x95CF, 0xEFBD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xE79A, 0x8D8D, 0x7DCB, 0x7DAB, 0x85CB, 0x7DAB, 0x85AD, 0xEFBC, 0xFFDF, 0xFFFF, 0x634F, 
-0x0866, 0x1908, 0x10E8, 0x18E8, 0x10E7, 0x10C7, 0xCE7A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFE, 0xF7FF, 0xAE5C, 0x2BB4, 0x2B95, 0x33B7, 0x3397, 0x33B7, 0x2B54, 0x2B53, 
-0x22F1, 0x2B13, 0x22D2, 0x2332, 0x4455, 0x5D79, 0x6DFA, 0x6E1A, 0x65D8, 0x5DD9, 0x65D9, 0x5DD9, 
-0x5DD8, 0x5D98, 0x5D98, 0x5D98, 0x5D98, 0x6577, 0x6599, 0x65B8, 0x6E19, 0x6D98, 0x3BD4, 0x22F2, 
-0x2B53, 0xC6BD, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0x424B, 0x10A6, 0x18E7, 
-0x10E7, 0x10E7, 0x10A7, 0x39EA, 0xEF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE5A, 0x18E7, 
-0x18E8, 0x10C7, 0x1908, 0x18E8, 0x0866, 0x94D4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFF, 
-0x9CF5, 0x0866, 0x18E7, 0x18E7, 0x10C8, 0x1908, 0x10C6, 0xBDF9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC6F7, 0x7D8A, 0x7DA9, 
-0x7D8C, 0x7DAB, 0x758A, 0x9DEF, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7FD, 0x95CE, 
-0x7DAB, 0x7DAC, 0x85AB, 0x7DAB, 0x85AD, 0xDF5B, 0xFFFF, 0xFFFF, 0x632F, 0x0866, 0x1908, 0x10E8, 
-0x18E8, 0x18E7, 0x10C7, 0xCE7A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xBDD7, 
-0xEF5D, 0xF7DF, 0x961A, 0x3BB3, 0x3396, 0x33D8, 0x2B96, 0x33B5, 0x3395, 0x1B13, 0x22D2, 0x22F2, 
-0x22D2, 0x1AD2, 0x2B53, 0x4455, 0x5D58, 0x6DF9, 0x75FA, 0x761A, 0x761A, 0x6E1A, 0x65FA, 0x661A, 
-0x661B, 0x661A, 0x5E1A, 0x65D9, 0x5D18, 0x3C15, 0x1B14, 0x1AF4, 0x3B52, 0xAE5A, 0xF7FF, 0xFFFF, 
-0xFFFE, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x634F, 0x10A6, 0x1908, 0x1907, 0x18E8, 0x18E8, 
-0x2107, 0xCE9B, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xB597, 0x1085, 0x18E8, 0x10E8, 0x18E8, 
-0x18E8, 0x0866, 0x94D4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFF, 0x9CD4, 0x0866, 0x18E7, 
-0x18E7, 0x10C8, 0x1908, 0x10C6, 0xBDF9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBEB5, 0x7D8A, 0x7DCA, 0x7DAC, 0x7DCB, 0x7D8A, 
-0x9E10, 0xF7FD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FD, 0x95EF, 0x7D8A, 0x85AC, 0x7D8A, 
-0x85CB, 0x85AD, 0xD73A, 0xFFFF, 0xFFFF, 0x632F, 0x0866, 0x1908, 0x18E8, 0x18E8, 0x18E7, 0x10C7, 
-0xCE7A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x7390, 0x4A2A, 0xFFFF, 0xFFFF, 
-0xA61A, 0x3393, 0x2BB6, 0x33F8, 0x3396, 0x33B6, 0x33D6, 0x2B53, 0x2313, 0x22D2, 0x22F2, 0x22F2, 
-0x1AD1, 0x1AF1, 0x2B73, 0x3C55, 0x4496, 0x54F7, 0x5538, 0x5D38, 0x5538, 0x54F7, 0x4CB6, 0x3C15, 
-0x2B71, 0x22F1, 0x1291, 0x2334, 0x43D4, 0xB67B, 0xFFDF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFFF, 0xF7DE, 
-0xFFFF, 0xFFFF, 0xFFFF, 0x8C73, 0x0865, 0x18E8, 0x10C7, 0x18E8, 0x1908, 0x0885, 0x8C94, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7C11, 0x0864, 0x18E8, 0x1908, 0x10C7, 0x18E8, 0x0866, 0x94D4, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFF, 0x9CD4, 0x0866, 0x1908, 0x18E7, 0x10C8, 0x1908, 
-0x10C6, 0xBDF9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xC6D6, 0x7D6A, 0x7DEA, 0x7D8B, 0x7DAB, 0x7D8A, 0x95EF, 0xF7DC, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xEFBC, 0x95CE, 0x7DAA, 0x7DAC, 0x7D8B, 0x85CC, 0x858C, 0xDF7A, 
-0xFFFF, 0xFFFF, 0x632F, 0x0866, 0x18E7, 0x18E8, 0x18C8, 0x18E7, 0x10C7, 0xCE5A, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFDF, 0xFFFF, 0xFFDD, 0xFFFF, 0x8453, 0x0003, 0x630E, 0xFFBD, 0xFFFF, 0xB69D, 0x43D5, 
-0x2B75, 0x33B7, 0x2BB7, 0x2BB5, 0x2BB6, 0x33B6, 0x2B74, 0x22F2, 0x22F2, 0x2B13, 0x22F3, 0x22F3, 
-0x1AB1, 0x22F2, 0x2313, 0x2313, 0x2312, 0x22F2, 0x22D1, 0x1AB1, 0x1A71, 0x2313, 0x2B75, 0x3395, 
-0x5415, 0xBE9B, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 
-0xC639, 0x10C6, 0x18E8, 0x18E7, 0x10C7, 0x1908, 0x10A7, 0x39EA, 0xF7BE, 0xFFFF, 0xFFFE, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFDF, 
-0xF7DF, 0x31A9, 0x10A6, 0x1908, 0x10E8, 0x18E8, 0x18E8, 0x0866, 0x94D4, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFE, 0xFFFF, 0x9CD4, 0x0866, 0x1908, 0x18E7, 0x10C8, 0x1908, 0x10A6, 0xBDF9, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xD738, 0x7D4B, 0x7DCA, 0x7DAB, 0x7DAB, 0x758A, 0x858D, 0xEFFB, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 
-0xFFFF, 0xDF7A, 0x8DAD, 0x7DAB, 0x7DAC, 0x85AB, 0x85CC, 0x858D, 0xEFBC, 0xFFFF, 0xFFFF, 0x630F, 
-0x0866, 0x18E7, 0x18E8, 0x10C8, 0x18E7, 0x10C7, 0xCE5A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFD, 0xFFFF, 0x73D2, 0x0866, 0x0866, 0x528C, 0xF77E, 0xFFFF, 0xD71D, 0x5C54, 0x2B73, 0x2B96, 
-0x33D8, 0x33D8, 0x2BB7, 0x2B95, 0x33B5, 0x3394, 0x2333, 0x22F2, 0x22F3, 0x2AF2, 0x2AF2, 0x22D2, 
-0x22B2, 0x22D2, 0x22D3, 0x2AF3, 0x2B14, 0x2B95, 0x2B76, 0x3335, 0x5C35, 0xCF1E, 0xFFFF, 0xF79E, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x39C9, 0x10A6, 
-0x2128, 0x10C7, 0x18E8, 0x18E8, 0x0885, 0x94B4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x94D6, 0x0885, 0x18E7, 
-0x18E8, 0x10C7, 0x18E8, 0x1908, 0x0866, 0x94D4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0x9CD4, 0x0866, 0x1908, 0x18E7, 0x10C8, 0x1908, 0x10A6, 0xBDF9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE79B, 0x856C, 0x7DAA, 
-0x7DAB, 0x7DAB, 0x7DAB, 0x7D6B, 0xC6F5, 0xFFFE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFE, 0xBEB4, 0x858B, 
-0x7DAB, 0x7DAC, 0x85AB, 0x7D8C, 0x95CF, 0xF7FE, 0xFFFF, 0xFFFF, 0x630F, 0x0866, 0x10E7, 0x18E8, 
-0x10C8, 0x18E7, 0x10C7, 0xCE5A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8412, 
-0x0025, 0x1909, 0x0886, 0x39CA, 0xD67B, 0xFFFF, 0xEFDF, 0x9DD9, 0x43B4, 0x2B14, 0x2B76, 0x33B7, 
-0x3BF7, 0x33F7, 0x33B6, 0x33B5, 0x33B6, 0x33B5, 0x2B94, 0x2373, 0x2374, 0x2B94, 0x2BB5, 0x2BB5, 
-0x2BB5, 0x2BB5, 0x2B74, 0x4BD5, 0xA5DA, 0xF7FF, 0xFFFF, 0xA556, 0x9CF5, 0xFFFF, 0xFFDF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x8412, 0x0865, 0x1907, 0x10E7, 0x10C8, 
-0x1908, 0x10C6, 0x1907, 0xC63A, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xF7BF, 0xFFDF, 0xDEDC, 0x2969, 0x10A7, 0x18E7, 0x10C7, 0x10E8, 0x10E8, 
-0x1908, 0x0866, 0x94D4, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CD4, 0x0866, 0x1908, 
-0x18E7, 0x10C8, 0x1908, 0x10A6, 0xBDF9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FD, 0x9E10, 0x7D8A, 0x7DAB, 0x85AB, 0x7DCB, 
-0x758B, 0x8DAE, 0xEFFC, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFE, 0xFFBF, 0xFFFF, 0xFFFE, 0xE7FB, 0x8DAE, 0x7DAB, 0x7DAB, 0x7DCB, 0x85AB, 
-0x7D8C, 0xB693, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B0F, 0x0886, 0x10E7, 0x1908, 0x10C8, 0x18E7, 0x10C7, 
-0xC659, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0x83F1, 0x0844, 0x10C7, 0x18C7, 
-0x0886, 0x1107, 0x94D5, 0xFFDF, 0xFFDF, 0xD73E, 0x8599, 0x43D6, 0x3374, 0x2B55, 0x2B96, 0x2BB7, 
-0x33D7, 0x33F7, 0x33D6, 0x33D8, 0x33D8, 0x33D7, 0x33B7, 0x2B75, 0x2B74, 0x33B5, 0x4416, 0x957A, 
-0xD75E, 0xFFFE, 0xFFDF, 0x8433, 0x18E6, 0xDEBB, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFD, 0x2128, 0x10C7, 0x1907, 0x1908, 0x10C7, 0x1908, 0x10C7, 
-0x2968, 0xC639, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 
-0xFFFF, 0xDEDC, 0x39C8, 0x0887, 0x18E8, 0x18E7, 0x1908, 0x10C7, 0x1908, 0x10E8, 0x0886, 0x94D4, 
-0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CD4, 0x0866, 0x1908, 0x18E7, 0x10C8, 0x1908, 
-0x10A6, 0xBDF9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xB6B3, 0x7D6A, 0x7DAB, 0x858B, 0x75AA, 0x75CA, 0x7D6C, 0xB634, 
-0xF7FE, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFE, 
-0xFFFF, 0xFFFF, 0xF7FD, 0xAE52, 0x7D6B, 0x7DCA, 0x7DCC, 0x7DAB, 0x858B, 0x7D6C, 0xCF57, 0xFFFF, 
-0xFFFF, 0xFFFF, 0x630E, 0x0865, 0x18E7, 0x10C7, 0x18C8, 0x18C8, 0x10C6, 0xC63A, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7BD1, 0x0865, 0x18E8, 0x10A7, 0x18E8, 0x10E8, 0x0885, 
-0xB5B8, 0xFFFF, 0xFFFF, 0xFFFF, 0xD75E, 0xAE3A, 0x74B6, 0x4BD4, 0x3B94, 0x2B74, 0x2B74, 0x2B95, 
-0x2394, 0x2B95, 0x3395, 0x3355, 0x5C36, 0x74D6, 0xAE3A, 0xEFFF, 0xFFFF, 0xFFFF, 0xBDF9, 0x3A0C, 
-0x0024, 0x5AED, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFE, 0xFFFF, 0x83F1, 0x1065, 0x2108, 0x18C8, 0x18E7, 0x18E7, 0x18E8, 0x10A6, 0x1907, 0x8432, 
-0xEF7E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BF, 0x9D15, 0x2168, 0x0886, 
-0x1907, 0x10C6, 0x1907, 0x10C7, 0x18E7, 0x10C7, 0x18E8, 0x0886, 0x9CD4, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0x9CD4, 0x0065, 0x18E8, 0x18E7, 0x10C7, 0x1107, 0x10E5, 0xB5B7, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFDE, 0xEFBB, 0x858D, 0x7DCA, 0x7DAB, 0x7DAB, 0x75CC, 0x75AB, 0x758B, 0xAE92, 0xEFFC, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBF, 0xFFFF, 0xE7DC, 0x9E52, 
-0x758B, 0x7DCA, 0x7DCB, 0x7D8C, 0x7DEB, 0x7D8B, 0x9DD0, 0xF7FE, 0xFFFF, 0xFFDF, 0xFFDF, 0x630F, 
-0x0887, 0x18E8, 0x10C8, 0x18E9, 0x2129, 0x10C6, 0xC65A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0x7BF1, 0x0885, 0x10E7, 0x18C7, 0x10C7, 0x1908, 0x0864, 0xB5B8, 0xFFFF, 0xFFFF, 
-0xFFDF, 0xFFFF, 0xFFFF, 0xF7FF, 0xE7BF, 0xCEFE, 0xAE3B, 0x9DDA, 0x9DD9, 0xA5FA, 0xAE1B, 0xB67B, 
-0xD73E, 0xEFDF, 0xF7FF, 0xFFFF, 0xF7BF, 0xB5B8, 0x52AC, 0x0885, 0x0866, 0x0886, 0xAD76, 0xFFFF, 
-0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BF, 
-0x3A0A, 0x1085, 0x18E7, 0x10C7, 0x18E8, 0x18E8, 0x18E8, 0x10C7, 0x0885, 0x2969, 0x7391, 0xAD77, 
-0xC63A, 0xCE9A, 0xCE9B, 0xAD77, 0x7BD2, 0x39EB, 0x0886, 0x10A7, 0x1929, 0x18C8, 0x18E8, 0x10C8, 
-0x18E8, 0x18E8, 0x18E8, 0x2129, 0x0046, 0x94B4, 0xFFFF, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 
-0x94B4, 0x0866, 0x1908, 0x10C8, 0x10E8, 0x1909, 0x0885, 0xBDF9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFE, 0xBED4, 
-0x752A, 0x7D89, 0x85CC, 0x7D8B, 0x7DAB, 0x85CB, 0x7D6A, 0x95CF, 0xCF58, 0xF7DD, 0xFFFE, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFE, 0xEFFC, 0xC6F5, 0x95CE, 0x858A, 0x7DAB, 0x7DAB, 0x7DAB, 
-0x7DAB, 0x7DAA, 0x854C, 0xD779, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x6330, 0x0046, 0x1908, 0x18E8, 
-0x08A7, 0x10E7, 0x10C7, 0xC65A, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFF, 0x7BF0, 
-0x0043, 0x1908, 0x10C6, 0x10E7, 0x1908, 0x0885, 0xB5B8, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFDF, 
-0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79D, 0xC619, 
-0x8432, 0x4A2B, 0x10A6, 0x10A6, 0x10C7, 0x10C8, 0x2969, 0xEF7E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xCE5A, 0x2947, 0x18C6, 
-0x2109, 0x10A8, 0x18E8, 0x10A7, 0x1908, 0x2129, 0x10A7, 0x0886, 0x1086, 0x18C7, 0x1906, 0x10A6, 
-0x10A6, 0x0886, 0x10A7, 0x18E8, 0x10C8, 0x10C8, 0x10A7, 0x1909, 0x10C8, 0x18E8, 0x10C8, 0x10A7, 
-0x1908, 0x0866, 0x94B4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CD4, 0x0065, 0x18E7, 
-0x10A7, 0x10C8, 0x1909, 0x10A6, 0xBE19, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFFC, 0xA612, 0x75AA, 0x758A, 
-0x7DAB, 0x85EB, 0x7DAA, 0x7DAA, 0x7D8A, 0x756B, 0x95AF, 0xA652, 0xBED5, 0xC6F6, 0xC716, 0xC716, 
-0xB6B4, 0xAE52, 0x85AE, 0x756B, 0x7DAA, 0x7DA9, 0x7DAB, 0x85AC, 0x7D8B, 0x85EB, 0x854B, 0xBEB5, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFF, 0x630E, 0x0045, 0x1908, 0x1908, 0x10C8, 0x1907, 0x10A6, 
-0xC63A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8432, 0x0044, 0x1908, 0x10C7, 
-0x10C7, 0x10C7, 0x0885, 0xAD97, 0xFFFF, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xF79F, 0x5B0E, 0x2128, 0x10A7, 0x0045, 0x0066, 0x10A7, 
-0x10C7, 0x18E8, 0x0045, 0x7390, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBE18, 0x2106, 0x1086, 0x2109, 0x10C7, 
-0x2129, 0x18E8, 0x10C7, 0x10E8, 0x18E8, 0x1908, 0x10C7, 0x18E8, 0x1908, 0x10E7, 0x1907, 0x1907, 
-0x10C7, 0x18E8, 0x1909, 0x10C6, 0x2148, 0x1908, 0x18E7, 0x10C7, 0x1908, 0x18E8, 0x0865, 0x9CB4, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CD4, 0x0884, 0x1908, 0x18E8, 0x18E8, 0x10C7, 
-0x10C5, 0xBDF8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xEFDC, 0x8DEF, 0x758B, 0x7DAA, 0x7DAA, 0x7D8B, 
-0x7DAD, 0x7DCC, 0x7DCB, 0x7DAA, 0x7DAB, 0x7D8B, 0x7D8C, 0x7D6C, 0x7D8B, 0x7D6B, 0x756A, 0x7DAB, 
-0x85CC, 0x7DAC, 0x7DAC, 0x7DCC, 0x7DCB, 0x7DCB, 0x756A, 0xB673, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFE, 0xFFFE, 0x630E, 0x10A7, 0x1908, 0x10A7, 0x18C9, 0x18E8, 0x2108, 0xCE7B, 0xFFDF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x8432, 0x0865, 0x18C9, 0x18C8, 0x10A8, 0x1909, 0x10C6, 
-0xAD77, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFDE, 0xFFDE, 0xFFFF, 0x630F, 0x0866, 0x18C8, 0x10C7, 0x18E7, 0x10E7, 0x10C7, 0x10C7, 0x08A5, 
-0xBDF9, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFDF, 0xFFFE, 0xFFFF, 0xFFFF, 0xCE7B, 0x39CA, 0x0845, 0x18E7, 0x1908, 0x10C7, 0x10E8, 
-0x10E8, 0x10C7, 0x1908, 0x1908, 0x18E9, 0x10C8, 0x18E8, 0x10E7, 0x10C7, 0x2148, 0x1908, 0x0045, 
-0x39E9, 0xB5B8, 0x2989, 0x08A6, 0x1908, 0x10C7, 0x2109, 0x0866, 0x9CF5, 0xFFFF, 0xFFDF, 0xFFFF, 
-0xFFFF, 0xFFDF, 0xFFFF, 0x9CF4, 0x0045, 0x18E8, 0x18C8, 0x18E8, 0x1908, 0x10C6, 0xBE19, 0xFFFE, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0xEFFD, 0xA632, 0x7D6B, 0x7DAA, 0x7DCC, 0x7DCC, 0x7DAB, 0x7DCA, 
-0x7DAB, 0x7DAB, 0x7DAB, 0x7DAC, 0x85AC, 0x85CC, 0x85CC, 0x85CC, 0x85CB, 0x756A, 0x85ED, 0x7DCC, 
-0x758A, 0x7D8B, 0x8D8E, 0xAE93, 0xF7FE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0x5AEE, 
-0x0005, 0x10A7, 0x1087, 0x1088, 0x10A8, 0x0865, 0xCE5A, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0x8412, 0x0004, 0x10A7, 0x1086, 0x10A7, 0x10A7, 0x0023, 0xAD77, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFE, 0xFFFF, 
-0xC619, 0x1085, 0x18C7, 0x10C7, 0x10C7, 0x10E7, 0x18E7, 0x0865, 0x424A, 0xFFDF, 0xFFDF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFDE, 0xFFDF, 0xFFFF, 0xEF5F, 0x73B1, 0x18E7, 0x0045, 0x10A7, 0x1908, 0x18E8, 0x1909, 0x18E8, 
-0x1908, 0x18E8, 0x10C8, 0x212A, 0x18E9, 0x18E8, 0x0865, 0x1085, 0x634F, 0xEF5E, 0xF7BF, 0x2127, 
-0x1086, 0x10C7, 0x10A7, 0x1087, 0x0025, 0x9493, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFF, 
-0x9493, 0x0046, 0x18C8, 0x1087, 0x1087, 0x10C7, 0x0044, 0xBDF9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFDF, 0xFFDF, 0xFFFE, 0xCEF7, 0x8D8D, 0x756B, 0x7DCB, 0x7DCA, 0x7DEB, 0x85CB, 0x85EB, 0x85EB, 
-0x7DCB, 0x7DCB, 0x7DCB, 0x85CB, 0x7D8B, 0x7DAB, 0x7DCB, 0x7DCB, 0x7DAB, 0x858C, 0x9DD0, 0xD719, 
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x7BF1, 0x2968, 0x31C8, 0x39C9, 
-0x318A, 0x31A9, 0x39E9, 0xCE7A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x9492, 
-0x2126, 0x31A9, 0x31A8, 0x31A9, 0x2988, 0x2988, 0xBDF8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0x31C9, 0x0886, 
-0x10E8, 0x10C7, 0x10E7, 0x1909, 0x0845, 0x8C72, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xCE3A, 0x7370, 0x3188, 0x1085, 0x0865, 0x10A6, 0x0886, 0x10A6, 0x18C6, 0x1086, 
-0x0865, 0x1086, 0x18E7, 0x5ACD, 0xC619, 0xFFFF, 0xFFFF, 0xEF5E, 0x52AC, 0x3189, 0x31A9, 0x39EB, 
-0x422B, 0x3168, 0xAD56, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xA535, 0x2127, 0x31A9, 
-0x39CA, 0x31A9, 0x31A9, 0x31A8, 0xC619, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 
-0xFFFF, 0xEFFC, 0xBED5, 0x95CF, 0x858D, 0x7D6C, 0x7D8B, 0x7DAB, 0x7DAB, 0x7DAB, 0x7DCB, 0x7DCB, 
-0x7DCB, 0x7DAB, 0x856C, 0x7D4C, 0x8DAD, 0x9E10, 0xCF16, 0xFFFE, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 
-0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xF7BF, 0xEFBD, 0xEFBD, 0xF7DF, 0xF79E, 0xF79F, 
-0xFFFF, 0xFFDE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xEF7D, 0xEF9E, 0xF79E, 
-0xEF7E, 0xF7BF, 0xF79F, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0x8C54, 0x0845, 0x18C8, 0x10C7, 0x10E8, 
-0x10A8, 0x18E7, 0xDEDC, 0xFFFE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFF, 
-0xFFFF, 0xE73D, 0xB597, 0x8432, 0x5B0E, 0x4A6C, 0x426C, 0x4A4C, 0x52CD, 0x7390, 0x9CF5, 0xD6DB, 
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFFE, 0xFFFF, 0xF7DF, 0xEF9E, 0xF7DF, 0xEF9E, 0xF7DE, 0xF79D, 0xFFDF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BF, 0xEFBE, 0xEF9D, 0xF79E, 0xF7BE, 0xF7BE, 
-0xEF9E, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 
-0xF7FE, 0xDF7A, 0xBEB4, 0xA671, 0x9E10, 0x8DCE, 0x8DCD, 0x8DCD, 0x8DAD, 0x95CE, 0x9E30, 0xAE72, 
-0xC6F6, 0xE79B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFDF, 0xFFFF, 0xFFFE, 0xFFFF, 0x7BF2, 0x0845, 0x10C7, 0x18E7, 0x1908, 0x0885, 0x52AC, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xF7FE, 0xF7DD, 0xEFBD, 0xEFBD, 0xF7BD, 0xF7DE, 0xF7FE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xEF9E, 0x3189, 0x10A6, 0x18E7, 0x10C7, 0x10C7, 0x0044, 0xA536, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 
-0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFFF, 0xF7DE, 0xFFFF, 0xA556, 0x0024, 0x10C7, 
-0x18E8, 0x10A7, 0x10C7, 0x2127, 0xE75D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 
-0xFFDF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFFF, 0xF7BF, 0x39CA, 0x10A7, 0x10C8, 0x10A7, 0x2129, 0x0045, 
-0x73B1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xF7DF, 0x6B6F, 0x0865, 0x10C7, 0x18C8, 0x10A7, 0x10C7, 0x1085, 0xCE5B, 0xFFFF, 0xFFFE, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFE, 0xFFDF, 0xFFFF, 0xAD76, 0x73D0, 0xBDF9, 0xCE9B, 0xC65A, 0x9D15, 0x3A0A, 0x0044, 
-0x10C7, 0x10E8, 0x10A7, 0x1908, 0x0845, 0x632E, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0x52AC, 0x0002, 0x10A6, 0x18E7, 0x10A6, 0x0865, 0x10A6, 0x18E8, 0x10C7, 0x08A6, 0x1908, 
-0x0886, 0x18E7, 0xCE9A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xDEDD, 0x1907, 0x1908, 
-0x18E8, 0x10C8, 0x10C8, 0x18E8, 0x10C8, 0x10C8, 0x10E8, 0x10C7, 0x18E7, 0x0865, 0x8C54, 0xFFFF, 
-0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D16, 0x0046, 0x1909, 0x10E8, 0x18E8, 0x10C7, 
-0x10C7, 0x10C7, 0x10E8, 0x1909, 0x10A7, 0x0844, 0x738F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xF7DE, 0xFFFF, 0x4A6B, 0x0845, 0x18E8, 0x18E8, 0x10C7, 0x18E7, 0x1908, 0x10C7, 0x10E7, 
-0x0044, 0x18C6, 0x8C53, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF77E, 
-0x528B, 0x2127, 0x10A6, 0x0885, 0x0885, 0x10A6, 0x1085, 0x10A4, 0x2126, 0x634E, 0xCE5A, 0xFFDF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE9B, 0x9D15, 
-0x7BF1, 0x6B70, 0x632F, 0x7BF1, 0xAD56, 0xDF1C, 0xFFFF, 0xFFFF, 0xF7BF, 0xFFDF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-
+const uint8_t logo_data[7517] = {
+0xFE, 0xF7, 0xFF, 0x79, 0x2E, 0xC0, 0x7A, 0xC1, 0x2E, 0xC0, 0x76, 0x69, 0x2E, 0x31, 0x2C, 0x31, 
+0xCA, 0x2E, 0x31, 0xC1, 0x2E, 0x31, 0xC0, 0x2C, 0x31, 0x2E, 0x31, 0xC0, 0x56, 0x31, 0xF7, 0x2A, 
+0x9A, 0xBC, 0xFE, 0x8C, 0x93, 0x6B, 0x7E, 0xC0, 0x2C, 0x7B, 0xAE, 0x00, 0x31, 0x51, 0x31, 0xDB, 
+0x2A, 0x31, 0xC0, 0x66, 0x31, 0xC0, 0x2C, 0x31, 0xC9, 0x2C, 0xC0, 0x31, 0xC1, 0x2C, 0x31, 0xC5, 
+0x9A, 0x7B, 0x9A, 0x9D, 0x7E, 0x59, 0x35, 0xA2, 0x66, 0x71, 0xA9, 0x83, 0xA3, 0x76, 0xD1, 0x9B, 
+0x8A, 0x99, 0x8D, 0x7E, 0x3F, 0x71, 0x33, 0x7F, 0xA6, 0x94, 0xA4, 0x86, 0xFA, 0xFE, 0xBD, 0xF9, 
+0xFE, 0x10, 0x85, 0x5B, 0x7A, 0x6E, 0x6E, 0x9A, 0xCC, 0xFE, 0x94, 0xD4, 0xFE, 0xF7, 0xBF, 0x31, 
+0xDC, 0x2A, 0x31, 0x2C, 0x31, 0xC2, 0x9F, 0x76, 0x9C, 0x98, 0x9D, 0x98, 0x9C, 0xA9, 0x55, 0x69, 
+0x30, 0xA2, 0x78, 0xA2, 0x78, 0xA3, 0x88, 0xA6, 0x67, 0x31, 0xC3, 0x59, 0x31, 0xC3, 0x2C, 0xC0, 
+0x95, 0x7E, 0x98, 0x8E, 0xA2, 0x66, 0x6E, 0x20, 0xA2, 0x67, 0x78, 0xAD, 0x92, 0xA5, 0x84, 0xC0, 
+0x2C, 0x31, 0xCC, 0x2C, 0x31, 0x97, 0x7D, 0x96, 0x8F, 0xA3, 0x66, 0x56, 0x79, 0x2F, 0x9F, 0xB9, 
+0xAC, 0x70, 0x31, 0xFA, 0xFE, 0xCE, 0x3B, 0x04, 0xA4, 0x67, 0x59, 0xC0, 0x7F, 0x9A, 0xBC, 0xFE, 
+0x9C, 0xF4, 0x31, 0xC1, 0x2C, 0x31, 0xDA, 0x2C, 0x31, 0x64, 0x5E, 0x9B, 0x99, 0x99, 0xA9, 0x9B, 
+0x97, 0x9D, 0x99, 0x69, 0xC0, 0x6E, 0xC3, 0x76, 0xA2, 0x79, 0xA6, 0x58, 0xA8, 0x77, 0xA3, 0x99, 
+0x67, 0x31, 0x5A, 0x31, 0xC5, 0x96, 0x6E, 0x98, 0x8E, 0xA3, 0x66, 0xC0, 0x62, 0xC0, 0x5D, 0xAD, 
+0xA1, 0xA3, 0xA5, 0xCC, 0x2E, 0x31, 0xC0, 0x2C, 0x31, 0x97, 0x8E, 0x97, 0x6E, 0xA4, 0x56, 0x00, 
+0x7E, 0x4A, 0x70, 0xAD, 0x81, 0xA5, 0x94, 0xFA, 0xFE, 0xC6, 0x3A, 0xFE, 0x10, 0x85, 0xA3, 0x68, 
+0x55, 0x29, 0x65, 0x9D, 0x9B, 0xFE, 0x9C, 0xF4, 0x31, 0x2C, 0x31, 0xDC, 0x2C, 0x31, 0xA0, 0x65, 
+0x92, 0xEB, 0x9A, 0x99, 0x58, 0xA2, 0x66, 0x7F, 0x6B, 0xC0, 0x65, 0x5A, 0x23, 0xC0, 0x5A, 0x7F, 
+0x9D, 0xA8, 0x14, 0x73, 0xA8, 0x69, 0xAC, 0x45, 0x9F, 0x9B, 0x31, 0xC6, 0x95, 0x7E, 0x98, 0x8F, 
+0x7E, 0x6E, 0x76, 0x34, 0x3E, 0xAC, 0xA2, 0x31, 0xD1, 0x98, 0x7D, 0x37, 0xA2, 0x67, 0x66, 0x08, 
+0x5E, 0x71, 0xAC, 0x80, 0xA4, 0xA6, 0x31, 0xF9, 0xFE, 0xBD, 0xF9, 0xFE, 0x10, 0xC6, 0xA2, 0x78, 
+0x1D, 0xA2, 0x67, 0x1D, 0x01, 0xFE, 0x94, 0xD4, 0x31, 0x2C, 0x31, 0xC1, 0x2C, 0x31, 0xD7, 0x2C, 
+0x6D, 0x9D, 0x76, 0x8F, 0xED, 0x9F, 0x76, 0x23, 0xC0, 0x67, 0x55, 0x1B, 0x23, 0x69, 0x23, 0xC0, 
+0x6B, 0x56, 0x16, 0x1B, 0x6D, 0x7F, 0x02, 0xA5, 0x88, 0xAE, 0x46, 0x31, 0xC0, 0x66, 0x31, 0xC3, 
+0x95, 0x7F, 0x99, 0x8E, 0x6E, 0x39, 0x00, 0x36, 0x9E, 0xCA, 0xFE, 0xDF, 0x7E, 0x31, 0x69, 0x31, 
+0xCB, 0x2C, 0x31, 0xC1, 0x97, 0x8D, 0x37, 0x39, 0x3E, 0x69, 0x5B, 0x2D, 0x38, 0x2C, 0x31, 0xF9, 
+0xFE, 0xC6, 0x1A, 0x0E, 0x24, 0x56, 0x15, 0x29, 0x9C, 0xAB, 0xFE, 0x9D, 0x15, 0x31, 0xDE, 0x9D, 
+0x85, 0x90, 0xDB, 0x0F, 0xA3, 0x56, 0x61, 0x0F, 0x7A, 0xA4, 0x45, 0x14, 0x62, 0xC1, 0x0F, 0xC0, 
+0x14, 0x7F, 0x16, 0x7F, 0x5D, 0xA2, 0x65, 0x0F, 0xA0, 0xBD, 0xB0, 0x44, 0x31, 0xC3, 0x2C, 0x31, 
+0x35, 0x9A, 0x7D, 0x00, 0x36, 0x7F, 0x36, 0x75, 0xFE, 0xD7, 0x9E, 0x31, 0xC0, 0x2C, 0x31, 0xCE, 
+0x98, 0x6C, 0x39, 0x05, 0x6D, 0x3E, 0x5B, 0x39, 0xAC, 0x80, 0x31, 0xFA, 0x2E, 0x04, 0x24, 0xC0, 
+0x29, 0x6B, 0x9B, 0xBA, 0xFE, 0x94, 0xD4, 0x31, 0xDD, 0x45, 0x8F, 0xEB, 0x0A, 0xA3, 0x66, 0x20, 
+0xC0, 0x28, 0x61, 0x9D, 0xBC, 0xA4, 0x67, 0xA5, 0x67, 0xA3, 0x89, 0x6F, 0x54, 0x9C, 0x98, 0x9D, 
+0x98, 0x12, 0x6B, 0xA2, 0x67, 0x50, 0x14, 0x23, 0x9D, 0xBC, 0xA7, 0x57, 0xAC, 0x68, 0x31, 0xC0, 
+0x2C, 0x31, 0xC1, 0x33, 0x98, 0x8E, 0xA3, 0x66, 0x36, 0x7B, 0x39, 0xC0, 0xAD, 0x80, 0x31, 0xC0, 
+0x2C, 0xC0, 0x31, 0xCB, 0x2C, 0x31, 0x97, 0x8E, 0x97, 0x6E, 0x05, 0x39, 0x7A, 0x00, 0x3C, 0x35, 
+0xA5, 0xA5, 0xC0, 0x2C, 0x31, 0xF7, 0xFE, 0xC6, 0x19, 0x09, 0x24, 0x15, 0xA2, 0x76, 0x1D, 0x01, 
+0xFE, 0x9C, 0xF4, 0x31, 0xDD, 0x97, 0x85, 0x94, 0xDC, 0x17, 0x1E, 0x16, 0x23, 0x9D, 0x9A, 0xA5, 
+0x78, 0xA9, 0x89, 0xA5, 0x67, 0x31, 0xC0, 0x2C, 0x31, 0xC0, 0x50, 0x9A, 0x76, 0x96, 0xBA, 0x9F, 
+0x86, 0x23, 0x19, 0xC0, 0x5E, 0x55, 0xAB, 0xAD, 0xA7, 0x55, 0x31, 0xC3, 0x3A, 0x98, 0x8E, 0x39, 
+0x3E, 0x00, 0x39, 0xC0, 0xFE, 0xD7, 0x9E, 0x31, 0xD1, 0x98, 0x6D, 0x96, 0x9F, 0xA3, 0x56, 0xC0, 
+0x3E, 0x05, 0x71, 0xFE, 0xCF, 0x7D, 0x31, 0xF8, 0x66, 0x31, 0xFE, 0xC6, 0x3A, 0x0E, 0x24, 0xC2, 
+0x9C, 0xAA, 0x08, 0x31, 0x2C, 0x31, 0xD8, 0x2C, 0xC0, 0xA1, 0x44, 0x8F, 0xDB, 0x11, 0x17, 0x20, 
+0x1B, 0x72, 0xA6, 0x79, 0xAD, 0x35, 0x31, 0xC7, 0x9C, 0x99, 0x90, 0xEB, 0x0F, 0x20, 0x1B, 0x0F, 
+0x19, 0xA3, 0x7A, 0xB0, 0x55, 0x31, 0xC3, 0x3A, 0x98, 0x8E, 0x39, 0x3E, 0x00, 0x39, 0xC0, 0xFE, 
+0xDF, 0x9E, 0x31, 0xD1, 0x16, 0x34, 0xA3, 0x55, 0x3E, 0x39, 0x05, 0x60, 0x3D, 0x31, 0xFA, 0x33, 
+0x0E, 0x24, 0xC2, 0x3C, 0x08, 0x31, 0xC8, 0x66, 0x31, 0xC0, 0x2C, 0x31, 0xCB, 0x69, 0x2C, 0x31, 
+0x98, 0x98, 0x93, 0xB9, 0xA4, 0x64, 0x9D, 0xA9, 0xA2, 0x67, 0xA1, 0x89, 0xA0, 0xAB, 0xB0, 0x33, 
+0x31, 0xC7, 0x69, 0x31, 0x9A, 0x86, 0x94, 0xC9, 0x44, 0x1B, 0x23, 0x9D, 0xAA, 0xA1, 0x9A, 0xB0, 
+0x35, 0x31, 0xC3, 0x3A, 0x99, 0x7D, 0x39, 0x3E, 0x00, 0x39, 0xC0, 0xFE, 0xDF, 0x9E, 0xA3, 0x96, 
+0xD1, 0x16, 0x34, 0x3E, 0xC0, 0x39, 0x6F, 0x2D, 0xAD, 0x80, 0x31, 0xC8, 0x5A, 0x31, 0xCE, 0x2E, 
+0x31, 0xC1, 0x2C, 0x31, 0xDA, 0x33, 0x0E, 0x24, 0xC2, 0x9C, 0xAA, 0xFE, 0x9D, 0x15, 0x2C, 0x31, 
+0xC0, 0x2C, 0x31, 0xC1, 0x2C, 0x31, 0xCD, 0x2C, 0x5A, 0x31, 0xC1, 0x25, 0x31, 0x94, 0xA8, 0x99, 
+0x86, 0x1E, 0xC0, 0x55, 0xA0, 0x9A, 0x26, 0x31, 0xC8, 0x69, 0x31, 0x59, 0x93, 0xC8, 0x99, 0x99, 
+0x0F, 0x23, 0x52, 0x62, 0xAD, 0x56, 0x31, 0xC3, 0x3A, 0x99, 0x7D, 0x39, 0x3E, 0x00, 0x39, 0x7A, 
+0xFE, 0xDF, 0x9E, 0xA3, 0x96, 0xD1, 0x97, 0x8E, 0x34, 0x3E, 0x05, 0x79, 0x5F, 0x2D, 0xAD, 0x80, 
+0x31, 0xE0, 0x2C, 0x31, 0xCD, 0x2C, 0xC0, 0x31, 0xC4, 0x2C, 0x31, 0x33, 0x0E, 0x24, 0xC2, 0x9C, 
+0xAA, 0x08, 0x2C, 0x31, 0xC6, 0x2C, 0x31, 0x2C, 0x31, 0xC0, 0x2C, 0x31, 0xC3, 0x2C, 0xC0, 0x31, 
+0xC1, 0x25, 0x31, 0xC1, 0x25, 0x91, 0xB9, 0x9E, 0x54, 0x73, 0xA2, 0x77, 0x58, 0x20, 0xB2, 0x36, 
+0x2C, 0x31, 0xC7, 0x2A, 0x2C, 0x31, 0x09, 0x92, 0xDA, 0x5D, 0x6E, 0xA1, 0x89, 0x9D, 0xA9, 0xA8, 
+0x7A, 0x31, 0xC3, 0x3A, 0x99, 0x7D, 0x39, 0x3E, 0x00, 0x39, 0x7A, 0xFE, 0xDF, 0x9E, 0xA3, 0x96, 
+0xD1, 0x97, 0x8E, 0x34, 0x3E, 0xC0, 0x01, 0x05, 0x2D, 0x38, 0x31, 0xC5, 0x2C, 0xC0, 0x31, 0xD2, 
+0x2C, 0x31, 0xC0, 0x2C, 0x31, 0xD7, 0x2C, 0x31, 0x33, 0x0E, 0x24, 0xC2, 0x9C, 0xAA, 0xFE, 0x9C, 
+0xD4, 0x31, 0xC0, 0x2C, 0x31, 0xC1, 0x2C, 0x31, 0xC6, 0x2C, 0x31, 0xC3, 0x2C, 0x31, 0x65, 0x31, 
+0x69, 0x31, 0xC1, 0x25, 0x90, 0xB9, 0x9E, 0x65, 0xA0, 0x9A, 0x16, 0x6D, 0xA2, 0x9B, 0x2A, 0x2C, 
+0x31, 0xC8, 0x2C, 0x31, 0x9E, 0x75, 0x20, 0x1B, 0xC1, 0x65, 0x32, 0x31, 0xC3, 0x3A, 0x99, 0x7D, 
+0xA2, 0x77, 0x3E, 0x00, 0x39, 0x7A, 0xFE, 0xDF, 0x9E, 0xA3, 0x96, 0xD1, 0x98, 0x7D, 0x34, 0x3E, 
+0xC0, 0x3C, 0x05, 0x2D, 0x38, 0x31, 0xC8, 0x25, 0x31, 0xCE, 0x2A, 0xC0, 0x31, 0xD5, 0x2A, 0xC0, 
+0x31, 0xC4, 0x33, 0x0E, 0x24, 0xC2, 0x9C, 0xAA, 0x08, 0x31, 0x2C, 0x31, 0xC0, 0x2C, 0x31, 0xC1, 
+0x2C, 0x31, 0x2C, 0x31, 0xC0, 0x51, 0x31, 0xC8, 0x2E, 0x31, 0xC0, 0x29, 0x31, 0x27, 0x8E, 0xDA, 
+0x1B, 0x7B, 0x5A, 0x07, 0xA5, 0x89, 0x2A, 0x31, 0x2A, 0x31, 0xC9, 0x9F, 0x75, 0x8F, 0xDB, 0x14, 
+0x22, 0x1B, 0x65, 0x32, 0x2A, 0x31, 0xC2, 0x3A, 0x99, 0x7D, 0x05, 0x3E, 0x00, 0x39, 0x7A, 0xFE, 
+0xDF, 0x9E, 0xA3, 0x96, 0xCF, 0x2C, 0x31, 0x97, 0x8E, 0x34, 0x39, 0x3E, 0x3C, 0x05, 0x2D, 0x38, 
+0x31, 0xC3, 0x2E, 0xC0, 0x31, 0xD3, 0x65, 0x31, 0xC0, 0x2E, 0x31, 0xCC, 0x52, 0x9C, 0xAA, 0x9A, 
+0xBB, 0x99, 0xBC, 0x9B, 0xBB, 0xC0, 0xA4, 0x66, 0xA7, 0x54, 0xA8, 0x33, 0x2C, 0x31, 0xC0, 0x25, 
+0x31, 0x33, 0x0E, 0xA1, 0x89, 0xC2, 0x9C, 0xAA, 0x08, 0x31, 0x2C, 0x31, 0xCF, 0x9C, 0xAB, 0x95, 
+0xEE, 0x99, 0xBC, 0x0F, 0x6F, 0xA5, 0x65, 0xAA, 0x32, 0x2C, 0x31, 0xC0, 0x55, 0x91, 0xB8, 0x07, 
+0x16, 0x6E, 0x50, 0x0A, 0x2A, 0x31, 0xC9, 0x2C, 0x31, 0x9E, 0x75, 0x90, 0xCA, 0x45, 0x7F, 0x1E, 
+0x07, 0xA7, 0x8A, 0x31, 0xC3, 0x96, 0x6E, 0x98, 0x8E, 0x05, 0x69, 0x67, 0x39, 0x7A, 0xFE, 0xDF, 
+0x9E, 0xA3, 0x96, 0xCF, 0x2C, 0x31, 0x14, 0x96, 0x8F, 0x39, 0x05, 0x79, 0x05, 0x2D, 0x38, 0x31, 
+0x2C, 0x59, 0xFE, 0xA6, 0x7B, 0x6E, 0x3A, 0xC1, 0x9D, 0xA9, 0xA4, 0x76, 0xAA, 0x42, 0x31, 0xCE, 
+0xA0, 0x58, 0x95, 0xCE, 0x42, 0x6E, 0x6B, 0xC0, 0x60, 0x14, 0x31, 0xC7, 0x96, 0xEE, 0xFE, 0x94, 
+0xB4, 0xFE, 0x52, 0xAD, 0x95, 0xEE, 0x9B, 0xAB, 0x56, 0xC0, 0x66, 0x7F, 0x09, 0xA3, 0x76, 0xAB, 
+0x22, 0xFE, 0x9C, 0xF5, 0xFE, 0xE7, 0x1D, 0x31, 0xC0, 0x33, 0xFE, 0x10, 0xC6, 0x24, 0xC2, 0x3C, 
+0xFE, 0x94, 0xD4, 0x31, 0x2C, 0x31, 0x2C, 0x31, 0x2C, 0x91, 0xFF, 0xFE, 0x63, 0x4E, 0xA2, 0x87, 
+0x56, 0xA2, 0x77, 0x9C, 0xAA, 0xAB, 0x32, 0x31, 0xC2, 0xFE, 0xC6, 0x39, 0xFE, 0x63, 0x4F, 0x39, 
+0x09, 0x01, 0x3C, 0xC0, 0x6D, 0xA4, 0x74, 0xAA, 0x33, 0xFE, 0xB5, 0xB7, 0xFE, 0xFF, 0xDF, 0x31, 
+0x92, 0xA7, 0x9A, 0x97, 0x1B, 0x54, 0x7F, 0xA0, 0xAD, 0xB0, 0x45, 0x31, 0xCB, 0x9C, 0x86, 0x90, 
+0xCA, 0xA3, 0x56, 0x66, 0x78, 0x11, 0x0D, 0x31, 0xC1, 0x2C, 0x31, 0x95, 0x7F, 0x98, 0x9F, 0x34, 
+0xA2, 0x56, 0x7B, 0x65, 0x76, 0xFE, 0xDF, 0xBF, 0x31, 0x2C, 0x31, 0x2C, 0x31, 0x5A, 0x31, 0xC1, 
+0x2E, 0x56, 0x55, 0xC0, 0x6E, 0x7F, 0x2E, 0x31, 0xC1, 0x26, 0x9A, 0x9B, 0x9C, 0x8A, 0x99, 0x9D, 
+0x39, 0xA2, 0x57, 0x2D, 0xAD, 0x71, 0x31, 0x2C, 0x31, 0xFE, 0x96, 0x3A, 0x9E, 0x38, 0x3B, 0xA0, 
+0xA8, 0x37, 0xA2, 0x67, 0x9E, 0x87, 0xAD, 0x81, 0x31, 0xC1, 0x2C, 0x31, 0xC5, 0x2E, 0x31, 0xC2, 
+0x9A, 0x7C, 0x94, 0x8E, 0x39, 0x37, 0x55, 0xA2, 0x57, 0x60, 0xA9, 0x93, 0x2A, 0x66, 0x31, 0xC1, 
+0x25, 0x31, 0x99, 0xCD, 0xFE, 0x6B, 0x91, 0xFE, 0x19, 0x07, 0x09, 0x51, 0xA4, 0x66, 0x6B, 0xC2, 
+0x6E, 0x22, 0x9D, 0x9A, 0xC1, 0xA4, 0x75, 0xFE, 0x8C, 0x53, 0x31, 0xFE, 0xCE, 0x7B, 0xFE, 0x10, 
+0xA5, 0x24, 0xC0, 0x55, 0x29, 0x9C, 0xAA, 0xFE, 0x9C, 0xD4, 0x31, 0xC4, 0xFE, 0x94, 0xB4, 0xFE, 
+0x00, 0x04, 0x01, 0x66, 0xA2, 0x77, 0x9D, 0x99, 0xAD, 0x20, 0x2C, 0x31, 0x51, 0xFE, 0x6B, 0x8F, 
+0x09, 0x01, 0x15, 0x24, 0x29, 0x62, 0xA2, 0x75, 0x47, 0xC0, 0x9B, 0xB9, 0x2F, 0x31, 0x69, 0x94, 
+0xCC, 0x99, 0x62, 0xA0, 0x9B, 0x16, 0xA2, 0x65, 0x11, 0xAD, 0x68, 0x31, 0xC9, 0x2C, 0x6C, 0x96, 
+0x98, 0x16, 0x6E, 0x12, 0x6F, 0x9D, 0xBB, 0xAD, 0x48, 0x31, 0xC0, 0x2A, 0x31, 0x65, 0x97, 0x5D, 
+0x36, 0xC0, 0x08, 0x9D, 0xAA, 0xA3, 0x56, 0x7D, 0xAC, 0x81, 0x31, 0xC3, 0x2E, 0x9B, 0x6B, 0x9D, 
+0x89, 0x9C, 0xAA, 0x9D, 0x89, 0x55, 0x66, 0xC0, 0x2F, 0x72, 0xA3, 0x77, 0xA3, 0x76, 0xA4, 0x76, 
+0xA6, 0x65, 0x2E, 0x31, 0xC0, 0x42, 0x99, 0x6C, 0x98, 0x9C, 0x9C, 0xCB, 0xAF, 0x50, 0x31, 0xC1, 
+0x30, 0x96, 0x7D, 0xA1, 0x69, 0x71, 0x08, 0x0A, 0x60, 0xA5, 0xA5, 0x31, 0xCE, 0x95, 0x7E, 0x9B, 
+0x6B, 0x6B, 0x08, 0x39, 0x3E, 0xA0, 0xA7, 0xAD, 0x81, 0x31, 0xC1, 0x2C, 0x31, 0xC0, 0xFE, 0xA5, 
+0x36, 0xFE, 0x21, 0x07, 0x01, 0x15, 0xC0, 0xA3, 0x77, 0x9C, 0xAA, 0xA2, 0x77, 0xC0, 0xA2, 0x76, 
+0x29, 0x15, 0xC0, 0x29, 0x52, 0xC0, 0x24, 0x9B, 0xBA, 0xFE, 0x5A, 0xED, 0xFE, 0xAD, 0x78, 0xFE, 
+0x18, 0xE7, 0x24, 0x15, 0x29, 0x24, 0x9C, 0xAA, 0x03, 0xFE, 0xFF, 0xFF, 0xC4, 0x3B, 0x01, 0x29, 
+0x24, 0x6F, 0x10, 0xA9, 0x42, 0x31, 0x9D, 0xAA, 0xFE, 0x4A, 0x6C, 0xFE, 0x08, 0x65, 0x24, 0x1C, 
+0xA3, 0x66, 0x50, 0x15, 0xA3, 0x66, 0x65, 0x1C, 0x6E, 0x7C, 0xFE, 0xE7, 0x1D, 0x2C, 0x6D, 0x9B, 
+0x98, 0x92, 0xA6, 0x16, 0xC0, 0x6E, 0x61, 0xA5, 0x89, 0xAF, 0x46, 0x2C, 0xC2, 0x31, 0xC3, 0x2C, 
+0x31, 0x44, 0x8D, 0xEC, 0x14, 0x16, 0x6F, 0x13, 0xA0, 0xBB, 0xB1, 0x24, 0xA2, 0x9A, 0x65, 0x31, 
+0xC1, 0x27, 0x9A, 0x6D, 0x05, 0xC0, 0x76, 0x2A, 0xA1, 0xB7, 0xAF, 0x60, 0x2C, 0x25, 0x2B, 0x9E, 
+0x78, 0x98, 0xAC, 0x9A, 0xAB, 0xA1, 0x47, 0x55, 0x56, 0x6E, 0x6B, 0xC0, 0x1F, 0x1A, 0xA0, 0xA9, 
+0x55, 0x5A, 0x7B, 0x7A, 0xA0, 0xB8, 0xA7, 0x74, 0x17, 0xA2, 0x97, 0x5A, 0x9D, 0x7B, 0x96, 0xDD, 
+0xA7, 0x53, 0x2E, 0x31, 0xC0, 0x46, 0xFE, 0x8E, 0x19, 0xA0, 0x38, 0x77, 0xC0, 0x03, 0x06, 0x71, 
+0xFE, 0xDF, 0xBE, 0x31, 0x66, 0x31, 0xC1, 0x2C, 0x31, 0xC4, 0x2C, 0xC0, 0x14, 0x38, 0x06, 0x4A, 
+0x06, 0x66, 0x32, 0xA4, 0xB6, 0x31, 0xC0, 0x2C, 0x6D, 0x31, 0xC0, 0xFE, 0x73, 0xD1, 0xFE, 0x08, 
+0x45, 0xA4, 0x57, 0x1D, 0x24, 0x55, 0x24, 0x6E, 0x24, 0x29, 0x15, 0x24, 0x29, 0xC0, 0x24, 0xA2, 
+0x77, 0x1C, 0x7A, 0x24, 0x50, 0xA6, 0x55, 0x51, 0x15, 0x24, 0xC1, 0x9D, 0xAA, 0xFE, 0x9C, 0xD4, 
+0xFE, 0xFF, 0xFF, 0xC4, 0x03, 0xFE, 0x08, 0x86, 0x1C, 0x29, 0xC0, 0x1D, 0xA6, 0x55, 0xFE, 0xE7, 
+0x5F, 0xFE, 0x5A, 0xCD, 0x2D, 0x29, 0x1C, 0xA2, 0x77, 0x24, 0x1D, 0xC1, 0x15, 0x38, 0x9C, 0x99, 
+0xFE, 0x4A, 0x6B, 0x31, 0xC1, 0x59, 0x92, 0xB7, 0x99, 0xBA, 0xA4, 0x45, 0x52, 0x79, 0x66, 0xAB, 
+0x57, 0x31, 0x69, 0x31, 0xC3, 0x2A, 0xC0, 0x2C, 0xA1, 0x54, 0x90, 0xDC, 0x9D, 0x97, 0x6E, 0x5A, 
+0x13, 0x69, 0x0D, 0x31, 0xC0, 0x61, 0x31, 0x2C, 0x31, 0x95, 0x8E, 0xFE, 0x65, 0x79, 0xA4, 0x56, 
+0x48, 0x71, 0xA5, 0x74, 0xA9, 0xA5, 0x2C, 0xC0, 0x9C, 0x79, 0x99, 0x7A, 0x9A, 0x9B, 0x6F, 0xA3, 
+0x56, 0x73, 0x65, 0x5A, 0xC3, 0x36, 0x27, 0xC0, 0x5A, 0xC0, 0x6E, 0x27, 0x65, 0x2A, 0xA7, 0x84, 
+0xA6, 0x87, 0x31, 0x2C, 0x59, 0x31, 0xC2, 0x97, 0x8E, 0x32, 0xA2, 0x78, 0x65, 0xA2, 0x46, 0x0D, 
+0x9D, 0xAA, 0xAA, 0x80, 0x31, 0xC0, 0x2E, 0x31, 0xC6, 0x2E, 0x2C, 0x31, 0x12, 0x2D, 0x01, 0x05, 
+0x39, 0x7A, 0x2D, 0xAA, 0xA2, 0x31, 0xC3, 0xFE, 0x6B, 0x4F, 0xFE, 0x08, 0x45, 0xA5, 0x56, 0x6B, 
+0x6C, 0x56, 0x24, 0x6E, 0x24, 0x66, 0x40, 0x09, 0x52, 0x66, 0xA2, 0x76, 0x09, 0x24, 0x29, 0x24, 
+0xC0, 0x29, 0x10, 0x15, 0xC0, 0x24, 0x29, 0x24, 0x3C, 0x03, 0x31, 0xC4, 0x03, 0x3C, 0x24, 0xC1, 
+0x10, 0xA7, 0x44, 0xAE, 0x21, 0x30, 0x29, 0xC0, 0x21, 0x29, 0x24, 0xC0, 0x29, 0x10, 0x29, 0xC0, 
+0x9C, 0xA9, 0xFE, 0x84, 0x31, 0x31, 0x2C, 0x31, 0x69, 0x98, 0xAA, 0x93, 0xC9, 0xA3, 0x42, 0xA0, 
+0x8A, 0x7F, 0x40, 0x9D, 0xBB, 0xAA, 0x67, 0xAB, 0x46, 0xA1, 0x99, 0x31, 0x2C, 0xC0, 0x31, 0xC0, 
+0x2A, 0x9E, 0x87, 0x17, 0x9C, 0x87, 0x67, 0x66, 0xA3, 0x54, 0x14, 0x9F, 0xAB, 0x02, 0x31, 0x2C, 
+0x31, 0xC2, 0x96, 0x7E, 0x98, 0x8F, 0x6E, 0x54, 0xA5, 0xB5, 0xAB, 0x61, 0x31, 0x17, 0x97, 0x9C, 
+0x9B, 0x79, 0xA1, 0x79, 0x52, 0x99, 0xDD, 0x9C, 0xAB, 0x9B, 0xBC, 0x5A, 0x65, 0x56, 0x7A, 0x30, 
+0xA2, 0x77, 0xA2, 0x77, 0xA6, 0x32, 0xA4, 0x66, 0xA3, 0x66, 0x69, 0x27, 0x5A, 0xC0, 0x6E, 0x27, 
+0x75, 0xAA, 0x74, 0x31, 0xC0, 0x65, 0x31, 0x2C, 0x31, 0x9E, 0x6A, 0x92, 0x9F, 0x08, 0x6D, 0x5A, 
+0x76, 0x00, 0xA3, 0x93, 0xAE, 0x81, 0x31, 0x2E, 0x31, 0x2C, 0x31, 0xC2, 0x2C, 0x31, 0x59, 0x31, 
+0x2E, 0xFE, 0x86, 0x18, 0x9E, 0x6B, 0x7A, 0x03, 0x32, 0x66, 0xA4, 0x85, 0xAD, 0x71, 0x31, 0xC0, 
+0x25, 0x31, 0xFE, 0x8C, 0x93, 0xFE, 0x00, 0x24, 0xA7, 0x56, 0x10, 0xA2, 0x77, 0x55, 0xA2, 0x77, 
+0x1D, 0x9D, 0x99, 0x66, 0xA8, 0x44, 0xA9, 0x42, 0xA7, 0x45, 0xA4, 0x66, 0x51, 0x98, 0xCC, 0x98, 
+0xCC, 0x98, 0xCC, 0x57, 0x29, 0xC0, 0x52, 0xA4, 0x76, 0x15, 0x29, 0x15, 0x29, 0xC0, 0x9B, 0xBB, 
+0xFE, 0x9C, 0xD4, 0x31, 0xC2, 0x69, 0x31, 0x03, 0xFE, 0x00, 0x46, 0x38, 0x1C, 0x15, 0x24, 0xC0, 
+0x1F, 0x24, 0x1A, 0x29, 0x1D, 0x35, 0x3A, 0x1D, 0x7F, 0x1D, 0x02, 0x35, 0x7E, 0xFE, 0xBD, 0xF8, 
+0x31, 0x66, 0x31, 0x2C, 0x31, 0x95, 0xA8, 0x11, 0x6C, 0x6B, 0xA3, 0x57, 0x65, 0x9C, 0xCA, 0xA3, 
+0x8C, 0xA6, 0x66, 0xA7, 0x55, 0xA2, 0x89, 0x6E, 0x50, 0x9B, 0xAA, 0x9B, 0xAA, 0x9A, 0x96, 0x0C, 
+0x7E, 0xA0, 0x9A, 0x0F, 0x6C, 0x9E, 0xBD, 0xAD, 0x59, 0x31, 0x66, 0x31, 0xC3, 0x3F, 0x97, 0x8F, 
+0xA2, 0x86, 0xA6, 0x93, 0x2E, 0x31, 0x9C, 0x58, 0x96, 0xCE, 0x9A, 0x9C, 0x9D, 0x8A, 0x98, 0xDF, 
+0x99, 0xDE, 0x57, 0xC0, 0x6F, 0x66, 0xC2, 0x09, 0x66, 0xC0, 0x68, 0xA3, 0x66, 0xA5, 0x54, 0xA8, 
+0x32, 0xA6, 0x54, 0xA3, 0x55, 0x65, 0x5A, 0x66, 0xA2, 0x67, 0x9D, 0xBA, 0xA3, 0xA7, 0xAC, 0x63, 
+0x31, 0x66, 0x31, 0x2A, 0x2E, 0x94, 0x9F, 0x9A, 0x8C, 0xA4, 0x46, 0x50, 0x7B, 0x6B, 0x9E, 0xA7, 
+0xAE, 0x61, 0x31, 0xC1, 0x2C, 0x31, 0xC6, 0x9D, 0x6B, 0x29, 0x08, 0x65, 0x01, 0x3C, 0x60, 0xAB, 
+0x51, 0x31, 0xC0, 0x64, 0x31, 0xFE, 0xC6, 0x3A, 0xFE, 0x08, 0x85, 0xA4, 0x68, 0x65, 0x1A, 0xC0, 
+0x2B, 0x24, 0x9D, 0xA9, 0xAA, 0x32, 0xFE, 0x9C, 0xF5, 0xFE, 0xE7, 0x3D, 0x31, 0xC0, 0x2A, 0x31, 
+0xC0, 0x9B, 0xBC, 0xFE, 0xAD, 0x77, 0xFE, 0x52, 0x8C, 0x04, 0xA2, 0x78, 0x5E, 0x61, 0xA3, 0x66, 
+0x24, 0x1D, 0xC0, 0x24, 0x9D, 0x99, 0x03, 0x31, 0xC2, 0x2A, 0x31, 0x03, 0xFE, 0x00, 0x46, 0x24, 
+0x55, 0x24, 0x30, 0x10, 0x30, 0x1C, 0xA3, 0x76, 0x9A, 0xBA, 0xA5, 0x54, 0xFE, 0x63, 0x4F, 0x37, 
+0xA8, 0x44, 0xA2, 0x76, 0xC0, 0x99, 0xCC, 0xFE, 0x84, 0x12, 0x98, 0xCC, 0xFE, 0xEF, 0x7D, 0x31, 
+0xC0, 0x2C, 0x31, 0xC0, 0x58, 0x93, 0xCB, 0x98, 0xA8, 0xA2, 0x65, 0x5A, 0xA2, 0x76, 0x7A, 0x0C, 
+0x0F, 0x6B, 0xC0, 0x67, 0x69, 0x16, 0x0F, 0x19, 0xA0, 0x8A, 0x66, 0x16, 0x0F, 0xA0, 0x9B, 0xAB, 
+0x67, 0x31, 0xC0, 0x2C, 0x31, 0xC3, 0x98, 0x4D, 0x94, 0xCF, 0x2E, 0xAC, 0x71, 0xC0, 0x98, 0x9C, 
+0x97, 0x9C, 0x99, 0xBE, 0x98, 0xCF, 0x9C, 0xBB, 0x67, 0xA2, 0x68, 0x6F, 0xA2, 0x56, 0x9F, 0xB9, 
+0x04, 0xC2, 0x69, 0x65, 0x52, 0x61, 0x65, 0x54, 0x5D, 0xA6, 0x54, 0xA8, 0x32, 0xA6, 0x55, 0xA4, 
+0x55, 0x54, 0x7F, 0x5F, 0x50, 0xA2, 0xA8, 0xA8, 0x95, 0xA7, 0x83, 0xC0, 0x66, 0x31, 0x9A, 0x8C, 
+0x95, 0x8E, 0xA2, 0x48, 0x75, 0x6E, 0x08, 0x54, 0xA6, 0x95, 0x2E, 0x31, 0xC8, 0x2E, 0x96, 0x8E, 
+0x98, 0x8D, 0x01, 0x69, 0x67, 0x39, 0xA2, 0xA6, 0xAC, 0x70, 0x31, 0x2C, 0x31, 0xC0, 0xFE, 0x42, 
+0x2B, 0xFE, 0x10, 0xA7, 0x6F, 0x6E, 0x1D, 0xC0, 0x6B, 0x50, 0xFE, 0x6B, 0x70, 0xFE, 0xF7, 0x9F, 
+0x31, 0xC0, 0x2A, 0x31, 0x2A, 0x66, 0x31, 0xC1, 0x2C, 0xFE, 0x94, 0x95, 0xFE, 0x18, 0xC7, 0x24, 
+0xA2, 0x77, 0x18, 0x24, 0x29, 0x24, 0xC0, 0x9C, 0xAA, 0x03, 0x31, 0x2A, 0x31, 0xC0, 0x25, 0x31, 
+0xFE, 0x9C, 0xF5, 0xFE, 0x08, 0x86, 0x24, 0xC1, 0x1C, 0x29, 0x51, 0x29, 0x35, 0xFE, 0x52, 0x8D, 
+0xFE, 0xD6, 0x9B, 0x31, 0xC5, 0x2C, 0x31, 0xC2, 0x25, 0x31, 0xC0, 0x59, 0x9A, 0x85, 0x96, 0xB9, 
+0x9D, 0x98, 0xA3, 0x67, 0x41, 0x7E, 0x67, 0xC0, 0x6F, 0xC0, 0x1B, 0x6E, 0xC0, 0x65, 0xA1, 0x89, 
+0x9D, 0x99, 0x19, 0xA3, 0x89, 0xAD, 0x58, 0x31, 0xC0, 0x2C, 0x31, 0xC2, 0x62, 0x31, 0x95, 0x6E, 
+0x9B, 0xDC, 0x2C, 0x31, 0x98, 0x7C, 0x95, 0x8D, 0xFE, 0x3B, 0xF3, 0x9C, 0xAD, 0xA1, 0x89, 0xA2, 
+0x67, 0x51, 0x6B, 0x35, 0x74, 0xA0, 0x6A, 0x7A, 0x35, 0x6F, 0xC0, 0x09, 0xC1, 0x6D, 0x9D, 0xAA, 
+0x9D, 0xBA, 0x62, 0x50, 0x6C, 0xA7, 0x33, 0xAA, 0x32, 0xA8, 0x33, 0x54, 0x5E, 0x7E, 0x55, 0x71, 
+0xA9, 0x84, 0x31, 0xC1, 0x5A, 0xFE, 0x86, 0x39, 0x9E, 0x5A, 0xA1, 0x97, 0x5A, 0x06, 0x67, 0x74, 
+0x23, 0x2C, 0x31, 0xC3, 0x2C, 0x31, 0xC0, 0x2C, 0x4E, 0xFE, 0x7D, 0xF8, 0x39, 0x7D, 0x5A, 0xA0, 
+0xAA, 0x41, 0xA9, 0x72, 0x31, 0x65, 0x2C, 0x31, 0xFE, 0xAD, 0x77, 0xFE, 0x08, 0x65, 0x24, 0x1A, 
+0x7A, 0x24, 0x6E, 0x9D, 0x97, 0xFE, 0x7C, 0x11, 0x31, 0xC0, 0x25, 0x31, 0xC2, 0x2C, 0x31, 0xC0, 
+0x25, 0x31, 0xC0, 0xFE, 0xA5, 0x35, 0x15, 0x1D, 0x66, 0x24, 0x66, 0x15, 0xA3, 0x66, 0x9B, 0xBB, 
+0xFE, 0x9C, 0xD4, 0x31, 0x69, 0x31, 0xC0, 0x25, 0x31, 0xFE, 0x9C, 0xF5, 0xFE, 0x08, 0x66, 0x24, 
+0xC0, 0x15, 0x24, 0xC0, 0x2E, 0x01, 0xFE, 0x5A, 0xED, 0xFE, 0xF7, 0xDF, 0x31, 0x25, 0xC0, 0x31, 
+0x27, 0x31, 0x25, 0x2C, 0x31, 0xC4, 0x2A, 0x31, 0x9C, 0xA9, 0x99, 0x87, 0x99, 0x98, 0x9F, 0x96, 
+0x5A, 0xA2, 0x68, 0x12, 0x6F, 0x6E, 0x56, 0xC0, 0x23, 0x1E, 0x59, 0x7A, 0xC0, 0x19, 0x14, 0xA2, 
+0x99, 0xA4, 0xAB, 0xAA, 0x47, 0xA2, 0x68, 0x31, 0xC5, 0x97, 0x9D, 0xA6, 0x65, 0x31, 0x97, 0x9C, 
+0xFE, 0x55, 0x14, 0xFE, 0x33, 0x94, 0x4B, 0xA1, 0x98, 0xA2, 0x96, 0xA4, 0x75, 0xA6, 0x63, 0xA5, 
+0x65, 0x65, 0xA2, 0x77, 0x41, 0x9C, 0x9B, 0x9C, 0xAC, 0x9A, 0x9C, 0x9C, 0x9B, 0xA1, 0x89, 0xC0, 
+0x6E, 0x3D, 0xA2, 0x67, 0x50, 0x2A, 0x9C, 0xBA, 0x52, 0xA2, 0x67, 0x50, 0xAB, 0x20, 0xAC, 0x10, 
+0xA2, 0x65, 0x49, 0xA2, 0x78, 0x9D, 0xBB, 0xA0, 0xA7, 0xA7, 0x63, 0xAA, 0x94, 0x7A, 0xC0, 0x99, 
+0x7C, 0x95, 0x8E, 0xA3, 0x48, 0x0A, 0x71, 0x6F, 0x48, 0xA9, 0xB4, 0xA5, 0xB5, 0x6E, 0x31, 0xC0, 
+0x69, 0xC0, 0x31, 0x2E, 0x31, 0x2C, 0x9A, 0x7C, 0x32, 0x3C, 0x69, 0x7F, 0x9D, 0xAA, 0xA7, 0x73, 
+0xAC, 0x71, 0x31, 0x2C, 0x31, 0xC0, 0xFE, 0x52, 0xAD, 0xFE, 0x08, 0x86, 0x24, 0x55, 0x6F, 0x7F, 
+0x9B, 0xBA, 0xFE, 0x63, 0x0D, 0x31, 0xCD, 0xFE, 0x7B, 0xD0, 0xFE, 0x10, 0x85, 0x24, 0x56, 0x24, 
+0xC1, 0x3C, 0xFE, 0x9C, 0xD5, 0x31, 0xC4, 0xFE, 0x9C, 0xF5, 0x3C, 0x24, 0x69, 0x1F, 0x1C, 0xA3, 
+0x66, 0x9C, 0xB9, 0xAA, 0x31, 0xFE, 0xF7, 0xBE, 0x2C, 0x31, 0xC7, 0x2C, 0x31, 0xC1, 0x2C, 0x31, 
+0x98, 0x97, 0x98, 0x87, 0x9D, 0x98, 0x12, 0x67, 0xA4, 0x45, 0x49, 0x20, 0xC0, 0x65, 0x66, 0x6B, 
+0x1B, 0xC1, 0xA2, 0x67, 0x14, 0x1E, 0x57, 0x16, 0x58, 0xA2, 0x9B, 0xAB, 0x57, 0x31, 0xC5, 0x2A, 
+0xC0, 0x9A, 0x6C, 0xFE, 0x54, 0x95, 0xFE, 0x2B, 0x32, 0xA6, 0x65, 0xA6, 0x83, 0xAD, 0x21, 0xAB, 
+0x30, 0x31, 0xC1, 0x66, 0x31, 0xC2, 0x42, 0x98, 0xAD, 0xFE, 0x7D, 0x38, 0x97, 0xAE, 0x9C, 0x9B, 
+0xA0, 0x8B, 0xA1, 0x95, 0x6E, 0x43, 0xA2, 0x77, 0x9B, 0xC9, 0x9C, 0xB9, 0xA5, 0x46, 0x9C, 0xA9, 
+0xA5, 0x55, 0xFE, 0x65, 0x57, 0xA6, 0x33, 0x5A, 0x65, 0x66, 0x76, 0xA8, 0x73, 0x2E, 0x2C, 0x4A, 
+0xFE, 0x75, 0xD8, 0xA1, 0x49, 0x7E, 0x3F, 0x9F, 0x8B, 0x5C, 0xA2, 0xC7, 0x2E, 0x31, 0x2E, 0x2C, 
+0xC0, 0x31, 0xC3, 0x95, 0x6D, 0x9B, 0x6B, 0x9E, 0xCB, 0xA3, 0x36, 0x9D, 0xB9, 0xA4, 0xB6, 0x2E, 
+0x9D, 0x9B, 0xA2, 0x65, 0x31, 0x2C, 0x98, 0xCD, 0xFE, 0x21, 0x27, 0x9C, 0xAC, 0xA4, 0x55, 0x15, 
+0x24, 0xC0, 0x7E, 0xFE, 0xD6, 0x9B, 0x31, 0x66, 0x31, 0xC0, 0x2C, 0x31, 0xC8, 0x99, 0xCD, 0xFE, 
+0x31, 0x88, 0x18, 0xA2, 0x68, 0x24, 0x15, 0xA3, 0x77, 0x99, 0xCC, 0x03, 0x31, 0xC4, 0xFE, 0x9C, 
+0xF5, 0xFE, 0x08, 0x66, 0xA4, 0x65, 0xC0, 0x15, 0x6F, 0x24, 0x9E, 0x97, 0xFE, 0xBD, 0xD8, 0x31, 
+0xC7, 0x2C, 0x31, 0xC3, 0x69, 0x96, 0xA7, 0x94, 0xCC, 0xA3, 0x55, 0xA2, 0x67, 0x1B, 0x7D, 0x51, 
+0x6F, 0x62, 0xA2, 0x88, 0xA2, 0x78, 0xA1, 0x89, 0x7E, 0x55, 0x50, 0x54, 0x9D, 0x9A, 0x14, 0x6E, 
+0x2F, 0x9C, 0xAB, 0xA4, 0x74, 0x9D, 0x9A, 0x9E, 0xAC, 0xAB, 0x66, 0x31, 0x2C, 0x31, 0x2A, 0x31, 
+0xC0, 0x65, 0x9E, 0x7A, 0xFE, 0x54, 0xD5, 0xFE, 0x2B, 0x53, 0xAD, 0x61, 0xFE, 0xC7, 0x3E, 0x31, 
+0xC0, 0x2C, 0x97, 0xCC, 0x96, 0xED, 0x9B, 0xAC, 0x9C, 0xAA, 0x52, 0xA5, 0x55, 0xA6, 0x64, 0xA9, 
+0x43, 0xA9, 0x33, 0x31, 0xC0, 0x9D, 0x7B, 0xFE, 0x95, 0xD9, 0xFE, 0x4B, 0xB4, 0x9E, 0x7B, 0xA2, 
+0x67, 0x57, 0x79, 0xA2, 0x76, 0x9C, 0xAA, 0x50, 0x65, 0x6B, 0x7E, 0xFE, 0x5D, 0x17, 0x3F, 0x54, 
+0x57, 0xA1, 0x8A, 0x9C, 0xB8, 0xAA, 0x62, 0xAA, 0x83, 0x9F, 0xB9, 0x9B, 0x8C, 0x97, 0x6C, 0x9E, 
+0x69, 0x7E, 0x9F, 0xAB, 0xA2, 0x65, 0x9D, 0xB9, 0xAE, 0x71, 0x31, 0x2A, 0x31, 0xC0, 0x62, 0x5E, 
+0x6D, 0x31, 0x9E, 0x6A, 0x91, 0x9F, 0x37, 0x04, 0x32, 0xA5, 0xA5, 0xAC, 0x71, 0x9C, 0xAA, 0x99, 
+0x9C, 0x2E, 0x25, 0x31, 0xFE, 0xA5, 0x36, 0xFE, 0x08, 0x65, 0xA4, 0x67, 0x59, 0x7A, 0x6F, 0x01, 
+0xFE, 0x6B, 0x70, 0x31, 0x2C, 0x31, 0xCD, 0xFE, 0x63, 0x4F, 0x35, 0xA3, 0x68, 0x24, 0x15, 0xA3, 
+0x77, 0x9A, 0xBB, 0xFE, 0x9C, 0xD4, 0x31, 0xC4, 0xFE, 0x9C, 0xF5, 0x3C, 0x29, 0x15, 0x24, 0x1C, 
+0x54, 0xAC, 0x31, 0x31, 0xCD, 0x27, 0x95, 0xB9, 0x96, 0x96, 0xA4, 0x77, 0x66, 0x5A, 0x5E, 0x7D, 
+0x9D, 0xCC, 0xA3, 0x99, 0xA8, 0x58, 0xA4, 0x67, 0xA4, 0x77, 0xA0, 0x9A, 0xC0, 0x27, 0x50, 0x9D, 
+0x98, 0x9A, 0xA9, 0x99, 0x99, 0x9F, 0x76, 0x1B, 0x65, 0xC0, 0xA2, 0x76, 0x5F, 0x9D, 0xDB, 0x3F, 
+0x31, 0xC0, 0x2A, 0xC0, 0x66, 0x5F, 0xFE, 0x6D, 0x37, 0x95, 0xDE, 0xFE, 0xBE, 0xBC, 0x31, 0xC0, 
+0x95, 0xEF, 0xFE, 0x73, 0xB0, 0xFE, 0x39, 0xC9, 0x97, 0xCD, 0x9C, 0xAB, 0xC0, 0x65, 0xA2, 0x66, 
+0x9F, 0x9B, 0x6E, 0xA4, 0x75, 0xA8, 0x44, 0xAE, 0x20, 0xFE, 0xCE, 0x59, 0x31, 0x61, 0x9C, 0x8C, 
+0xFE, 0x64, 0x76, 0xFE, 0x23, 0x34, 0xA5, 0x66, 0x51, 0x6E, 0x6E, 0x9D, 0xAA, 0x64, 0x9D, 0xAB, 
+0x66, 0xA2, 0x64, 0xFE, 0x54, 0xF6, 0xA8, 0x32, 0x5E, 0x57, 0x7A, 0x40, 0xA7, 0x84, 0xAB, 0x92, 
+0x9E, 0xC9, 0x9F, 0x68, 0x96, 0x7E, 0x9B, 0x8D, 0x7E, 0xA2, 0x67, 0x51, 0xA7, 0x93, 0x2C, 0x68, 
+0x2A, 0x31, 0x2C, 0x31, 0xC0, 0x2C, 0x98, 0x7D, 0x39, 0x7E, 0x62, 0x12, 0x2E, 0x46, 0xFE, 0x85, 
+0x55, 0xFE, 0xDF, 0x7D, 0x2C, 0x31, 0xC0, 0xFE, 0x73, 0xB1, 0xFE, 0x10, 0x86, 0x24, 0x55, 0x7E, 
+0x6F, 0x9D, 0xA9, 0xFE, 0xBE, 0x1A, 0x31, 0x2C, 0x31, 0xCC, 0x2C, 0xFE, 0xAD, 0x77, 0xFE, 0x10, 
+0x85, 0x24, 0x29, 0x15, 0x24, 0x9C, 0xAA, 0xFE, 0x94, 0xD4, 0x31, 0xC4, 0xFE, 0x9C, 0xF5, 0x3C, 
+0x29, 0x15, 0x29, 0x24, 0x35, 0xFE, 0x84, 0x53, 0x2C, 0x31, 0xC6, 0x2C, 0x31, 0x56, 0x31, 0xC1, 
+0x99, 0x97, 0x92, 0xBA, 0xA4, 0x54, 0x1B, 0x66, 0xA2, 0x76, 0x20, 0x63, 0xAB, 0x68, 0xA6, 0x88, 
+0x31, 0xC7, 0x9F, 0x76, 0x95, 0xAA, 0x98, 0xC9, 0xA4, 0x44, 0x9D, 0xAA, 0x6E, 0xC0, 0x08, 0x9F, 
+0xBE, 0xB1, 0x25, 0xA2, 0x88, 0x31, 0x2A, 0x31, 0xFE, 0x95, 0xF8, 0x95, 0xBE, 0xFE, 0xDF, 0x9F, 
+0x25, 0x95, 0xEE, 0xFE, 0x62, 0xEE, 0x3D, 0xA6, 0x55, 0x1A, 0x6F, 0x7F, 0x7E, 0x6E, 0x65, 0x6E, 
+0x52, 0x5A, 0x55, 0x66, 0xA4, 0x65, 0xFE, 0x94, 0x92, 0xFE, 0xFF, 0xBE, 0x31, 0x5A, 0xFE, 0x95, 
+0xB9, 0xFE, 0x2B, 0x33, 0xA5, 0x46, 0x66, 0x6F, 0x5A, 0x9C, 0xC8, 0x52, 0xC0, 0x66, 0x9F, 0x86, 
+0xFE, 0x54, 0xF7, 0xA9, 0x21, 0x40, 0xA1, 0x79, 0x76, 0x65, 0xA4, 0x84, 0xAB, 0x72, 0x31, 0xC0, 
+0x99, 0x6D, 0x9A, 0x7A, 0x9C, 0xAB, 0x4A, 0xA2, 0xA7, 0xAE, 0x80, 0x31, 0x59, 0x31, 0x2E, 0x31, 
+0x20, 0x26, 0x93, 0x6E, 0x9D, 0x9A, 0xA4, 0xB7, 0xA8, 0x74, 0x31, 0x9F, 0x59, 0xFE, 0x7D, 0xD7, 
+0x9D, 0xDA, 0x31, 0xC0, 0x56, 0x2A, 0xFE, 0x52, 0xAD, 0xFE, 0x08, 0x86, 0xA4, 0x66, 0xC0, 0x55, 
+0x15, 0xA6, 0x64, 0xFE, 0xEF, 0x7E, 0x31, 0xC4, 0x66, 0x31, 0xC8, 0x95, 0xEF, 0xFE, 0x10, 0xC6, 
+0xA2, 0x89, 0x55, 0x15, 0x29, 0x9A, 0xCC, 0xFE, 0x94, 0xD4, 0x31, 0xC4, 0xFE, 0x9C, 0xF5, 0xFE, 
+0x08, 0x66, 0x24, 0xC0, 0x15, 0x29, 0x01, 0xFE, 0xA5, 0x36, 0x31, 0xCB, 0x2C, 0x9F, 0x76, 0x8F, 
+0xDC, 0xA1, 0x42, 0xA1, 0x89, 0x66, 0x1B, 0x68, 0x9E, 0xBC, 0xB1, 0x26, 0x31, 0xC7, 0x2C, 0xC0, 
+0x31, 0xC0, 0x97, 0xA7, 0x95, 0xBA, 0xA4, 0x54, 0x9D, 0x9A, 0xA2, 0x78, 0x58, 0x9D, 0xBB, 0xA6, 
+0x79, 0xAE, 0x46, 0x2C, 0x6E, 0x9A, 0x9D, 0xFE, 0x84, 0xF5, 0xFE, 0xEF, 0x9F, 0xA1, 0x97, 0xFE, 
+0x94, 0x94, 0xFE, 0x19, 0x07, 0x3C, 0x15, 0xFE, 0xC6, 0x7C, 0x31, 0xC1, 0x56, 0x31, 0x2C, 0x65, 
+0x31, 0xC0, 0x2C, 0x31, 0xC0, 0x10, 0x29, 0x2E, 0x2A, 0x31, 0xFE, 0xBE, 0x9C, 0xFE, 0x33, 0x53, 
+0xA2, 0x59, 0x7F, 0x65, 0xA2, 0x65, 0x9D, 0x9A, 0x61, 0x62, 0x65, 0x6D, 0xFE, 0x54, 0xF6, 0x3A, 
+0x3E, 0x72, 0x6E, 0x49, 0x3A, 0xA8, 0x94, 0x2E, 0x31, 0x4A, 0x98, 0xBD, 0x9A, 0x8B, 0x9B, 0xAA, 
+0xAA, 0x74, 0x31, 0x29, 0x2C, 0x69, 0x31, 0xC0, 0x9C, 0x7A, 0x98, 0x9C, 0xA7, 0x75, 0x31, 0x2A, 
+0x9C, 0x5A, 0xFE, 0x75, 0xD8, 0x94, 0xFE, 0xFE, 0xDF, 0xBE, 0x2E, 0x31, 0xC0, 0x55, 0xFE, 0x3A, 
+0x0B, 0x01, 0x24, 0xC0, 0x6E, 0x01, 0xFE, 0x52, 0x8D, 0x2C, 0x31, 0x2C, 0xC0, 0x31, 0xC2, 0x2C, 
+0x31, 0xC7, 0x97, 0xDE, 0xFE, 0x21, 0x28, 0x9C, 0xAB, 0x24, 0xC0, 0x29, 0x9B, 0xBB, 0xFE, 0x94, 
+0xB4, 0xFE, 0xFF, 0xFF, 0xC4, 0x0F, 0x3C, 0x24, 0x18, 0x24, 0xC0, 0x54, 0xFE, 0xB5, 0xD8, 0x31, 
+0xCC, 0x97, 0xA8, 0x92, 0xCB, 0xA7, 0x21, 0x62, 0xC0, 0x25, 0x9C, 0xCB, 0xB0, 0x35, 0x31, 0x62, 
+0x2A, 0x31, 0xC0, 0x2C, 0xC0, 0x31, 0xC3, 0x2C, 0xC0, 0x31, 0x95, 0xA8, 0x11, 0xA4, 0x64, 0x9D, 
+0x9A, 0xA1, 0x79, 0x7C, 0x9D, 0xBC, 0xB1, 0x27, 0x31, 0xC0, 0xFE, 0xA5, 0xB7, 0x26, 0x2C, 0xFE, 
+0x62, 0xCE, 0xFE, 0x00, 0x46, 0xA4, 0x56, 0x7E, 0x15, 0xFE, 0xCE, 0x9C, 0xAA, 0x31, 0x2A, 0x31, 
+0xC3, 0x2C, 0x31, 0xC0, 0x2C, 0xC0, 0x31, 0xC2, 0x65, 0x31, 0x97, 0xAF, 0xFE, 0x3B, 0xB4, 0xA0, 
+0x7A, 0x75, 0x3D, 0x6E, 0x9D, 0xA9, 0x09, 0x04, 0x69, 0x36, 0xAD, 0x00, 0xAB, 0x11, 0x39, 0xC0, 
+0x6F, 0x5A, 0x39, 0xA0, 0xC7, 0xAB, 0x72, 0x31, 0xC1, 0x9D, 0x8A, 0xC0, 0x31, 0xC5, 0x2C, 0x31, 
+0x9D, 0x7A, 0x99, 0x7A, 0x2D, 0xFE, 0x3B, 0x90, 0xFE, 0xA5, 0xF9, 0xFE, 0xFF, 0xFF, 0xC0, 0x2C, 
+0x25, 0x26, 0xFE, 0x31, 0xCA, 0x97, 0xDE, 0x6F, 0x10, 0xA3, 0x66, 0x01, 0xFE, 0x5A, 0xEE, 0x31, 
+0xC3, 0x2C, 0x31, 0xCA, 0x99, 0xCD, 0xFE, 0x31, 0x89, 0x10, 0x24, 0x29, 0x24, 0x3C, 0x3B, 0x31, 
+0xC4, 0xFE, 0x9C, 0xF5, 0xFE, 0x08, 0x65, 0x29, 0x10, 0x24, 0xC0, 0x50, 0xFE, 0xC6, 0x39, 0x25, 
+0x31, 0xCA, 0x59, 0x90, 0xDA, 0x9D, 0x75, 0x5E, 0xA1, 0x98, 0x55, 0x0F, 0xA7, 0x79, 0x27, 0x77, 
+0x31, 0x2A, 0x31, 0xC6, 0x25, 0x31, 0x2C, 0x31, 0x58, 0x8F, 0xDB, 0x0F, 0xA3, 0x66, 0x53, 0x14, 
+0x77, 0xA7, 0x7A, 0x31, 0x9B, 0x9C, 0xA2, 0x85, 0x51, 0xFE, 0x3A, 0x2A, 0xFE, 0x00, 0x65, 0x24, 
+0xC0, 0x1C, 0x7C, 0xFE, 0xCE, 0x7A, 0x31, 0xC0, 0x2C, 0x31, 0x2C, 0x31, 0x2C, 0x31, 0xCA, 0x95, 
+0xBF, 0xFE, 0x43, 0x93, 0xA0, 0x5C, 0x79, 0x6E, 0x5D, 0x9D, 0xBA, 0x9D, 0xA9, 0x62, 0x04, 0x55, 
+0xFE, 0x3C, 0x74, 0xAC, 0x12, 0x7E, 0x9D, 0xAA, 0xA2, 0x66, 0xC0, 0x56, 0xC0, 0xA3, 0xA5, 0xA4, 
+0xA6, 0x12, 0x31, 0xC2, 0x2A, 0x31, 0x2C, 0x31, 0x26, 0x9C, 0x89, 0x99, 0x8C, 0x9D, 0x8B, 0x9B, 
+0x9C, 0xFE, 0x2B, 0x54, 0xA9, 0x80, 0xFE, 0xFF, 0xFF, 0x62, 0x25, 0x31, 0xC0, 0x9C, 0xBB, 0xFE, 
+0x31, 0xAA, 0x98, 0xCD, 0xA2, 0x77, 0x69, 0x24, 0x9D, 0xAA, 0xFE, 0x5A, 0xEE, 0x31, 0xD0, 0x37, 
+0xFE, 0x21, 0x28, 0x24, 0x1C, 0x1D, 0x6F, 0x9B, 0xBB, 0x3B, 0xFE, 0xFF, 0xFF, 0xC4, 0xFE, 0x9C, 
+0xF5, 0xFE, 0x08, 0x65, 0xA5, 0x66, 0x1D, 0x15, 0xA2, 0x78, 0x09, 0xFE, 0xBD, 0xD8, 0x31, 0x66, 
+0x31, 0xC6, 0x25, 0x31, 0xC0, 0x9E, 0x77, 0x8F, 0xD9, 0x5C, 0x1B, 0x57, 0xA2, 0x74, 0x9D, 0xBC, 
+0xAF, 0x47, 0x31, 0xCC, 0x2A, 0x31, 0xC0, 0x97, 0xA7, 0x95, 0xB9, 0xA3, 0x36, 0x9F, 0xB9, 0x69, 
+0x66, 0xA3, 0x8A, 0xB0, 0x35, 0x2C, 0x31, 0xFE, 0x63, 0x4F, 0xFE, 0x00, 0x46, 0xA6, 0x54, 0x15, 
+0x7B, 0x15, 0xC0, 0x00, 0x31, 0xCC, 0x2C, 0x31, 0xC0, 0x56, 0x31, 0x2A, 0xFE, 0xB6, 0x7B, 0xFE, 
+0x3B, 0x74, 0xA1, 0x6A, 0x6E, 0x6C, 0x5A, 0x22, 0x9D, 0xAA, 0x61, 0x7E, 0x41, 0xA9, 0x22, 0xAB, 
+0x21, 0x0D, 0x5A, 0x39, 0x05, 0x67, 0x64, 0x66, 0x7D, 0x0C, 0xA3, 0x87, 0xA3, 0x75, 0x7B, 0x7A, 
+0x59, 0x52, 0x9D, 0x8B, 0x9D, 0x89, 0x44, 0xA2, 0x76, 0xFE, 0x54, 0xF7, 0xFE, 0x23, 0x34, 0xA2, 
+0xC4, 0xFE, 0xDF, 0x5F, 0x31, 0x65, 0x31, 0xC1, 0x25, 0xFE, 0x39, 0xEA, 0x96, 0xDE, 0x1D, 0x6E, 
+0x6B, 0x01, 0xFE, 0x52, 0x8C, 0x31, 0xC4, 0x25, 0x31, 0xC1, 0x2C, 0x31, 0xC3, 0x2C, 0x2A, 0x37, 
+0xFE, 0x21, 0x08, 0x1C, 0x7E, 0x55, 0x29, 0x3C, 0xFE, 0x94, 0xB4, 0x31, 0xC2, 0x2A, 0x31, 0xFE, 
+0x9C, 0xF5, 0x3C, 0x1D, 0xC0, 0x1C, 0x29, 0x50, 0xFE, 0xBD, 0xF9, 0x31, 0xC9, 0x66, 0x31, 0x9A, 
+0x87, 0x93, 0xB7, 0xA2, 0x66, 0x73, 0x1B, 0x69, 0xA1, 0xAC, 0xAF, 0x47, 0x31, 0xC1, 0x2C, 0x31, 
+0xCB, 0x9D, 0x86, 0x90, 0xDB, 0xA2, 0x44, 0x1B, 0x7E, 0x1B, 0xA0, 0x9A, 0xB0, 0x57, 0xA1, 0x9A, 
+0x31, 0xFE, 0x63, 0x4F, 0x3C, 0x29, 0x56, 0x24, 0x59, 0x15, 0xFE, 0xCE, 0x7A, 0x31, 0xD1, 0x69, 
+0x2E, 0xFE, 0xAE, 0x5C, 0xFE, 0x2B, 0xB4, 0x67, 0x04, 0x66, 0x04, 0x9D, 0xA8, 0x69, 0x9D, 0xA9, 
+0xA1, 0x89, 0x38, 0xA3, 0x55, 0xA9, 0x32, 0xA9, 0x23, 0xA4, 0x65, 0x0D, 0x50, 0x5B, 0x39, 0x36, 
+0x69, 0x62, 0xC2, 0x75, 0xA1, 0x79, 0x2D, 0xA3, 0x66, 0x9C, 0xCB, 0xFE, 0x3B, 0xD4, 0x99, 0xCD, 
+0x16, 0xFE, 0xC6, 0xBD, 0xAA, 0x40, 0x31, 0xC2, 0x66, 0xC0, 0xFE, 0x42, 0x4B, 0x09, 0xA2, 0x77, 
+0x1A, 0xC0, 0x62, 0x26, 0xFE, 0xEF, 0x9E, 0x31, 0xC4, 0x2C, 0x31, 0xC8, 0xFE, 0xCE, 0x5A, 0x1D, 
+0x24, 0x55, 0x29, 0x24, 0x3C, 0xFE, 0x94, 0xD4, 0x31, 0xC2, 0x2A, 0x31, 0xFE, 0x9C, 0xF5, 0x3C, 
+0x1D, 0xC0, 0x57, 0x29, 0x0E, 0x1F, 0x31, 0xCB, 0x98, 0x98, 0x95, 0xA6, 0x6D, 0x9F, 0x9C, 0x1B, 
+0x55, 0xA3, 0xAA, 0x2A, 0x31, 0xC0, 0x2A, 0x31, 0xCB, 0x2C, 0x5C, 0x8F, 0xDA, 0x1B, 0x6B, 0x1E, 
+0x1B, 0xA0, 0x9A, 0xAD, 0x69, 0x31, 0xC0, 0xFE, 0x63, 0x2F, 0xFE, 0x08, 0x66, 0x29, 0x21, 0x24, 
+0x69, 0x15, 0xFE, 0xCE, 0x7A, 0x31, 0xCF, 0x66, 0x31, 0xFE, 0xBD, 0xD7, 0xAC, 0x22, 0xA4, 0x56, 
+0xFE, 0x96, 0x1A, 0xFE, 0x3B, 0xB3, 0x9F, 0x8C, 0xA2, 0x68, 0x50, 0x7D, 0x66, 0x9C, 0x9A, 0x71, 
+0x3D, 0x38, 0x5A, 0x16, 0xA8, 0x32, 0xA8, 0x33, 0xA5, 0x54, 0x7B, 0x6E, 0xC0, 0x5A, 0x56, 0x6E, 
+0x6B, 0x0A, 0x5A, 0x39, 0x9A, 0xDD, 0x98, 0xCD, 0x98, 0xCF, 0x66, 0xA3, 0x93, 0xFE, 0xAE, 0x5A, 
+0x2E, 0x7A, 0x2A, 0xC0, 0x31, 0xC2, 0xFE, 0x63, 0x4F, 0x09, 0xA3, 0x67, 0x69, 0x24, 0xC0, 0x7D, 
+0xFE, 0xCE, 0x9B, 0x31, 0x2C, 0x31, 0xC6, 0x2C, 0x31, 0xC2, 0x2C, 0xC0, 0xFE, 0xB5, 0x97, 0xFE, 
+0x10, 0x85, 0x24, 0x21, 0x24, 0xC0, 0x3C, 0xFE, 0x94, 0xD4, 0x31, 0xC2, 0x2A, 0x31, 0xFE, 0x9C, 
+0xD4, 0x3C, 0x1D, 0xC0, 0x57, 0x29, 0x0E, 0x1F, 0x31, 0xCB, 0x96, 0xA8, 0x97, 0x96, 0xA2, 0x66, 
+0x9F, 0x9B, 0x6D, 0x0F, 0xA4, 0x8A, 0xAF, 0x46, 0x31, 0xCB, 0x2C, 0x31, 0xC1, 0x20, 0x90, 0xCA, 
+0x0F, 0xA1, 0x89, 0x0F, 0x23, 0x9F, 0x9B, 0xAC, 0x69, 0x31, 0xC0, 0xFE, 0x63, 0x2F, 0x3C, 0x29, 
+0x24, 0xC0, 0x1D, 0x56, 0xFE, 0xCE, 0x7A, 0x31, 0xD0, 0x66, 0xFE, 0x73, 0x90, 0x95, 0xED, 0x31, 
+0xC0, 0xFE, 0xA6, 0x1A, 0xFE, 0x33, 0x93, 0xA1, 0x6A, 0xA2, 0x78, 0x9D, 0xB9, 0x6E, 0x6E, 0x16, 
+0x52, 0x61, 0x6E, 0xC0, 0x55, 0x6E, 0xA4, 0x66, 0xA7, 0x33, 0xA2, 0x77, 0xA3, 0x76, 0xA2, 0x67, 
+0x7A, 0x13, 0x02, 0x51, 0x9B, 0xBC, 0x9B, 0xB9, 0x9C, 0xBC, 0x9D, 0x9B, 0xA5, 0x56, 0xA5, 0x73, 
+0xFE, 0xB6, 0x7B, 0x2C, 0x31, 0x65, 0x31, 0xC0, 0x55, 0x31, 0xC1, 0xFE, 0x8C, 0x73, 0xFE, 0x08, 
+0x65, 0x24, 0x55, 0x24, 0x29, 0x9C, 0xA9, 0xFE, 0x8C, 0x94, 0x31, 0xC3, 0x2C, 0x31, 0xC4, 0x25, 
+0x31, 0xC2, 0xFE, 0x7C, 0x11, 0xFE, 0x08, 0x64, 0x24, 0x29, 0x15, 0x24, 0x3C, 0xFE, 0x94, 0xD4, 
+0x31, 0xC2, 0x2A, 0x31, 0x03, 0x3C, 0x29, 0x1D, 0x1C, 0x29, 0x0E, 0x1F, 0x31, 0xCB, 0x97, 0xA8, 
+0x95, 0xA7, 0xA4, 0x44, 0x9D, 0xBC, 0x6E, 0x0F, 0xA3, 0x8A, 0xAF, 0x56, 0x31, 0xCD, 0x2C, 0x31, 
+0x9E, 0x87, 0x91, 0xC9, 0x9F, 0x65, 0xA0, 0x8A, 0x16, 0xA2, 0x77, 0x62, 0xAF, 0x47, 0x31, 0xC0, 
+0xFE, 0x63, 0x2F, 0x3C, 0x1D, 0x24, 0x66, 0x1D, 0x15, 0x3B, 0x31, 0xCD, 0x2C, 0x31, 0x64, 0x31, 
+0xFE, 0x84, 0x53, 0xFE, 0x00, 0x03, 0xFE, 0x63, 0x0E, 0xFE, 0xFF, 0xBD, 0x31, 0xFE, 0xB6, 0x9D, 
+0xFE, 0x43, 0xD5, 0x9D, 0x8B, 0xA2, 0x78, 0x5A, 0x68, 0x6B, 0x7A, 0x50, 0x9C, 0xBA, 0xC0, 0x7F, 
+0x56, 0xC0, 0x50, 0x3D, 0x09, 0xC0, 0x69, 0x3D, 0x65, 0x29, 0x62, 0x09, 0xA3, 0x67, 0x7E, 0xA4, 
+0x84, 0xFE, 0xBE, 0x9B, 0xAB, 0x41, 0x7A, 0xC5, 0x2C, 0x31, 0xFE, 0xC6, 0x39, 0x0E, 0x24, 0x1D, 
+0x56, 0xA2, 0x77, 0x9D, 0xAA, 0xAA, 0x31, 0xFE, 0xF7, 0xBE, 0x31, 0x69, 0x31, 0xC7, 0x66, 0x31, 
+0x2C, 0xC0, 0x5A, 0xFE, 0x31, 0xA9, 0x98, 0xCD, 0xA3, 0x67, 0x56, 0x24, 0xC0, 0x3C, 0x00, 0x31, 
+0xC2, 0x2A, 0x31, 0x03, 0x3C, 0x29, 0x65, 0x1C, 0x29, 0x09, 0xFE, 0xBD, 0xF9, 0x31, 0xCB, 0x9A, 
+0x97, 0x91, 0xCA, 0xA4, 0x43, 0x1B, 0xC0, 0x55, 0xA0, 0xAB, 0xB3, 0x23, 0x9E, 0xCD, 0x31, 0xCB, 
+0x2C, 0xC0, 0x31, 0x9C, 0x87, 0x92, 0xC9, 0x1B, 0x6B, 0x79, 0x6F, 0x27, 0xB1, 0x46, 0x31, 0xC0, 
+0xFE, 0x63, 0x0F, 0x3C, 0x1D, 0x24, 0x1C, 0x1D, 0x15, 0x3B, 0x31, 0xCF, 0x68, 0x31, 0xFE, 0x73, 
+0xD2, 0x3C, 0xC0, 0xFE, 0x52, 0x8C, 0xFE, 0xF7, 0x7E, 0x31, 0x99, 0xAD, 0xFE, 0x5C, 0x54, 0x99, 
+0x9E, 0xA1, 0x7A, 0xA2, 0x78, 0xC0, 0x01, 0x64, 0x7E, 0x65, 0x9D, 0x9A, 0x3D, 0x04, 0x79, 0xC0, 
+0x38, 0x66, 0x38, 0x6B, 0x7E, 0x6F, 0x2E, 0x67, 0x71, 0xA8, 0x50, 0xFE, 0xCF, 0x1E, 0xA7, 0x72, 
+0x9D, 0xAA, 0x31, 0xC1, 0x2C, 0x31, 0xC3, 0x51, 0xFE, 0x39, 0xC9, 0x09, 0xA4, 0x66, 0x15, 0x24, 
+0xC0, 0x9D, 0x98, 0xFE, 0x94, 0xB4, 0xFE, 0xFF, 0xFF, 0xC4, 0x69, 0x31, 0xC4, 0x2C, 0x31, 0xFE, 
+0x94, 0xD6, 0x3A, 0xA3, 0x77, 0x24, 0x15, 0x24, 0x29, 0x3C, 0xFE, 0x94, 0xD4, 0x31, 0xC4, 0x03, 
+0x3C, 0x29, 0x1D, 0x1C, 0x29, 0x09, 0x1F, 0x31, 0xCB, 0x9D, 0x87, 0x8F, 0xDA, 0x14, 0x6B, 0xC1, 
+0x62, 0xAC, 0x56, 0x2A, 0x31, 0x2C, 0x31, 0xC8, 0x2C, 0x31, 0xC0, 0x2A, 0x96, 0xA8, 0x97, 0xA8, 
+0x1B, 0x6B, 0x1E, 0x57, 0xA2, 0x99, 0xB1, 0x36, 0x31, 0xC0, 0xFE, 0x63, 0x0F, 0x3C, 0xA4, 0x55, 
+0x24, 0x1C, 0x7D, 0x15, 0xFE, 0xCE, 0x5A, 0x31, 0xCC, 0x2C, 0x31, 0xC2, 0xFE, 0x84, 0x12, 0xFE, 
+0x00, 0x25, 0xA7, 0x45, 0x9C, 0xA9, 0xAA, 0x42, 0xFE, 0xD6, 0x7B, 0x31, 0x46, 0xFE, 0x9D, 0xD9, 
+0xFE, 0x43, 0xB4, 0x13, 0xA3, 0x57, 0xA2, 0x77, 0xA2, 0x76, 0x5A, 0x61, 0x36, 0x3D, 0x36, 0x55, 
+0x55, 0x6B, 0x27, 0x6F, 0xC2, 0x61, 0xA3, 0x96, 0xFE, 0xA5, 0xDA, 0xFE, 0xF7, 0xFF, 0x31, 0xFE, 
+0xA5, 0x56, 0x9D, 0xAA, 0x31, 0x2C, 0x31, 0xC4, 0x2C, 0x31, 0xFE, 0x84, 0x12, 0xFE, 0x08, 0x65, 
+0xA5, 0x55, 0x1A, 0x1C, 0x29, 0x50, 0x22, 0xFE, 0xC6, 0x3A, 0x31, 0x25, 0x31, 0xC7, 0x52, 0x2C, 
+0x98, 0xCD, 0xFE, 0x29, 0x69, 0x9A, 0xBC, 0x1D, 0x15, 0x6F, 0xC0, 0x29, 0x3C, 0x00, 0x31, 0x2C, 
+0x31, 0xC2, 0x03, 0x3C, 0x29, 0x1D, 0x1C, 0x29, 0x09, 0xFE, 0xBD, 0xF9, 0x31, 0xCB, 0x58, 0x91, 
+0xCA, 0x9C, 0x86, 0x1B, 0x1E, 0x5E, 0x52, 0xA1, 0xAA, 0xB2, 0x24, 0x31, 0x2C, 0x31, 0xC7, 0x2A, 
+0x63, 0x31, 0x2A, 0xA0, 0x55, 0x36, 0x1B, 0xC0, 0x20, 0x1E, 0x57, 0xA8, 0x77, 0x31, 0xC1, 0xFE, 
+0x5B, 0x0F, 0x01, 0x1A, 0x29, 0x1C, 0x7D, 0x15, 0xFE, 0xC6, 0x59, 0xAD, 0x21, 0xCF, 0x2C, 0xC0, 
+0xFE, 0x83, 0xF1, 0xFE, 0x08, 0x44, 0x15, 0x7A, 0x01, 0xA4, 0x55, 0xFE, 0x94, 0xD5, 0x2C, 0xC0, 
+0x9B, 0x8C, 0xFE, 0x85, 0x99, 0xFE, 0x43, 0xD6, 0x9D, 0x99, 0x57, 0xA2, 0x67, 0x6F, 0x7E, 0x6E, 
+0x65, 0xA0, 0x8A, 0xC0, 0x09, 0x66, 0x50, 0x69, 0xA2, 0x77, 0xA3, 0x76, 0xAB, 0x71, 0xFE, 0xD7, 
+0x5E, 0x2A, 0x2C, 0xFE, 0x84, 0x33, 0xFE, 0x18, 0xE6, 0xFE, 0xDE, 0xBB, 0x2A, 0x31, 0xC7, 0x98, 
+0xCE, 0xFE, 0x21, 0x28, 0x15, 0xA2, 0x76, 0x6B, 0x15, 0x29, 0x15, 0xA5, 0x64, 0xFE, 0xC6, 0x39, 
+0xAE, 0x10, 0xC0, 0x66, 0xC0, 0x31, 0xC2, 0x2C, 0x31, 0xC0, 0x23, 0xFE, 0x39, 0xC8, 0xFE, 0x08, 
+0x87, 0xA3, 0x76, 0x1D, 0x29, 0x15, 0x29, 0x21, 0x9D, 0xA9, 0x00, 0x31, 0x2C, 0x31, 0xC2, 0xFE, 
+0x9C, 0xD4, 0x3C, 0x29, 0x1D, 0x1C, 0x29, 0x9D, 0xA9, 0xFE, 0xBD, 0xF9, 0x31, 0xCA, 0x2C, 0x31, 
+0x96, 0x96, 0x96, 0xB9, 0x1B, 0x76, 0x4D, 0x6E, 0x9D, 0xCD, 0xA6, 0x9A, 0xAE, 0x24, 0x31, 0x65, 
+0x31, 0xC6, 0x2A, 0x31, 0xC0, 0x58, 0x93, 0xCA, 0x99, 0x98, 0xA3, 0x54, 0xA0, 0x8A, 0x1B, 0x76, 
+0x18, 0xAF, 0x34, 0x31, 0xC1, 0xFE, 0x63, 0x0E, 0xFE, 0x08, 0x65, 0x1D, 0x15, 0x7B, 0xC0, 0x58, 
+0x33, 0x31, 0xD1, 0xFE, 0x7B, 0xD1, 0x35, 0x24, 0x51, 0x24, 0x21, 0x9D, 0xA8, 0xFE, 0xB5, 0xB8, 
+0x31, 0xC1, 0x02, 0x97, 0xCD, 0xFE, 0x74, 0xB6, 0x99, 0xAD, 0x42, 0x46, 0xC0, 0x6F, 0x59, 0x2E, 
+0x7A, 0x62, 0xA7, 0x62, 0xA5, 0x63, 0x2A, 0xFE, 0xEF, 0xFF, 0xA0, 0xA8, 0xC0, 0xFE, 0xBD, 0xF9, 
+0xFE, 0x3A, 0x0C, 0xFE, 0x00, 0x24, 0xFE, 0x5A, 0xED, 0x31, 0xC8, 0x69, 0x31, 0xFE, 0x83, 0xF1, 
+0xFE, 0x10, 0x65, 0xA5, 0x56, 0x52, 0x1D, 0xC0, 0x6B, 0x09, 0xA3, 0x66, 0xFE, 0x84, 0x32, 0xFE, 
+0xEF, 0x7E, 0x31, 0xC5, 0x52, 0xFE, 0x9D, 0x15, 0xFE, 0x21, 0x68, 0x01, 0x22, 0x0E, 0x22, 0x15, 
+0x1D, 0x15, 0x7F, 0x01, 0xFE, 0x9C, 0xD4, 0x31, 0xC4, 0x03, 0xFE, 0x00, 0x65, 0x24, 0x1D, 0x15, 
+0xA2, 0x66, 0x64, 0xFE, 0xB5, 0xB7, 0x31, 0xCB, 0x25, 0x9F, 0x76, 0x8F, 0xCB, 0xA2, 0x53, 0x1B, 
+0xC0, 0x5F, 0x65, 0x66, 0xA8, 0x77, 0xAB, 0x57, 0x31, 0xC7, 0x62, 0x31, 0x9F, 0x66, 0x94, 0xBA, 
+0x13, 0x19, 0x6B, 0x63, 0xA3, 0x54, 0x9D, 0xBB, 0xA2, 0xAB, 0xB1, 0x25, 0x7B, 0x66, 0xC0, 0xFE, 
+0x63, 0x0F, 0x08, 0xA3, 0x76, 0x1C, 0x7F, 0xA2, 0x76, 0x9D, 0x98, 0xFE, 0xC6, 0x5A, 0x31, 0xD1, 
+0xFE, 0x7B, 0xF1, 0x3A, 0xA3, 0x67, 0x76, 0x15, 0x29, 0x9B, 0xB9, 0x0B, 0x31, 0xC0, 0x2C, 0x31, 
+0xC0, 0x5A, 0x42, 0x9A, 0xBD, 0x9A, 0xAB, 0x9D, 0x9A, 0x69, 0x7F, 0x7F, 0xA3, 0x65, 0xA6, 0x65, 
+0x26, 0x2E, 0x7A, 0x52, 0x0B, 0xFE, 0x52, 0xAC, 0x3A, 0x3C, 0x6E, 0xFE, 0xAD, 0x76, 0x31, 0x66, 
+0x31, 0xC8, 0x24, 0xFE, 0x3A, 0x0A, 0x94, 0xFF, 0xA3, 0x67, 0x56, 0x7F, 0xC1, 0x15, 0x3A, 0xA7, 
+0x55, 0xFE, 0x73, 0x91, 0xFE, 0xAD, 0x77, 0x33, 0xA3, 0x65, 0x6B, 0x37, 0xFE, 0x7B, 0xD2, 0xFE, 
+0x39, 0xEB, 0x95, 0xDE, 0x7F, 0xA4, 0x56, 0x9D, 0xBA, 0x24, 0x1C, 0x24, 0xC1, 0xA2, 0x77, 0x99, 
+0xBC, 0xFE, 0x94, 0xB4, 0x31, 0x2A, 0x31, 0xC0, 0x65, 0x31, 0x3B, 0x3C, 0x29, 0x1C, 0x6E, 0x7F, 
+0x3A, 0xFE, 0xBD, 0xF9, 0x31, 0xCC, 0x2A, 0x97, 0x97, 0x93, 0xCB, 0xA3, 0x64, 0xA2, 0x79, 0x16, 
+0x6E, 0x7E, 0x0A, 0xA3, 0x8A, 0xAC, 0x35, 0xA4, 0x99, 0x7F, 0x31, 0xC3, 0x2A, 0x48, 0x98, 0xB9, 
+0x97, 0xBA, 0x9E, 0x86, 0x5F, 0xC2, 0x69, 0x9D, 0xCD, 0xB1, 0x14, 0x31, 0xC0, 0x2C, 0x31, 0xFE, 
+0x63, 0x30, 0x34, 0x29, 0x66, 0x41, 0x1A, 0x66, 0xFE, 0xC6, 0x5A, 0x31, 0x2C, 0x31, 0xCD, 0x2A, 
+0x31, 0xFE, 0x7B, 0xF0, 0xFE, 0x00, 0x43, 0x29, 0x50, 0x1A, 0x29, 0x3A, 0x0B, 0x31, 0x2C, 0x31, 
+0x2C, 0xC0, 0x25, 0x31, 0xC7, 0x9D, 0xA9, 0xFE, 0xC6, 0x19, 0xFE, 0x84, 0x32, 0xFE, 0x4A, 0x2B, 
+0x09, 0xC0, 0x15, 0x1C, 0xA5, 0x64, 0xFE, 0xEF, 0x7E, 0x31, 0xC9, 0x2C, 0x31, 0xFE, 0xCE, 0x5A, 
+0xFE, 0x29, 0x47, 0x9C, 0xAB, 0xA2, 0x79, 0x9D, 0x9A, 0x24, 0x51, 0x29, 0x7F, 0x10, 0x01, 0x7A, 
+0x18, 0xA2, 0x65, 0x09, 0xC0, 0x01, 0x10, 0x24, 0x1C, 0xC0, 0x10, 0x30, 0x1C, 0x24, 0x1C, 0x10, 
+0x29, 0x3C, 0xFE, 0x94, 0xB4, 0x31, 0xC4, 0x03, 0xFE, 0x00, 0x65, 0x1D, 0x10, 0x1C, 0x30, 0x09, 
+0xFE, 0xBE, 0x19, 0x31, 0xCD, 0xA0, 0x65, 0x91, 0xED, 0x9D, 0x53, 0x66, 0x7F, 0xA2, 0x76, 0x14, 
+0xC0, 0x66, 0x57, 0xA2, 0xAA, 0xA5, 0x56, 0xA4, 0x77, 0x7F, 0x6E, 0xC0, 0x9D, 0x99, 0x9D, 0xA9, 
+0x9B, 0x89, 0x0E, 0x14, 0x69, 0x1B, 0x7B, 0x55, 0x28, 0x9B, 0xDD, 0xAB, 0x47, 0x31, 0xC1, 0x69, 
+0x31, 0xFE, 0x63, 0x0E, 0xFE, 0x00, 0x45, 0x29, 0xC0, 0x1C, 0x22, 0x09, 0xFE, 0xC6, 0x3A, 0x31, 
+0xCD, 0x2C, 0x31, 0xC1, 0x13, 0xFE, 0x00, 0x44, 0x29, 0x15, 0xC1, 0x50, 0xFE, 0xAD, 0x97, 0x31, 
+0x51, 0x31, 0xC7, 0x2C, 0x31, 0x9D, 0xAB, 0xFE, 0x5B, 0x0E, 0xFE, 0x21, 0x28, 0x10, 0x2D, 0x6F, 
+0x10, 0x15, 0x7F, 0x2D, 0xFE, 0x73, 0x90, 0xFE, 0xFF, 0xFF, 0x65, 0x31, 0xCB, 0xFE, 0xBE, 0x18, 
+0xFE, 0x21, 0x06, 0x04, 0xA4, 0x67, 0x15, 0x38, 0x24, 0x15, 0x6F, 0x24, 0x29, 0x15, 0x24, 0x29, 
+0x1A, 0x22, 0xC0, 0x15, 0x24, 0x30, 0x9E, 0x97, 0xA4, 0x66, 0x29, 0x65, 0x15, 0x29, 0x24, 0x9C, 
+0xA9, 0xFE, 0x9C, 0xB4, 0x31, 0xC4, 0x03, 0xFE, 0x08, 0x84, 0x29, 0x24, 0xC0, 0x15, 0x68, 0xFE, 
+0xBD, 0xF8, 0x31, 0xCA, 0x2C, 0x31, 0x2C, 0x31, 0x9F, 0x76, 0x91, 0xBA, 0x9D, 0x87, 0x14, 0xC0, 
+0x16, 0xA1, 0x79, 0x6D, 0x20, 0x14, 0x1B, 0x16, 0x6B, 0x66, 0x16, 0x66, 0x59, 0x1B, 0x7F, 0x56, 
+0xC0, 0x27, 0x20, 0xC0, 0x07, 0xA8, 0x89, 0xAC, 0x57, 0x31, 0xC1, 0x2A, 0xC0, 0xFE, 0x63, 0x0E, 
+0x10, 0xA3, 0x66, 0x10, 0xA1, 0x89, 0x24, 0x7E, 0xFE, 0xCE, 0x7B, 0xAB, 0x31, 0x31, 0xCF, 0x2C, 
+0xFE, 0x84, 0x32, 0x35, 0x26, 0x69, 0x56, 0x30, 0x0E, 0xFE, 0xAD, 0x77, 0x31, 0xC5, 0x2A, 0x31, 
+0xC1, 0x25, 0xC0, 0x31, 0xFE, 0x63, 0x0F, 0xFE, 0x08, 0x66, 0x1F, 0x15, 0x7E, 0x1A, 0x15, 0xC0, 
+0x54, 0xFE, 0xBD, 0xF9, 0x31, 0xC0, 0x25, 0x31, 0xC7, 0x2C, 0x2A, 0x31, 0xC0, 0x07, 0xFE, 0x39, 
+0xCA, 0x94, 0xEF, 0x1D, 0x29, 0x15, 0x6F, 0xC0, 0x15, 0x29, 0xC0, 0x67, 0x1C, 0x24, 0x1A, 0x15, 
+0x36, 0x29, 0x2D, 0xFE, 0x39, 0xE9, 0x0B, 0xFE, 0x29, 0x89, 0x99, 0xBC, 0x29, 0x15, 0xA2, 0x88, 
+0x3C, 0xFE, 0x9C, 0xF5, 0x31, 0x2C, 0x31, 0xC0, 0x2C, 0x31, 0xFE, 0x9C, 0xF4, 0x2D, 0x24, 0x66, 
+0x24, 0x29, 0x0E, 0xFE, 0xBE, 0x19, 0x2A, 0x31, 0xCC, 0x25, 0x31, 0x48, 0x92, 0xDB, 0x11, 0x14, 
+0x27, 0xC0, 0x1B, 0x19, 0x1B, 0xC1, 0x22, 0x7A, 0x6E, 0xC1, 0x23, 0x9D, 0x9A, 0xA4, 0x67, 0x27, 
+0x0C, 0x16, 0xA0, 0xAB, 0xA8, 0x45, 0xAB, 0x68, 0x7B, 0xC1, 0x2C, 0x31, 0xC0, 0xFE, 0x5A, 0xEE, 
+0xFE, 0x00, 0x05, 0x10, 0x66, 0x6B, 0x17, 0x35, 0xFE, 0xCE, 0x5A, 0x31, 0x2C, 0x31, 0xCF, 0xFE, 
+0x84, 0x12, 0xFE, 0x00, 0x04, 0x10, 0x04, 0x10, 0xC0, 0x9C, 0xA8, 0x37, 0x31, 0xC8, 0x2C, 0x31, 
+0x69, 0x31, 0xFE, 0xC6, 0x19, 0xFE, 0x10, 0x85, 0xA2, 0x78, 0x15, 0xC0, 0x6E, 0x7A, 0x35, 0xFE, 
+0x42, 0x4A, 0x2C, 0xC0, 0x31, 0xCB, 0x65, 0x2C, 0x31, 0x9B, 0xBD, 0xFE, 0x73, 0xB1, 0x1D, 0x2D, 
+0x10, 0x29, 0x66, 0x6F, 0x24, 0x29, 0x24, 0x56, 0xA3, 0x77, 0x2B, 0x24, 0x35, 0x3D, 0xFE, 0x63, 
+0x4F, 0xFE, 0xEF, 0x5E, 0xA3, 0x66, 0xFE, 0x21, 0x27, 0x04, 0x15, 0x10, 0x66, 0x9D, 0x99, 0xFE, 
+0x94, 0x93, 0x31, 0x2C, 0x31, 0xC0, 0x69, 0x31, 0x2F, 0xFE, 0x00, 0x46, 0x1F, 0x0B, 0xC0, 0x15, 
+0x9C, 0xA9, 0xFE, 0xBD, 0xF9, 0x31, 0xCE, 0x2C, 0xC0, 0x2A, 0x98, 0xA9, 0x95, 0xB9, 0x9F, 0x67, 
+0x20, 0x19, 0x6F, 0x76, 0x6E, 0xC0, 0x20, 0xC1, 0x23, 0x16, 0x1B, 0x20, 0xC0, 0x1B, 0x77, 0xA2, 
+0x9A, 0xAA, 0x57, 0x31, 0xC0, 0x2C, 0x31, 0xC1, 0x2C, 0x31, 0xFE, 0x7B, 0xF1, 0xFE, 0x29, 0x68, 
+0xA3, 0x65, 0x7B, 0x53, 0x6D, 0xA2, 0x76, 0xFE, 0xCE, 0x7A, 0x31, 0xCF, 0x2C, 0x31, 0xFE, 0x94, 
+0x92, 0xFE, 0x21, 0x26, 0x12, 0x69, 0x12, 0x55, 0xC0, 0xFE, 0xBD, 0xF8, 0x31, 0xC5, 0x2C, 0x31, 
+0xC4, 0x56, 0xFE, 0x31, 0xC9, 0x01, 0x21, 0x65, 0x6E, 0x30, 0x9A, 0xCA, 0xFE, 0x8C, 0x72, 0x31, 
+0xC1, 0x65, 0x31, 0xC8, 0x2C, 0x31, 0xC3, 0xFE, 0xCE, 0x3A, 0xFE, 0x73, 0x70, 0x91, 0xFF, 0x3D, 
+0x35, 0x09, 0x01, 0x09, 0x7E, 0x04, 0x35, 0x04, 0x1D, 0xFE, 0x5A, 0xCD, 0x27, 0x31, 0xC0, 0x9B, 
+0xBC, 0xFE, 0x52, 0xAC, 0x97, 0xDE, 0x12, 0xA2, 0x78, 0xA2, 0x76, 0x9A, 0xCB, 0xFE, 0xAD, 0x56, 
+0x31, 0xC3, 0x25, 0xFE, 0xA5, 0x35, 0xFE, 0x21, 0x27, 0x12, 0x7F, 0x12, 0xC0, 0x69, 0x27, 0x31, 
+0xCE, 0x2C, 0xC1, 0x31, 0xA0, 0x65, 0x97, 0xBA, 0x98, 0xBA, 0x40, 0x55, 0x6D, 0x6E, 0xC1, 0x6E, 
+0xC1, 0x1B, 0x73, 0x56, 0xA3, 0x76, 0xA3, 0x78, 0xA8, 0x66, 0xA7, 0x79, 0x31, 0x2C, 0xC0, 0x31, 
+0x2A, 0x31, 0xC2, 0x51, 0x24, 0x58, 0xC0, 0x29, 0x61, 0x6B, 0x31, 0x25, 0x31, 0x2C, 0x31, 0xCC, 
+0x2C, 0x31, 0xC0, 0x9C, 0xAA, 0x6F, 0x18, 0x56, 0x24, 0x1F, 0x1D, 0x31, 0xCA, 0x2C, 0x31, 0xC0, 
+0xFE, 0x8C, 0x54, 0x30, 0xA4, 0x67, 0x59, 0x6F, 0x62, 0xA2, 0x75, 0xFE, 0xDE, 0xDC, 0x2A, 0x2C, 
+0x31, 0xCA, 0x2C, 0x31, 0xC2, 0x2A, 0x31, 0xC0, 0x9A, 0xBC, 0x93, 0xFF, 0x95, 0xDE, 0x97, 0xCD, 
+0x9B, 0xBB, 0x5A, 0x76, 0xA4, 0x55, 0xA6, 0x65, 0xAB, 0x22, 0xFE, 0xD6, 0xDB, 0x31, 0xC0, 0x2C, 
+0x2A, 0x31, 0x56, 0x51, 0x29, 0x15, 0xA2, 0x76, 0x61, 0x2C, 0x31, 0xC4, 0x24, 0x59, 0x65, 0x18, 
+0x6E, 0xC0, 0x15, 0x31, 0x25, 0x31, 0xD0, 0x2C, 0x31, 0xC0, 0x59, 0x9C, 0x98, 0x9A, 0xA8, 0x9E, 
+0x77, 0x9D, 0xAA, 0x40, 0x69, 0xC0, 0x2F, 0x7F, 0xA3, 0x67, 0xA2, 0x88, 0xA4, 0x78, 0xA5, 0x78, 
+0x31, 0xF8, 0x2C, 0x31, 0x2A, 0x31, 0xFE, 0x7B, 0xF2, 0x30, 0xA4, 0x56, 0x7E, 0x6F, 0x9C, 0xA9, 
+0xFE, 0x52, 0xAC, 0x31, 0xFD, 0xD6, 0x27, 0x65, 0x56, 0xC0, 0x7A, 0x22, 0x27, 0x31, 0xF3, 0x2C, 
+0x31, 0xC0, 0x25, 0x31, 0xC0, 0x2C, 0x31, 0xC2, 0x9D, 0x9A, 0x0D, 0x99, 0xBC, 0x1D, 0x56, 0xC0, 
+0x9C, 0xA9, 0xFE, 0xA5, 0x36, 0x31, 0xFD, 0xFD, 0xD5, 0x2C, 0x31, 0x2C, 0x31, 0xC0, 0x25, 0x31, 
+0xC0, 0x22, 0x31, 0xFE, 0xA5, 0x56, 0xFE, 0x00, 0x24, 0x15, 0x7F, 0x51, 0x15, 0xA3, 0x75, 0xFE, 
+0xE7, 0x5D, 0x31, 0xFD, 0xFD, 0xD7, 0x2C, 0x31, 0x2C, 0x31, 0x25, 0x31, 0xC0, 0x52, 0xFE, 0x39, 
+0xCA, 0x10, 0x6F, 0x10, 0xA4, 0x66, 0x99, 0xBB, 0xFE, 0x73, 0xB1, 0x31, 0xC1, 0x2C, 0x31, 0xFD, 
+0xFD, 0xDA, 0x56, 0xFE, 0x6B, 0x6F, 0xFE, 0x08, 0x65, 0x15, 0x1F, 0x10, 0x15, 0x60, 0xFE, 0xCE, 
+0x5B, 0x31, 0x69, 0x31, 0xFD, 0xFD, 0xD3, 0x2A, 0x2C, 0x31, 0xFE, 0xAD, 0x76, 0x93, 0xEF, 0xB1, 
+0x00, 0xA5, 0x55, 0x51, 0x96, 0xDD, 0xFE, 0x3A, 0x0A, 0x26, 0x15, 0x6F, 0x10, 0xA3, 0x66, 0x9A, 
+0xCB, 0xFE, 0x63, 0x2E, 0x2C, 0x31, 0xFD, 0xFD, 0xD8, 0xFE, 0x52, 0xAC, 0xFE, 0x00, 0x02, 0x09, 
+0x1D, 0x09, 0x35, 0x09, 0xA2, 0x78, 0x15, 0x55, 0x29, 0x9C, 0xAA, 0x1D, 0xFE, 0xCE, 0x9A, 0x31, 
+0xFD, 0xFD, 0xD6, 0x2C, 0x31, 0x97, 0xDF, 0xFE, 0x19, 0x07, 0x29, 0x24, 0x1C, 0xC0, 0x24, 0x1C, 
+0xC0, 0x21, 0x15, 0x1D, 0x35, 0xFE, 0x8C, 0x54, 0x31, 0x2C, 0x31, 0xFD, 0xFD, 0xD7, 0xFE, 0x9D, 
+0x16, 0xFE, 0x00, 0x46, 0xA6, 0x55, 0x21, 0x24, 0x15, 0xC1, 0x21, 0x30, 0x10, 0x9D, 0xA8, 0xFE, 
+0x73, 0x8F, 0x31, 0xFD, 0xFD, 0xD8, 0x55, 0x31, 0xFE, 0x4A, 0x6B, 0xFE, 0x08, 0x45, 0x24, 0xC0, 
+0x15, 0x1D, 0x6F, 0x15, 0x6E, 0x26, 0xA4, 0x76, 0xFE, 0x8C, 0x53, 0x2C, 0x31, 0xFD, 0xFD, 0xD9, 
+0x9C, 0xBB, 0xFE, 0x52, 0x8B, 0x95, 0xDF, 0x09, 0x3A, 0xC0, 0x09, 0x3D, 0x6D, 0xA4, 0x66, 0xFE, 
+0x63, 0x4E, 0xFE, 0xCE, 0x5A, 0x2C, 0x31, 0xFD, 0xFD, 0xDC, 0x0C, 0x14, 0x97, 0xDD, 0x9C, 0xAB, 
+0x51, 0x3F, 0xAB, 0x32, 0xAE, 0x00, 0x31, 0xC0, 0x52, 0x2C, 0x31, 0xFD, 0xEE, 
 };
 
 #endif // LOGO_H
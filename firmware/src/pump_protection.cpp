@@ -0,0 +1,133 @@
+#include "pump_protection.h"
+#include "adc_sampler.h"
+#include "current_sensor.h"
+
+static int protected_pin = -1;
+
+// Mean-square limits in squared sampler units, so frames are checked
+// without a square root
+static uint64_t overcurrent_sq = 0;
+static uint64_t dry_sq = 0;
+
+// Written by the loop, read by the sampler task. setPumpState() runs only
+// on the loop (web requests are queued for it, see web_server_handle()),
+// so the relay, pump_on and the start time change together. The start
+// time is stored before pump_on is released, and read after pump_on is
+// acquired, so the sampler never pairs a new start with the previous
+// run's time.
+static volatile bool pump_on = false;
+static volatile uint32_t pump_on_since_ms = 0;
+
+// Sampler task state
+static uint64_t prev_sum_sq = 0;
+static uint32_t prev_count = 0;
+static uint32_t low_since_ms = 0;
+static bool low_running = false;
+
+// Latch. The trip info is written before trip_count is bumped, and read
+// after it, so readers never see a half written trip.
+static volatile bool tripped = false;
+static volatile uint32_t trip_count = 0;
+static PumpTripInfo last_trip = {PUMP_TRIP_NONE, 0.0f, 0};
+
+static void pump_protection_hook(const AdcFrame& frame) {
+    pump_protection_frame(frame.stats, frame.timestamp);
+}
+
+void pump_protection_init(int pump_pin) {
+    protected_pin = pump_pin;
+
+    uint64_t overcurrent = (uint64_t)current_sensor_stats_units(PUMP_PROTECTION_OVERCURRENT_A);
+    uint64_t dry = (uint64_t)current_sensor_stats_units(PUMP_PROTECTION_DRY_A);
+    overcurrent_sq = overcurrent * overcurrent;
+    dry_sq = dry * dry;
+
+    adc_sampler_add_frame_hook(pump_protection_hook);
+}
+
+void pump_protection_set_pump_on(bool on) {
+    if (on && !__atomic_load_n(&pump_on, __ATOMIC_RELAXED)) {
+        __atomic_store_n(&pump_on_since_ms, millis(), __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&pump_on, on, __ATOMIC_RELEASE);
+}
+
+static PumpTripReason trip(PumpTripReason reason, uint64_t sum_sq, uint32_t count, uint32_t now_ms) {
+    if (protected_pin >= 0) {
+        digitalWrite(protected_pin, LOW);
+    }
+    __atomic_store_n(&pump_on, false, __ATOMIC_RELAXED);
+
+    last_trip.reason = reason;
+    last_trip.current = current_stats_isqrt(sum_sq / count) * current_sensor_amps_per_stats_unit();
+    last_trip.timestamp = now_ms;
+    __atomic_store_n(&tripped, true, __ATOMIC_RELEASE);
+    __atomic_store_n(&trip_count, trip_count + 1, __ATOMIC_RELEASE);
+    return reason;
+}
+
+PumpTripReason pump_protection_frame(const CurrentStatsAccumulator& frame, uint32_t now_ms) {
+    uint64_t sum_sq = prev_sum_sq + frame.sum_sq;
+    uint32_t count = prev_count + frame.count;
+    prev_sum_sq = frame.sum_sq;
+    prev_count = frame.count;
+
+    if (!__atomic_load_n(&pump_on, __ATOMIC_ACQUIRE) || tripped || count == 0) {
+        low_running = false;
+        return PUMP_TRIP_NONE;
+    }
+
+    uint32_t running_ms = now_ms - __atomic_load_n(&pump_on_since_ms, __ATOMIC_RELAXED);
+    if (running_ms < PUMP_PROTECTION_INRUSH_MS) {
+        low_running = false;
+        return PUMP_TRIP_NONE;
+    }
+
+    // A locked rotor never leaves its start current, so it trips here
+    // as soon as the inrush allowance is over
+    if (sum_sq > overcurrent_sq * count) {
+        return trip(PUMP_TRIP_OVERCURRENT, sum_sq, count, now_ms);
+    }
+
+    if (running_ms < PUMP_PROTECTION_START_GRACE_MS) {
+        low_running = false;
+        return PUMP_TRIP_NONE;
+    }
+
+    if (frame.count > 0 && frame.sum_sq < dry_sq * frame.count) {
+        if (!low_running) {
+            low_running = true;
+            low_since_ms = now_ms;
+        } else if (now_ms - low_since_ms >= PUMP_PROTECTION_DRY_MS) {
+            return trip(PUMP_TRIP_DRY_RUN, frame.sum_sq, frame.count, now_ms);
+        }
+    } else {
+        low_running = false;
+    }
+    return PUMP_TRIP_NONE;
+}
+
+bool pump_protection_tripped() {
+    return __atomic_load_n(&tripped, __ATOMIC_ACQUIRE);
+}
+
+uint32_t pump_protection_trip_count() {
+    return __atomic_load_n(&trip_count, __ATOMIC_ACQUIRE);
+}
+
+PumpTripInfo pump_protection_last_trip() {
+    pump_protection_trip_count(); // Orders the read below after the latch
+    return last_trip;
+}
+
+void pump_protection_reset() {
+    __atomic_store_n(&tripped, false, __ATOMIC_RELEASE);
+}
+
+const char* pump_trip_reason_name(uint8_t reason) {
+    switch (reason) {
+        case PUMP_TRIP_OVERCURRENT: return "overcurrent";
+        case PUMP_TRIP_DRY_RUN:     return "dry_run";
+        default:                    return "none";
+    }
+}
@@ -0,0 +1,53 @@
+#ifndef PUMP_PROTECTION_H
+#define PUMP_PROTECTION_H
+
+#include <Arduino.h>
+#include "current_stats.h"
+
+// Trips the pump relay straight from the ADC sampler task, so overcurrent
+// and dry running are caught within a few frames however busy loop() is.
+// Every 10 ms frame of current samples is checked against the limits; a
+// trip drives the pump pin low at once and latches until reset, and
+// setPumpState() refuses to restart the pump while latched.
+#define PUMP_PROTECTION_OVERCURRENT_A  12.0f // RMS over the last two frames (one 50 Hz cycle)
+#define PUMP_PROTECTION_DRY_A          0.5f  // RMS below this with the pump on: not pumping
+#define PUMP_PROTECTION_INRUSH_MS      500   // Start current is not overcurrent this long
+#define PUMP_PROTECTION_START_GRACE_MS 2000  // Priming: no dry run check this long
+#define PUMP_PROTECTION_DRY_MS         200   // How long the current must stay low to trip
+
+enum PumpTripReason {
+  PUMP_TRIP_NONE,
+  PUMP_TRIP_OVERCURRENT,
+  PUMP_TRIP_DRY_RUN
+};
+
+struct PumpTripInfo {
+  uint8_t reason;     // PumpTripReason
+  float current;      // RMS that tripped, A
+  uint32_t timestamp; // millis() of the trip
+};
+
+// `pump_pin` is driven low on a trip. Thresholds are converted to the
+// sampler's fixed-point units once here.
+void pump_protection_init(int pump_pin);
+
+// Tells the monitor whether the pump relay is on. Called on every change,
+// from the loop only.
+void pump_protection_set_pump_on(bool on);
+
+// Checks one frame of current samples and returns the trip it caused, if
+// any. Runs in the sampler task; exposed for simulation with injected
+// traces.
+PumpTripReason pump_protection_frame(const CurrentStatsAccumulator& frame, uint32_t now_ms);
+
+bool pump_protection_tripped();
+// Trips since boot; lets the loop notice a new one
+uint32_t pump_protection_trip_count();
+// The latched trip, or the last one after a reset
+PumpTripInfo pump_protection_last_trip();
+// Clears the latch. The pump stays off until something starts it again.
+void pump_protection_reset();
+
+const char* pump_trip_reason_name(uint8_t reason);
+
+#endif // PUMP_PROTECTION_H
@@ -0,0 +1,82 @@
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Fixed-capacity circular buffer with static storage. Once full, each push
+// overwrites the oldest item. Items are indexed from the oldest (0) to the
+// newest (size() - 1). The capacity must be a power of two so wrapping is a
+// mask and the write counter can overflow freely.
+template <typename T, size_t N>
+class RingBuffer {
+    static_assert(N > 0 && (N & (N - 1)) == 0, "RingBuffer capacity must be a power of two");
+
+public:
+    class ConstIterator {
+    public:
+        ConstIterator(const RingBuffer* buffer, size_t index) : _buffer(buffer), _index(index) {}
+        const T& operator*() const { return (*_buffer)[_index]; }
+        const T* operator->() const { return &(*_buffer)[_index]; }
+        ConstIterator& operator++() { _index++; return *this; }
+        bool operator!=(const ConstIterator& other) const { return _index != other._index; }
+
+    private:
+        const RingBuffer* _buffer;
+        size_t _index;
+    };
+
+    void push(const T& item) {
+        _items[_written & (N - 1)] = item;
+        _written++;
+        if (_size < N) _size++;
+    }
+
+    // Inserts an item before the oldest one. Unlike push() this never
+    // overwrites: returns false if the buffer is full.
+    bool pushFront(const T& item) {
+        if (_size == N) return false;
+        _size++;
+        _items[(_written - _size) & (N - 1)] = item;
+        return true;
+    }
+
+    void clear() { _size = 0; }
+
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+    bool full() const { return _size == N; }
+    static constexpr size_t capacity() { return N; }
+
+    const T& operator[](size_t i) const { return _items[(_written - _size + i) & (N - 1)]; }
+    const T& oldest() const { return (*this)[0]; }
+    const T& newest() const { return (*this)[_size - 1]; }
+
+    ConstIterator begin() const { return ConstIterator(this, 0); }
+    ConstIterator end() const { return ConstIterator(this, _size); }
+
+    // Binary search over items ordered so that `pred` holds for a leading
+    // run of them (e.g. "timestamp <= t" on time-ordered items). Returns the
+    // index of the first item for which it fails, or size() if none do.
+    template <typename Pred>
+    size_t partitionPoint(Pred pred) const {
+        size_t lo = 0;
+        size_t hi = _size;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (pred((*this)[mid])) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return lo;
+    }
+
+private:
+    T _items[N];
+    uint32_t _written = 0; // Total pushes; the next slot is _written & (N - 1)
+    size_t _size = 0;
+};
+
+#endif // RING_BUFFER_H
@@ -0,0 +1,228 @@
+#include "series_codec.h"
+
+#define SERIES_BLOCK_BITS (sizeof(((SeriesBlock*)0)->bits) * 8)
+// Every point after the first takes at least its two one-bit prefixes
+#define SERIES_BLOCK_MAX_POINTS (1 + SERIES_BLOCK_BITS / 2)
+
+// MSB-first bit packing, a byte at a time
+static void put_bits(uint8_t* buf, uint16_t& pos, uint32_t value, uint8_t n) {
+    while (n > 0) {
+        uint8_t room = 8 - (pos & 7);
+        uint8_t take = n < room ? n : room;
+        uint8_t chunk = (value >> (n - take)) & ((1u << take) - 1);
+        buf[pos >> 3] |= chunk << (room - take);
+        pos += take;
+        n -= take;
+    }
+}
+
+// Fails, leaving `pos` alone, if the bits would run past the block
+static bool get_bits(const uint8_t* buf, uint16_t& pos, uint8_t n, uint32_t& value) {
+    if ((size_t)pos + n > SERIES_BLOCK_BITS) return false;
+    value = 0;
+    while (n > 0) {
+        uint8_t room = 8 - (pos & 7);
+        uint8_t take = n < room ? n : room;
+        uint8_t chunk = (buf[pos >> 3] >> (room - take)) & ((1u << take) - 1);
+        value = (value << take) | chunk;
+        pos += take;
+        n -= take;
+    }
+    return true;
+}
+
+static bool fits(int64_t v, uint8_t bits) {
+    int64_t limit = (int64_t)1 << (bits - 1);
+    return v >= -limit && v < limit;
+}
+
+static int32_t sign_extend(uint32_t v, uint8_t bits) {
+    return (int32_t)(v << (32 - bits)) >> (32 - bits);
+}
+
+static int16_t quantise(float value) {
+    float scaled = value * SERIES_VALUE_SCALE;
+    if (scaled > INT16_MAX) return INT16_MAX;
+    if (scaled < INT16_MIN) return INT16_MIN;
+    return (int16_t)lroundf(scaled);
+}
+
+void series_encoder_begin(SeriesEncoder& enc, SeriesBlock* block) {
+    memset(block, 0, sizeof(SeriesBlock));
+    block->header.magic = SERIES_BLOCK_MAGIC;
+    enc.block = block;
+    enc.bit_pos = 0;
+    enc.prev_ts = 0;
+    enc.prev_delta = 0;
+    enc.prev_value = 0;
+}
+
+bool series_encoder_add(SeriesEncoder& enc, int64_t ts, float value) {
+    SeriesBlockHeader& header = enc.block->header;
+    int16_t q = quantise(value);
+
+    if (header.count == 0) {
+        header.first_ts = ts;
+        header.last_ts = ts;
+        header.first_value = q;
+        header.count = 1;
+        enc.prev_ts = ts;
+        enc.prev_delta = 0;
+        enc.prev_value = q;
+        return true;
+    }
+    if (header.count == UINT16_MAX) return false;
+
+    int64_t delta = ts - enc.prev_ts;
+    int64_t dod = delta - enc.prev_delta;
+    uint32_t ts_prefix;
+    uint8_t ts_prefix_len, ts_bits;
+    if (dod == 0) {
+        ts_prefix = 0x0; ts_prefix_len = 1; ts_bits = 0;
+    } else if (fits(dod, 7)) {
+        ts_prefix = 0x2; ts_prefix_len = 2; ts_bits = 7;
+    } else if (fits(dod, 9)) {
+        ts_prefix = 0x6; ts_prefix_len = 3; ts_bits = 9;
+    } else if (fits(dod, 12)) {
+        ts_prefix = 0xE; ts_prefix_len = 4; ts_bits = 12;
+    } else if (fits(dod, 32)) {
+        ts_prefix = 0xF; ts_prefix_len = 4; ts_bits = 32;
+    } else {
+        return false; // Gap too long for one block
+    }
+
+    int32_t dv = (int32_t)q - enc.prev_value;
+    uint32_t v_prefix;
+    uint8_t v_prefix_len, v_bits;
+    if (dv == 0) {
+        v_prefix = 0x0; v_prefix_len = 1; v_bits = 0;
+    } else if (fits(dv, 7)) {
+        v_prefix = 0x2; v_prefix_len = 2; v_bits = 7;
+    } else if (fits(dv, 10)) {
+        v_prefix = 0x6; v_prefix_len = 3; v_bits = 10;
+    } else {
+        v_prefix = 0x7; v_prefix_len = 3; v_bits = 17;
+    }
+
+    if ((size_t)enc.bit_pos + ts_prefix_len + ts_bits + v_prefix_len + v_bits > SERIES_BLOCK_BITS) {
+        return false;
+    }
+
+    uint8_t* bits = enc.block->bits;
+    put_bits(bits, enc.bit_pos, ts_prefix, ts_prefix_len);
+    if (ts_bits) put_bits(bits, enc.bit_pos, (uint32_t)dod, ts_bits);
+    put_bits(bits, enc.bit_pos, v_prefix, v_prefix_len);
+    if (v_bits) put_bits(bits, enc.bit_pos, (uint32_t)dv, v_bits);
+
+    header.count++;
+    header.last_ts = ts;
+    enc.prev_ts = ts;
+    enc.prev_delta = delta;
+    enc.prev_value = q;
+    return true;
+}
+
+void series_decoder_begin(SeriesDecoder& dec, const SeriesBlock* block) {
+    dec.block = block;
+    dec.bit_pos = 0;
+    dec.index = 0;
+    dec.ts = block->header.first_ts;
+    dec.delta = 0;
+    dec.value = block->header.first_value;
+}
+
+// Reads a prefix of up to `max_len` leading ones, then the field it selects
+static bool get_field(const uint8_t* bits, uint16_t& pos, uint8_t max_len, const uint8_t* field_bits, int32_t& out) {
+    uint8_t ones = 0;
+    uint32_t bit = 1;
+    while (ones < max_len) {
+        if (!get_bits(bits, pos, 1, bit)) return false;
+        if (!bit) break;
+        ones++;
+    }
+    out = 0;
+    if (ones > 0) {
+        uint32_t raw;
+        if (!get_bits(bits, pos, field_bits[ones], raw)) return false;
+        out = sign_extend(raw, field_bits[ones]);
+    }
+    return true;
+}
+
+bool series_decoder_next(SeriesDecoder& dec, int64_t& ts, float& value) {
+    if (dec.index >= dec.block->header.count) return false;
+
+    if (dec.index > 0) {
+        static const uint8_t ts_bits[] = {0, 7, 9, 12, 32};
+        static const uint8_t v_bits[] = {0, 7, 10, 17};
+        int32_t dod, dv;
+        if (!get_field(dec.block->bits, dec.bit_pos, 4, ts_bits, dod) ||
+            !get_field(dec.block->bits, dec.bit_pos, 3, v_bits, dv)) {
+            // The count promises more points than the bits hold
+            dec.index = dec.block->header.count;
+            return false;
+        }
+        dec.delta += dod;
+        dec.ts += dec.delta;
+        dec.value += dv;
+    }
+
+    dec.index++;
+    ts = dec.ts;
+    value = (float)dec.value / SERIES_VALUE_SCALE;
+    return true;
+}
+
+bool series_block_valid(const SeriesBlock& block) {
+    const SeriesBlockHeader& header = block.header;
+    return header.magic == SERIES_BLOCK_MAGIC &&
+           header.count > 0 && header.count <= SERIES_BLOCK_MAX_POINTS &&
+           header.first_ts <= header.last_ts;
+}
+
+void series_block_shift(SeriesBlock& block, int64_t offset_ms) {
+    block.header.first_ts += offset_ms;
+    block.header.last_ts += offset_ms;
+}
+
+uint32_t series_codec_benchmark(uint32_t points, uint32_t& encode_us, uint32_t& decode_us) {
+    static SeriesBlock blocks[8]; // Reused round robin; only the timing matters
+    SeriesEncoder enc;
+    uint32_t used = 0;
+    int block = 0;
+
+    // Points every ~500 ms with jitter and a slowly wandering current
+    uint32_t start = micros();
+    series_encoder_begin(enc, &blocks[block]);
+    int64_t ts = 0;
+    for (uint32_t i = 0; i < points; i++) {
+        ts += 500 + (int64_t)((i * 37) % 23) - 11;
+        float value = 4.0f + 0.01f * (float)((int32_t)((i * 7919) % 41) - 20);
+        if (!series_encoder_add(enc, ts, value)) {
+            used += SERIES_BLOCK_BYTES;
+            block = (block + 1) & 7;
+            series_encoder_begin(enc, &blocks[block]);
+            series_encoder_add(enc, ts, value);
+        }
+    }
+    used += SERIES_BLOCK_BYTES;
+    encode_us = micros() - start;
+
+    volatile float sink = 0; // Keeps the decoded values live
+    start = micros();
+    for (uint32_t decoded = 0; decoded < points; ) {
+        for (int b = 0; b < 8 && decoded < points; b++) {
+            SeriesDecoder dec;
+            series_decoder_begin(dec, &blocks[b]);
+            int64_t t;
+            float v;
+            while (decoded < points && series_decoder_next(dec, t, v)) {
+                sink = sink + v;
+                decoded++;
+            }
+        }
+    }
+    decode_us = micros() - start;
+    (void)sink;
+    return used;
+}
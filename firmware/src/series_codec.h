@@ -0,0 +1,190 @@
+#ifndef SERIES_CODEC_H
+#define SERIES_CODEC_H
+
+#include <Arduino.h>
+#include "ring_buffer.h"
+
+// Gorilla-style compression for (timestamp, current) series. Points are
+// packed into fixed-size blocks that decode on their own, so the same block
+// bytes serve as the RAM history, the flash log and an API response.
+//
+// The first point of a block sits in the header; each later one is a
+// timestamp delta-of-delta followed by a value delta, both in a few
+// prefix-coded size classes (MSB first):
+//
+//   timestamp dod  0 | 10 +7 bits | 110 +9 | 1110 +12 | 1111 +32
+//   value delta    0 | 10 +7 bits | 110 +10 | 111 +17
+//
+// Values are quantised to SERIES_VALUE_SCALE steps per unit (centiamps)
+// and the payloads are two's complement. A steady change-of-value stream
+// costs about two bytes per point instead of sixteen.
+#define SERIES_BLOCK_BYTES  256
+#define SERIES_BLOCK_MAGIC  0x5342 // "BS"
+#define SERIES_VALUE_SCALE  100
+
+struct SeriesBlockHeader {
+    uint16_t magic;
+    uint16_t count;       // Points in the block
+    int16_t first_value;  // Quantised
+    uint16_t reserved;
+    int64_t first_ts;     // Milliseconds, time base up to the owner
+    int64_t last_ts;
+};
+
+struct SeriesBlock {
+    SeriesBlockHeader header;
+    uint8_t bits[SERIES_BLOCK_BYTES - sizeof(SeriesBlockHeader)];
+};
+
+static_assert(sizeof(SeriesBlock) == SERIES_BLOCK_BYTES, "SeriesBlock must be exactly one block");
+
+struct SeriesEncoder {
+    SeriesBlock* block;
+    uint16_t bit_pos;
+    int64_t prev_ts;
+    int64_t prev_delta;
+    int16_t prev_value;
+};
+
+struct SeriesDecoder {
+    const SeriesBlock* block;
+    uint16_t bit_pos;
+    uint16_t index;
+    int64_t ts;
+    int64_t delta;
+    int16_t value;
+};
+
+// Clears `block` and starts writing to it
+void series_encoder_begin(SeriesEncoder& enc, SeriesBlock* block);
+
+// Appends a point. Returns false, leaving the block as it was, if the point
+// does not fit; the caller then starts a new block.
+bool series_encoder_add(SeriesEncoder& enc, int64_t ts, float value);
+
+void series_decoder_begin(SeriesDecoder& dec, const SeriesBlock* block);
+
+// Reads the next point; false once the block is exhausted, or if its
+// count runs past the end of the bits
+bool series_decoder_next(SeriesDecoder& dec, int64_t& ts, float& value);
+
+// Whether `block` could have been written by this codec: the magic, a
+// count the block has room for and timestamps in order. Blocks read back
+// from flash or the network should pass this before they are decoded.
+bool series_block_valid(const SeriesBlock& block);
+
+// Moves a block to another time base. Only the header holds absolute time.
+void series_block_shift(SeriesBlock& block, int64_t offset_ms);
+
+// Encodes and decodes `points` synthetic change-of-value points. Reports the
+// time spent on each in microseconds and returns the bytes used.
+uint32_t series_codec_benchmark(uint32_t points, uint32_t& encode_us, uint32_t& decode_us);
+
+// A fixed number of compressed blocks plus the one being filled. Once the
+// ring is full, sealing a block drops the oldest one.
+template <size_t N>
+class SeriesStore {
+public:
+    SeriesStore() { series_encoder_begin(_encoder, &_open); }
+    SeriesStore(const SeriesStore&) = delete;
+    SeriesStore& operator=(const SeriesStore&) = delete;
+
+    void push(int64_t ts, float value) {
+        if (!series_encoder_add(_encoder, ts, value)) {
+            seal();
+            series_encoder_add(_encoder, ts, value);
+        }
+        _size++;
+    }
+
+    // Inserts a sealed block before the oldest one, e.g. from the flash
+    // log. Never drops data: returns false if the ring is full.
+    bool pushFront(const SeriesBlock& block) {
+        if (_blocks.full()) return false;
+        _blocks.pushFront(block);
+        _size += block.header.count;
+        return true;
+    }
+
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+    // No room left in front for pushFront()
+    bool full() const { return _blocks.full(); }
+    int64_t oldestTimestamp() const {
+        return _blocks.empty() ? _open.header.first_ts : _blocks.oldest().header.first_ts;
+    }
+    int64_t newestTimestamp() const {
+        return _open.header.count > 0 || _blocks.empty() ? _open.header.last_ts : _blocks.newest().header.last_ts;
+    }
+
+    // Visits every non-empty block, oldest first, the open one last
+    template <typename Fn>
+    void forEachBlock(Fn fn) const {
+        for (const SeriesBlock& block : _blocks) fn(block);
+        if (_open.header.count > 0) fn(_open);
+    }
+
+    // Visits the points newer than `since`, oldest first. Blocks that end
+    // at or before it are skipped without decoding.
+    template <typename Fn>
+    void forEachSince(int64_t since, Fn fn) const {
+        forEachBlock([since, &fn](const SeriesBlock& block) {
+            if (block.header.last_ts <= since) return;
+            SeriesDecoder dec;
+            series_decoder_begin(dec, &block);
+            int64_t ts;
+            float value;
+            while (series_decoder_next(dec, ts, value)) {
+                if (ts > since) fn(ts, value);
+            }
+        });
+    }
+
+    // Like forEachSince, but stops as soon as `fn` returns false, so a
+    // caller can resume later from the last timestamp it took. Returns
+    // false if it was stopped.
+    template <typename Fn>
+    bool forEachSinceWhile(int64_t since, Fn fn) const {
+        for (const SeriesBlock& block : _blocks) {
+            if (!visitBlockSince(block, since, fn)) return false;
+        }
+        return _open.header.count == 0 || visitBlockSince(_open, since, fn);
+    }
+
+    // Visits the blocks that reach past `since`, oldest first, until `fn`
+    // returns false. Returns false if it was stopped.
+    template <typename Fn>
+    bool forEachBlockSinceWhile(int64_t since, Fn fn) const {
+        for (const SeriesBlock& block : _blocks) {
+            if (block.header.last_ts > since && !fn(block)) return false;
+        }
+        return _open.header.count == 0 || _open.header.last_ts <= since || fn(_open);
+    }
+
+private:
+    template <typename Fn>
+    static bool visitBlockSince(const SeriesBlock& block, int64_t since, Fn& fn) {
+        if (block.header.last_ts <= since) return true;
+        SeriesDecoder dec;
+        series_decoder_begin(dec, &block);
+        int64_t ts;
+        float value;
+        while (series_decoder_next(dec, ts, value)) {
+            if (ts > since && !fn(ts, value)) return false;
+        }
+        return true;
+    }
+
+    void seal() {
+        if (_blocks.full()) _size -= _blocks.oldest().header.count;
+        _blocks.push(_open);
+        series_encoder_begin(_encoder, &_open);
+    }
+
+    RingBuffer<SeriesBlock, N> _blocks;
+    SeriesBlock _open;
+    SeriesEncoder _encoder;
+    size_t _size = 0;
+};
+
+#endif // SERIES_CODEC_H
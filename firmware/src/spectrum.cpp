@@ -0,0 +1,408 @@
+#include "spectrum.h"
+#include "current_sensor.h"
+#include "current_stats.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#define SPECTRUM_TASK_PRIO 1 // With loop(); everything time critical is above
+#define SPECTRUM_BINS      (SPECTRUM_SIZE / 2)
+#define SPECTRUM_BAND_HALF 2 // Bins either side of a peak: the Hann main lobe
+
+static_assert((SPECTRUM_SIZE & (SPECTRUM_SIZE - 1)) == 0, "SPECTRUM_SIZE must be a power of two");
+
+// Band edges in 0.1 Hz
+#define SPECTRUM_F0_MIN_DHZ       400
+#define SPECTRUM_F0_MAX_DHZ       700
+#define SPECTRUM_SIDEBAND_MIN_DHZ 200
+#define SPECTRUM_NOISE_MIN_DHZ    10000
+
+enum SpectrumInputState {
+    SPECTRUM_INPUT_IDLE,
+    SPECTRUM_INPUT_FILLING, // The sampler hook appends to input[]
+    SPECTRUM_INPUT_READY    // Full; the task owns input[]
+};
+
+// Q15 tables: a quarter sine wave for the twiddles and half a Hann window
+static int16_t sine_q15[SPECTRUM_SIZE / 4 + 1];
+static int16_t hann_q15[SPECTRUM_SIZE / 2 + 1];
+static bool tables_ready = false;
+
+static int16_t input[SPECTRUM_SIZE];
+static volatile uint8_t input_state = SPECTRUM_INPUT_IDLE;
+static uint32_t input_fill = 0;
+static uint32_t input_start_ms = 0;
+
+// FFT work buffers. After the transform re[] holds the bin amplitudes.
+static int32_t fft_re[SPECTRUM_SIZE];
+static int32_t fft_im[SPECTRUM_SIZE];
+
+static TaskHandle_t spectrum_task_handle = nullptr;
+static SemaphoreHandle_t result_mutex = nullptr; // Guards latest and trend
+static SpectrumResult latest;
+static SpectrumTrend trend;
+
+// Written by the loop; the start time first, so it is current by the time
+// the task sees a new zone
+static volatile uint8_t requested_zone = 0;
+static volatile uint32_t requested_since_ms = 0;
+
+// The run being averaged. Only used by the task.
+static struct {
+    uint8_t zone;
+    uint32_t start_ms;
+    uint32_t windows;
+    uint32_t f0_dhz, thd, h3, sideband, noise; // Sums over the windows
+} run;
+
+static void init_tables() {
+    if (tables_ready) return;
+    for (int i = 0; i <= SPECTRUM_SIZE / 4; i++) {
+        sine_q15[i] = (int16_t)lroundf(32767.0f * sinf(2.0f * PI * i / SPECTRUM_SIZE));
+    }
+    for (int i = 0; i <= SPECTRUM_SIZE / 2; i++) {
+        hann_q15[i] = (int16_t)lroundf(32767.0f * 0.5f * (1.0f - cosf(2.0f * PI * i / SPECTRUM_SIZE)));
+    }
+    tables_ready = true;
+}
+
+// sin and cos of 2*pi*k/SPECTRUM_SIZE for k < SPECTRUM_SIZE / 2
+static inline int32_t twiddle_sin(uint32_t k) {
+    return k <= SPECTRUM_SIZE / 4 ? sine_q15[k] : sine_q15[SPECTRUM_SIZE / 2 - k];
+}
+
+static inline int32_t twiddle_cos(uint32_t k) {
+    return k <= SPECTRUM_SIZE / 4 ? sine_q15[SPECTRUM_SIZE / 4 - k] : -sine_q15[k - SPECTRUM_SIZE / 4];
+}
+
+static inline int32_t hann(uint32_t n) {
+    return n <= SPECTRUM_SIZE / 2 ? hann_q15[n] : hann_q15[SPECTRUM_SIZE - n];
+}
+
+uint32_t spectrum_bin_dhz(uint32_t bin) {
+    return (uint32_t)((uint64_t)bin * SPECTRUM_RATE_HZ * 10 / SPECTRUM_SIZE);
+}
+
+static uint32_t dhz_to_bin(uint32_t dhz) {
+    return (uint32_t)((uint64_t)dhz * SPECTRUM_SIZE / (SPECTRUM_RATE_HZ * 10));
+}
+
+void spectrum_fft(int32_t* re, int32_t* im) {
+    const uint32_t n = SPECTRUM_SIZE;
+    init_tables();
+
+    for (uint32_t i = 1, j = 0; i < n; i++) {
+        uint32_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) {
+            int32_t t = re[i]; re[i] = re[j]; re[j] = t;
+            t = im[i]; im[i] = im[j]; im[j] = t;
+        }
+    }
+
+    // Decimation in time. The twiddle is fetched once per butterfly column;
+    // the first column's is 1, so it is skipped rather than rounded.
+    for (uint32_t len = 2; len <= n; len <<= 1) {
+        uint32_t half = len >> 1;
+        uint32_t step = n / len;
+        for (uint32_t i = 0; i < n; i += len) {
+            uint32_t j = i + half;
+            int32_t tr = re[j], ti = im[j];
+            re[j] = re[i] - tr; im[j] = im[i] - ti;
+            re[i] += tr; im[i] += ti;
+        }
+        for (uint32_t k = 1; k < half; k++) {
+            int32_t c = twiddle_cos(k * step);
+            int32_t s = twiddle_sin(k * step);
+            for (uint32_t i = k; i < n; i += len) {
+                uint32_t j = i + half;
+                // Widening 32x32 multiplies: mul and mulh on RV32
+                int32_t tr = (int32_t)(((int64_t)c * re[j] + (int64_t)s * im[j]) >> 15);
+                int32_t ti = (int32_t)(((int64_t)c * im[j] - (int64_t)s * re[j]) >> 15);
+                re[j] = re[i] - tr; im[j] = im[i] - ti;
+                re[i] += tr; im[i] += ti;
+            }
+        }
+    }
+}
+
+static uint64_t band_energy(const uint32_t* amplitude, uint32_t size, int32_t center) {
+    uint64_t energy = 0;
+    for (int32_t k = center - SPECTRUM_BAND_HALF; k <= center + SPECTRUM_BAND_HALF; k++) {
+        if (k >= 0 && k < (int32_t)size) energy += (uint64_t)amplitude[k] * amplitude[k];
+    }
+    return energy;
+}
+
+// sqrt(part / whole) in permille
+static uint16_t ratio_permille(uint64_t part, uint64_t whole) {
+    while (part > UINT64_MAX / 1000000) {
+        part >>= 1;
+        whole >>= 1;
+    }
+    if (whole == 0) return part ? UINT16_MAX : 0;
+    uint32_t ratio = current_stats_isqrt(part * 1000000 / whole);
+    return ratio > UINT16_MAX ? UINT16_MAX : (uint16_t)ratio;
+}
+
+void spectrum_metrics(const uint32_t* amplitude, uint32_t size, SpectrumMetrics& out) {
+    const uint32_t first_bin = dhz_to_bin(SPECTRUM_SIDEBAND_MIN_DHZ);
+    const uint32_t noise_bin = dhz_to_bin(SPECTRUM_NOISE_MIN_DHZ);
+
+    // Fundamental: the largest peak in the mains range, refined between
+    // bins by a parabola through its neighbours (1/256 bin)
+    uint32_t peak = 0;
+    for (uint32_t k = dhz_to_bin(SPECTRUM_F0_MIN_DHZ); k <= dhz_to_bin(SPECTRUM_F0_MAX_DHZ) + 1 && k + 1 < size; k++) {
+        if (peak == 0 || amplitude[k] > amplitude[peak]) peak = k;
+    }
+    uint64_t total = 0;
+    for (uint32_t k = first_bin; k < size; k++) {
+        total += (uint64_t)amplitude[k] * amplitude[k];
+    }
+    uint64_t fundamental = peak ? band_energy(amplitude, size, peak) : 0;
+
+    // A DC pump has no fundamental; everything is then relative to the DC
+    // current and there are no harmonics to pick out
+    int32_t f0_q8 = 0;
+    if (fundamental > 0 && fundamental * 4 >= total) {
+        int64_t left = amplitude[peak - 1], mid = amplitude[peak], right = amplitude[peak + 1];
+        int64_t curvature = 2 * mid - left - right;
+        f0_q8 = (int32_t)(peak << 8);
+        if (curvature > 0) f0_q8 += (int32_t)(((right - left) << 7) / curvature);
+    }
+
+    uint64_t harmonics = 0, third = 0, sideband = 0, noise = 0;
+    if (f0_q8 > 0) {
+        for (uint32_t h = 2; h <= SPECTRUM_MAX_HARMONIC; h++) {
+            int32_t center = (int32_t)((h * f0_q8 + 128) >> 8);
+            if (center + SPECTRUM_BAND_HALF >= (int32_t)size) break;
+            uint64_t energy = band_energy(amplitude, size, center);
+            harmonics += energy;
+            if (h == 3) third = energy;
+        }
+    }
+    for (uint32_t k = first_bin; k < size; k++) {
+        if (f0_q8 > 0) {
+            // Skip the main lobe of the nearest harmonic
+            int32_t h = (int32_t)(((k << 8) + f0_q8 / 2) / f0_q8);
+            int32_t center = (h * f0_q8 + 128) >> 8;
+            if (h >= 1 && abs((int32_t)k - center) <= SPECTRUM_BAND_HALF) continue;
+        }
+        uint64_t energy = (uint64_t)amplitude[k] * amplitude[k];
+        if (k < noise_bin) {
+            sideband += energy;
+        } else {
+            noise += energy;
+        }
+    }
+
+    // Through the Hann window a sine leaves 3/16 N^2 times its mean square
+    // in its main lobe and a DC level 5/16 N^2 times in bins 0 and 1
+    uint64_t reference = fundamental;
+    if (f0_q8 == 0) {
+        reference = ((uint64_t)amplitude[0] * amplitude[0] + (uint64_t)amplitude[1] * amplitude[1]) / 5 * 3;
+    }
+    out.f0_dhz = (uint16_t)(((uint64_t)f0_q8 * SPECTRUM_RATE_HZ * 10 / SPECTRUM_SIZE + 128) >> 8);
+    out.thd = ratio_permille(harmonics, reference);
+    out.h3 = ratio_permille(third, reference);
+    out.sideband = ratio_permille(sideband, reference);
+    out.noise = ratio_permille(noise, reference);
+}
+
+// Windows input[] into the work buffers, transforms them and leaves the
+// amplitudes in fft_re
+static uint32_t* transform() {
+    for (uint32_t n = 0; n < SPECTRUM_SIZE; n++) {
+        fft_re[n] = (input[n] * hann(n)) >> 15;
+        fft_im[n] = 0;
+    }
+    spectrum_fft(fft_re, fft_im);
+
+    uint32_t* amplitude = (uint32_t*)fft_re;
+    for (uint32_t k = 0; k < SPECTRUM_BINS; k++) {
+        amplitude[k] = current_stats_isqrt((uint64_t)((int64_t)fft_re[k] * fft_re[k] + (int64_t)fft_im[k] * fft_im[k]));
+    }
+    return amplitude;
+}
+
+// Flags the metrics of a finished run that rose well above the zone's
+// earlier runs
+static uint8_t run_flags(const SpectrumRun& finished) {
+    uint32_t count = 0, thd = 0, h3 = 0, sideband = 0, noise = 0;
+    for (const SpectrumRun& earlier : trend) {
+        if (earlier.zone != finished.zone) continue;
+        count++;
+        thd += earlier.metrics.thd;
+        h3 += earlier.metrics.h3;
+        sideband += earlier.metrics.sideband;
+        noise += earlier.metrics.noise;
+    }
+    if (count < SPECTRUM_TREND_MIN) return 0;
+
+    auto rose = [count](uint32_t value, uint32_t sum) {
+        uint32_t mean = sum / count;
+        return value >= mean * SPECTRUM_TREND_FACTOR && value >= mean + SPECTRUM_TREND_FLOOR;
+    };
+    uint8_t flags = 0;
+    if (rose(finished.metrics.thd, thd) || rose(finished.metrics.h3, h3)) flags |= SPECTRUM_FLAG_HARMONICS;
+    if (rose(finished.metrics.sideband, sideband)) flags |= SPECTRUM_FLAG_SIDEBANDS;
+    if (rose(finished.metrics.noise, noise)) flags |= SPECTRUM_FLAG_NOISE;
+    return flags;
+}
+
+static void finish_run() {
+    if (run.zone == 0 || run.windows == 0) return;
+
+    SpectrumRun finished;
+    finished.timestamp = run.start_ms;
+    finished.zone = run.zone;
+    finished.windows = run.windows > UINT16_MAX ? UINT16_MAX : run.windows;
+    finished.metrics.f0_dhz = run.f0_dhz / run.windows;
+    finished.metrics.thd = run.thd / run.windows;
+    finished.metrics.h3 = run.h3 / run.windows;
+    finished.metrics.sideband = run.sideband / run.windows;
+    finished.metrics.noise = run.noise / run.windows;
+
+    xSemaphoreTake(result_mutex, portMAX_DELAY);
+    finished.flags = run_flags(finished);
+    trend.push(finished);
+    xSemaphoreGive(result_mutex);
+
+    if (finished.flags) {
+        Serial.printf("Spectrum: zone %u run flagged (0x%02x)\n", finished.zone, finished.flags);
+    }
+}
+
+static void analyse(uint8_t zone) {
+    uint32_t* amplitude = transform();
+    SpectrumMetrics metrics;
+    spectrum_metrics(amplitude, SPECTRUM_BINS, metrics);
+
+    run.windows++;
+    run.f0_dhz += metrics.f0_dhz;
+    run.thd += metrics.thd;
+    run.h3 += metrics.h3;
+    run.sideband += metrics.sideband;
+    run.noise += metrics.noise;
+
+    // Peak amplitude of a Hann-windowed sine is A * N / 4; as RMS in mA
+    const float scale = 2.0f * M_SQRT2 / SPECTRUM_SIZE * current_sensor_amps_per_stats_unit() * 1000.0f;
+    xSemaphoreTake(result_mutex, portMAX_DELAY);
+    latest.timestamp = input_start_ms;
+    latest.zone = zone;
+    latest.metrics = metrics;
+    for (uint32_t k = 0; k < SPECTRUM_BINS; k++) {
+        float ma = amplitude[k] * scale;
+        latest.amplitude_ma[k] = ma > UINT16_MAX ? UINT16_MAX : (uint16_t)ma;
+    }
+    xSemaphoreGive(result_mutex);
+}
+
+static void spectrum_hook(const AdcFrame& frame) {
+    if (__atomic_load_n(&input_state, __ATOMIC_ACQUIRE) != SPECTRUM_INPUT_FILLING) return;
+    if (input_fill == 0) input_start_ms = frame.timestamp;
+
+    uint32_t take = SPECTRUM_SIZE - input_fill;
+    if (take > frame.count) take = frame.count;
+    memcpy(&input[input_fill], frame.current, take * sizeof(input[0]));
+    input_fill += take;
+
+    if (input_fill == SPECTRUM_SIZE) {
+        __atomic_store_n(&input_state, SPECTRUM_INPUT_READY, __ATOMIC_RELEASE);
+        xTaskNotifyGive(spectrum_task_handle);
+    }
+}
+
+static void spectrum_task(void* arg) {
+    for (;;) {
+        bool notified = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(SPECTRUM_INTERVAL_MS)) > 0;
+
+        uint8_t zone = __atomic_load_n(&requested_zone, __ATOMIC_ACQUIRE);
+        uint32_t since = requested_since_ms;
+        if (zone != run.zone || since != run.start_ms) {
+            finish_run();
+            memset(&run, 0, sizeof(run));
+            run.zone = zone;
+            run.start_ms = since;
+        }
+
+        uint8_t state = __atomic_load_n(&input_state, __ATOMIC_ACQUIRE);
+        if (notified && state == SPECTRUM_INPUT_READY) {
+            // A window that began before the zone settled is dropped
+            if (zone != 0 && (int32_t)(input_start_ms - since) >= SPECTRUM_SETTLE_MS) {
+                analyse(zone);
+            }
+            __atomic_store_n(&input_state, SPECTRUM_INPUT_IDLE, __ATOMIC_RELEASE);
+        } else if (state == SPECTRUM_INPUT_IDLE && zone != 0 && millis() - since >= SPECTRUM_SETTLE_MS) {
+            input_fill = 0;
+            __atomic_store_n(&input_state, SPECTRUM_INPUT_FILLING, __ATOMIC_RELEASE);
+        }
+    }
+}
+
+void spectrum_init() {
+    if (spectrum_task_handle) return;
+    init_tables();
+    result_mutex = xSemaphoreCreateMutex();
+
+    xTaskCreate(spectrum_task, "spectrum", 3072, nullptr, SPECTRUM_TASK_PRIO, &spectrum_task_handle);
+    if (!spectrum_task_handle) {
+        Serial.println("Spectrum: failed to start analysis task");
+        return;
+    }
+    if (!adc_sampler_add_frame_hook(spectrum_hook)) {
+        Serial.println("Spectrum: no free sampler hook");
+    }
+}
+
+void spectrum_set_run(int zone) {
+    if (zone == requested_zone) return;
+    requested_since_ms = millis();
+    __atomic_store_n(&requested_zone, (uint8_t)zone, __ATOMIC_RELEASE);
+}
+
+bool spectrum_latest(SpectrumResult& out) {
+    if (!result_mutex) return false;
+    xSemaphoreTake(result_mutex, portMAX_DELAY);
+    out = latest;
+    xSemaphoreGive(result_mutex);
+    return out.timestamp != 0;
+}
+
+void spectrum_trend(SpectrumTrend& out) {
+    out.clear();
+    if (!result_mutex) return;
+    xSemaphoreTake(result_mutex, portMAX_DELAY);
+    for (const SpectrumRun& entry : trend) out.push(entry);
+    xSemaphoreGive(result_mutex);
+}
+
+uint32_t spectrum_benchmark(uint32_t iterations) {
+    init_tables();
+
+    // 8 A at 50 Hz with a 3rd harmonic and a little noise
+    const float units = current_sensor_stats_units(1.0f);
+    for (uint32_t n = 0; n < SPECTRUM_SIZE; n++) {
+        float t = (float)n / SPECTRUM_RATE_HZ;
+        float amps = 8.0f * M_SQRT2 * sinf(2.0f * PI * 50.0f * t) + 0.8f * sinf(2.0f * PI * 150.0f * t);
+        input[n] = (int16_t)(amps * units) + (int16_t)((n * 7919) % 17) - 8;
+    }
+
+    SpectrumMetrics metrics;
+    uint32_t start = micros();
+    for (uint32_t i = 0; i < iterations; i++) {
+        spectrum_metrics(transform(), SPECTRUM_BINS, metrics);
+    }
+    uint32_t elapsed = micros() - start;
+    return elapsed / (iterations ? iterations : 1);
+}
+
+const char* spectrum_flag_name(uint8_t flag) {
+    switch (flag) {
+        case SPECTRUM_FLAG_HARMONICS: return "harmonics";
+        case SPECTRUM_FLAG_SIDEBANDS: return "sidebands";
+        case SPECTRUM_FLAG_NOISE:     return "noise";
+        default:                      return "unknown";
+    }
+}
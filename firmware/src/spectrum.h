@@ -0,0 +1,98 @@
+#ifndef SPECTRUM_H
+#define SPECTRUM_H
+
+#include <Arduino.h>
+#include "ring_buffer.h"
+#include "adc_sampler.h"
+
+// Spectral analysis of the pump current. While a zone runs, a low priority
+// task takes a window of SPECTRUM_SIZE raw samples from the ADC sampler
+// about once a second, applies a Hann window and runs a fixed-point radix-2
+// FFT (integer only; the ESP32-C6 has no FPU). Each spectrum is reduced to
+// a few ratios against the mains fundamental:
+//
+//   thd       harmonics 2..15: distorted current, e.g. a failing run
+//             capacitor on a single-phase motor
+//   h3        the 3rd harmonic on its own, the capacitor's main signature
+//   sideband  energy between the harmonics up to 1 kHz: modulation by
+//             bearing defects and rotor faults shows up as sidebands there
+//   noise     energy between the harmonics above 1 kHz: the broadband
+//             load fluctuation of a cavitating pump
+//
+// The ratios are RMS ratios in permille of the fundamental. Each run's
+// averages are kept as a trend, and a metric is flagged when a run reaches
+// SPECTRUM_TREND_FACTOR times the zone's earlier runs.
+#define SPECTRUM_SIZE          1024 // Samples per FFT; a power of two
+#define SPECTRUM_RATE_HZ       (ADC_SAMPLER_RATE_HZ / 2) // Current pin samples per second
+#define SPECTRUM_INTERVAL_MS   1000 // Time between windows while a zone runs
+#define SPECTRUM_SETTLE_MS     3000 // Inrush and valve travel are not analysed
+#define SPECTRUM_MAX_HARMONIC  15
+#define SPECTRUM_TREND_RUNS    32   // Must stay a power of two
+#define SPECTRUM_TREND_MIN     3    // Earlier runs of a zone needed to flag one
+#define SPECTRUM_TREND_FACTOR  2    // Rise over the zone's earlier runs that is flagged
+#define SPECTRUM_TREND_FLOOR   20   // ...and never less than this many permille
+
+enum SpectrumFlag {
+  SPECTRUM_FLAG_HARMONICS = 1 << 0, // thd or h3
+  SPECTRUM_FLAG_SIDEBANDS = 1 << 1,
+  SPECTRUM_FLAG_NOISE     = 1 << 2
+};
+
+struct SpectrumMetrics {
+  uint16_t f0_dhz;   // Fundamental in 0.1 Hz; 0 if there is none (DC)
+  uint16_t thd;      // Permille of the fundamental, or of the whole AC
+  uint16_t h3;       // current when there is no fundamental
+  uint16_t sideband;
+  uint16_t noise;
+};
+
+// The last analysed window
+struct SpectrumResult {
+  uint32_t timestamp; // millis() at the start of the window; 0 if none yet
+  uint8_t zone;
+  SpectrumMetrics metrics;
+  uint16_t amplitude_ma[SPECTRUM_SIZE / 2]; // RMS per bin, DC first
+};
+
+// One zone run, averaged over its windows
+struct SpectrumRun {
+  uint32_t timestamp; // millis() when the run started
+  uint8_t zone;
+  uint8_t flags;      // SpectrumFlag
+  uint16_t windows;
+  SpectrumMetrics metrics;
+};
+
+typedef RingBuffer<SpectrumRun, SPECTRUM_TREND_RUNS> SpectrumTrend;
+
+// Hooks into the ADC sampler and starts the analysis task
+void spectrum_init();
+
+// Tells the analysis which zone the pump is feeding, 0 for none. Called
+// from the loop; a change ends the current run.
+void spectrum_set_run(int zone);
+
+// Copy the last analysed window and the run trend, oldest run first.
+// Safe from any task.
+bool spectrum_latest(SpectrumResult& out);
+void spectrum_trend(SpectrumTrend& out);
+
+// Frequency of a bin in 0.1 Hz
+uint32_t spectrum_bin_dhz(uint32_t bin);
+
+// In-place forward FFT of SPECTRUM_SIZE points. The input must stay below
+// 2^15 in magnitude; the output is unscaled (up to 2^25).
+void spectrum_fft(int32_t* re, int32_t* im);
+
+// Computes the metrics of `size` amplitude bins (|X| of an FFT, DC first).
+// Exposed for simulation with injected spectra.
+void spectrum_metrics(const uint32_t* amplitude, uint32_t size, SpectrumMetrics& out);
+
+// Times `iterations` FFTs plus the reduction on a synthetic window and
+// returns microseconds per FFT. Call before spectrum_init(): it borrows
+// the analysis buffers.
+uint32_t spectrum_benchmark(uint32_t iterations);
+
+const char* spectrum_flag_name(uint8_t flag);
+
+#endif // SPECTRUM_H
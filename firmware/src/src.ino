@@ -2,11 +2,22 @@
 #include "st7789_dma_driver.h" // Replaced DFRobot_GDL.h
 #include "styling.h"
 #include "CustomCanvas.h"
+#include "display_renderer.h"
+#include "frame_scheduler.h"
 #include "ui_components.h"
 #include "web_server.h" // Include the web server header
 #include "wifi_manager.h" // Include the new WiFi manager
 #include "config_manager.h" // Include the configuration manager
 #include "current_sensor.h" // Include the current sensor header
+#include "current_log.h"
+#include "current_stats.h"
+#include "series_codec.h"
+#include "zone_monitor.h"
+#include "pump_protection.h"
+#include "burst_capture.h"
+#include "spectrum.h"
+#include "web_events.h"
+#include "status_snapshot.h"
 #include "battery.h" // Include the battery header
 #include "logo.h"
 #include <LittleFS.h>
@@ -26,6 +37,28 @@
   #define DEBUG_PRINTF(format, ...)
 #endif
 
+// Times every screen with and without the glyph atlas at boot and reports
+// draw-call counts over serial
+#define DISPLAY_BENCHMARK false
+
+// Times appending 1000 records to the current log at boot
+#define CURRENT_LOG_BENCHMARK false
+
+// Times the current statistics kernel over one million samples at boot
+#define CURRENT_STATS_BENCHMARK false
+
+// Times encoding and decoding 100k history points at boot
+#define SERIES_CODEC_BENCHMARK false
+
+// Times the current spectrum FFT at boot, in microseconds and CPU cycles
+#define SPECTRUM_BENCHMARK false
+
+// Times building and serialising the status and cycles responses at boot
+#define WEB_SERVER_BENCHMARK false
+
+// Stop everything when the zone monitor flags an anomalous run
+#define ZONE_ANOMALY_AUTO_STOP false
+
 // -----------------------------------------------------------------------------
 //                    Rotary Encoder Inputs / Global Variables
 // -----------------------------------------------------------------------------
@@ -61,7 +94,10 @@ static const int PUMP_IDX = 0;   // borehole pump
 #define TFT_RST  3
 #define TFT_BL   5 // Backlight control pin for dimming
 
-CustomCanvas canvas(320, 240);
+// Shortest time the boot logo stays up; init runs while it is shown
+#define SPLASH_MIN_MS 1500
+
+CustomCanvas canvas(SCREEN_WIDTH, SCREEN_HEIGHT, DISPLAY_BAND_HEIGHT);
 
 // Relay labels (index 0 is the pump)
 const char* relayLabels[NUM_RELAYS] = {
@@ -74,7 +110,6 @@ const char* relayLabels[NUM_RELAYS] = {
 unsigned long lastActivityTime = 0;
 const unsigned long inactivityTimeout = 30000; // 30 seconds
 bool isScreenDimmed = false;
-volatile bool uiDirty = true; // Flag to trigger UI redraw
 
 // -----------------------------------------------------------------------------
 //                        Battery Level
@@ -111,7 +146,8 @@ enum UIState {
   STATE_PROG_C,
   STATE_RUNNING_ZONE,
   STATE_CYCLE_RUNNING,
-  STATE_TEST_MODE
+  STATE_TEST_MODE,
+  STATE_PUMP_TRIPPED
 };
 
 UIState currentState = STATE_BOOTING;
@@ -202,7 +238,9 @@ bool inInterZoneDelay = false;          // Flag for inter-zone delay
 bool testModeActive = false;
 int currentTestRelay = 0;           // 0-7: 0=pump, 1-7=zones
 unsigned long testModeStartTime = 0;
-const unsigned long TEST_INTERVAL = 5000; // 5 seconds per relay
+// 10 seconds per relay: long enough for the zone monitor to seed a
+// baseline once the inrush has settled
+const unsigned long TEST_INTERVAL = 10000;
 
 // -----------------------------------------------------------------------------
 //                  Time-Keeping (Software Simulation)
@@ -266,13 +304,15 @@ ScrollableList setTimeScrollList;
 // -----------------------------------------------------------------------------
 //                           Forward Declarations
 // -----------------------------------------------------------------------------
-void updateScreen();
 void render();
+void renderScreen(display_draw_fn_t draw);
+void snapshotLiveValues();
 void isrPinA();
 void handleEncoderMovement();
 void handleButtonPress();
 
-void drawLogo();
+void showSplash();
+void drawCurrentState();
 void drawMainMenu();
 void drawCyclesMenu();
 void drawCycleSubMenu(const char* label);
@@ -313,6 +353,7 @@ void startTestMode();
 void updateTestMode();
 void drawTestModeMenu();
 void stopTestMode();
+void drawPumpTrippedMenu();
 
 // -----------------------------------------------------------------------------
 //                              RELAY CONTROL
@@ -326,34 +367,147 @@ bool isAnyZoneActive() {
   return false;
 }
 
+// Switches a relay and, if that changes it, marks the switch for a burst
+// capture of the pump current. Loop only: the burst capture triggers and
+// the pump protection take one writer, so web requests are queued for the
+// loop (web_server_handle()).
+void setRelayState(int idx, bool on) {
+  if (relayStates[idx] != on) {
+    burst_capture_trigger(idx, on);
+  }
+  relayStates[idx] = on;
+  digitalWrite(relayPins[idx], on ? HIGH : LOW);
+}
+
+// The zone the pump is currently feeding, or 0 if the pump is off or more
+// than one zone is open
+int getPumpedZone() {
+  if (!relayStates[PUMP_IDX]) {
+    return 0;
+  }
+  int zone = 0;
+  for (int i = 1; i < NUM_RELAYS; i++) {
+    if (relayStates[i]) {
+      if (zone != 0) return 0;
+      zone = i;
+    }
+  }
+  return zone;
+}
+
 void setPumpState(bool on) {
+  if (on && pump_protection_tripped()) {
+    DEBUG_PRINTLN("PUMP SAFETY: Pump activation prevented. Protection trip is latched.");
+    on = false;
+  }
   if (on) {
     // Only turn the pump on if at least one zone is active.
     if (isAnyZoneActive()) {
       if (!relayStates[PUMP_IDX]) {
         DEBUG_PRINTF("Activating pump relay (pin %d)\n", relayPins[PUMP_IDX]);
-        relayStates[PUMP_IDX] = true;
-        digitalWrite(relayPins[PUMP_IDX], HIGH);
+        pump_protection_set_pump_on(true);
+        setRelayState(PUMP_IDX, true);
       }
     } else {
       DEBUG_PRINTLN("PUMP SAFETY: Pump activation prevented. No zones are active.");
       // Ensure pump is off if we get here, just in case.
       if (relayStates[PUMP_IDX]) {
-        relayStates[PUMP_IDX] = false;
-        digitalWrite(relayPins[PUMP_IDX], LOW);
+        setRelayState(PUMP_IDX, false);
+        pump_protection_set_pump_on(false);
       }
     }
   } else {
     // Turn the pump off.
     if (relayStates[PUMP_IDX]) {
       DEBUG_PRINTF("Deactivating pump on pin %d\n", relayPins[PUMP_IDX]);
-      relayStates[PUMP_IDX] = false;
-      digitalWrite(relayPins[PUMP_IDX], LOW);
+      setRelayState(PUMP_IDX, false);
+      pump_protection_set_pump_on(false);
     }
   }
 }
 
 
+#if DISPLAY_BENCHMARK
+// Renders every band of a frame into the canvas without pushing it, so only
+// the drawing cost is measured. Returns microseconds per frame.
+unsigned long benchmarkFrames(display_draw_fn_t draw, int iterations) {
+  unsigned long start = micros();
+  for (int i = 0; i < iterations; i++) {
+    snapshotLiveValues();
+    canvas.invalidate();
+    canvas.beginFrame();
+    for (int16_t y = 0; y < SCREEN_HEIGHT; y += canvas.bandHeight()) {
+      canvas.beginBand(y);
+      draw();
+    }
+    canvas.endFrame();
+  }
+  return (micros() - start) / iterations;
+}
+
+// Times the current screen with and without the glyph atlas and counts its
+// draw calls, as the device draws it (atlas on). Any off-screen draw is a
+// layout bug worth a look.
+void benchmarkScreen(const char* name) {
+  const int iterations = 20;
+  canvas.useGlyphAtlas(true);
+  canvas.resetDrawStats();
+  unsigned long atlasUs = benchmarkFrames(drawCurrentState, iterations);
+  uint32_t drawCalls = canvas.drawCalls();
+  uint32_t frameDrawCalls = canvas.frameDrawCalls();
+  uint32_t offscreen = canvas.offscreenDraws();
+  canvas.useGlyphAtlas(false);
+  unsigned long gfxUs = benchmarkFrames(drawCurrentState, iterations);
+  canvas.useGlyphAtlas(true);
+  Serial.printf("[BENCH] %-16s atlas %6lu us, gfx %6lu us, %4lu draw calls/frame (%5lu over bands), %lu off-screen\n",
+                name, atlasUs, gfxUs, (unsigned long)(frameDrawCalls / iterations),
+                (unsigned long)(drawCalls / iterations), (unsigned long)(offscreen / iterations));
+}
+
+// Walks every screen with the data loaded at boot. Screens whose entry in
+// navigateTo() only sets up their list are entered that way; the rest
+// (which would start relays, reset WiFi or reboot) are drawn in place.
+void runDisplayBenchmark() {
+  struct BenchScreen {
+    UIState state;
+    const char* name;
+    bool navigate;
+  };
+  static const BenchScreen screens[] = {
+    {STATE_MAIN_MENU, "Main menu", true},
+    {STATE_MANUAL_RUN, "Manual run", true},
+    {STATE_CYCLES_MENU, "Cycles", true},
+    {STATE_CYCLE_A_MENU, "Cycle A menu", true},
+    {STATE_PROG_A, "Cycle A config", true},
+    {STATE_SETTINGS, "Settings", true},
+    {STATE_SET_SYSTEM_TIME, "Set time", true},
+    {STATE_WIFI_SETUP_LAUNCHER, "WiFi setup", true},
+    {STATE_WIFI_RESET, "WiFi reset", false},
+    {STATE_SYSTEM_INFO, "System info", false},
+    {STATE_RESTART_DEVICE, "Restart", false},
+    {STATE_RUNNING_ZONE, "Running zone", false},
+    {STATE_CYCLE_RUNNING, "Cycle running", false},
+    {STATE_TEST_MODE, "Test mode", false},
+    {STATE_PUMP_TRIPPED, "Pump tripped", false},
+  };
+
+  st7789_wait_for_frame();
+  for (const BenchScreen& screen : screens) {
+    if (screen.navigate) {
+      navigateTo(screen.state);
+    } else {
+      currentState = screen.state;
+    }
+    benchmarkScreen(screen.name);
+  }
+
+  currentState = STATE_BOOTING;
+  uiStateStackPtr = -1;
+  frame_discard();
+  canvas.invalidate();
+}
+#endif
+
 // -----------------------------------------------------------------------------
 //                                     SETUP
 // -----------------------------------------------------------------------------
@@ -364,23 +518,25 @@ void setup() {
   DEBUG_PRINTF("Firmware Version: v1.0\n");
   DEBUG_PRINTF("Hardware: ESP32-C6\n");
   DEBUG_PRINTF("Free heap: %d bytes\n", ESP.getFreeHeap());
+  DEBUG_PRINTF("Display canvas: 2 x %d bytes (%d-row bands, full frame would be %d)\n",
+               SCREEN_WIDTH * canvas.bandHeight(), canvas.bandHeight(), SCREEN_WIDTH * SCREEN_HEIGHT);
 
   // Initialize display
   DEBUG_PRINTLN("Initializing display with custom driver...");
   st7789_init_display(TFT_DC, TFT_CS, TFT_RST, TFT_BL, &SPI); 
-  canvas.fillScreen(COLOR_BACKGROUND); // Clear canvas
+  uint16_t palette[PALETTE_SIZE];
+  CustomCanvas::buildPalette(palette);
+  display_set_palette(palette);
   DEBUG_PRINTLN("Display initialized successfully with custom driver");
+  DEBUG_PRINTF("Free heap after display init: %d bytes\n", ESP.getFreeHeap());
 
   // Backlight is handled by st7789_init_display and st7789_set_backlight
   lastActivityTime = millis();
 
-  // Show logo on boot
-  canvas.fillScreen(COLOR_BACKGROUND);
-  int16_t logo_x = (320 - LOGO_WIDTH) / 2;
-  int16_t logo_y = (240 - LOGO_HEIGHT) / 2;
-  canvas.drawRGBBitmap(logo_x, logo_y, logo_data, LOGO_WIDTH, LOGO_HEIGHT);
-  updateScreen();
-  delay(3000);
+  // Show logo on boot. It is decoded onto the panel in the background while
+  // the rest of the hardware comes up.
+  showSplash();
+  unsigned long splashStart = millis();
 
   // Rotary encoder pins
   DEBUG_PRINTLN("Configuring rotary encoder pins...");
@@ -402,6 +558,16 @@ void setup() {
   // Initialize the current sensor
   DEBUG_PRINTLN("Initializing current sensor...");
   setup_current_sensor();
+  pump_protection_init(relayPins[PUMP_IDX]);
+  burst_capture_init();
+#if SPECTRUM_BENCHMARK
+  {
+    uint32_t us = spectrum_benchmark(100);
+    Serial.printf("[BENCH] Spectrum: %lu us (%lu cycles) per %d-point FFT and reduction\n",
+                  (unsigned long)us, (unsigned long)(us * getCpuFrequencyMhz()), SPECTRUM_SIZE);
+  }
+#endif
+  spectrum_init();
   DEBUG_PRINTLN("Current sensor initialized.");
 
   // Initialize WiFi Manager. It will start connecting if credentials are saved.
@@ -412,6 +578,11 @@ void setup() {
     Serial.println("Failed to mount file system");
     // Handle error appropriately, maybe by rebooting or halting
   }
+  current_log_init();
+  zone_monitor_init();
+#if CURRENT_LOG_BENCHMARK
+  Serial.printf("[BENCH] Current log: %lu us per 1000 records\n", (unsigned long)current_log_benchmark(1000));
+#endif
 
   // Load configuration from LittleFS
   if (!loadConfig()) {
@@ -420,6 +591,40 @@ void setup() {
   }
   // Initialize the Web Server
   initWebServer();
+  status_snapshot_init();
+
+#if DISPLAY_BENCHMARK
+  runDisplayBenchmark();
+#endif
+#if CURRENT_STATS_BENCHMARK
+  {
+    uint32_t us = current_stats_benchmark(1000000);
+    Serial.printf("[BENCH] Current stats: %lu us per 1M samples (%lu samples/s)\n",
+                  (unsigned long)us, (unsigned long)(1000000ULL * 1000000 / (us ? us : 1)));
+  }
+#endif
+#if WEB_SERVER_BENCHMARK
+  {
+    uint32_t stringUs, streamUs;
+    size_t bytes;
+    web_server_benchmark(100, stringUs, streamUs, bytes);
+    Serial.printf("[BENCH] Web server: %u bytes of status and cycles, %lu us via String, %lu us streamed per request pair\n",
+                  (unsigned)bytes, (unsigned long)(stringUs / 100), (unsigned long)(streamUs / 100));
+  }
+#endif
+#if SERIES_CODEC_BENCHMARK
+  {
+    uint32_t encodeUs, decodeUs;
+    uint32_t bytes = series_codec_benchmark(100000, encodeUs, decodeUs);
+    Serial.printf("[BENCH] Series codec: 100k points in %lu bytes, encode %lu us, decode %lu us\n",
+                  (unsigned long)bytes, (unsigned long)encodeUs, (unsigned long)decodeUs);
+  }
+#endif
+
+  // Keep the logo up for a moment if init was quick
+  while (millis() - splashStart < SPLASH_MIN_MS) {
+    delay(10);
+  }
 
   // Move to appropriate state
   navigateTo(STATE_MAIN_MENU);
@@ -429,17 +634,42 @@ void setup() {
 // -----------------------------------------------------------------------------
 //                                RENDER
 // -----------------------------------------------------------------------------
-void render() {
-  if (isScreenDimmed) {
-    if (uiDirty) {
-      uiDirty = false;
-    }
-    return;
-  }
+// Values that change on their own (time, sensors, signal), read once per
+// frame by snapshotLiveValues(). The draw functions are replayed once per
+// display band, so they read these instead of the live sources: a reading
+// that changed between two bands would draw a line that crosses the band
+// edge half old, half new.
+struct LiveValues {
+  unsigned long nowMs;
+  uint32_t ip;
+  int8_t rssi;
+  float current;        // Pump current, A
+  float batteryVoltage;
+  uint32_t freeHeap;
+  PumpTripInfo trip;
+};
+LiveValues live;
+
+void snapshotLiveValues() {
+  live.nowMs = millis();
+  live.ip = wifi_manager_get_ip_raw();
+  live.rssi = wifi_manager_get_rssi();
+  live.current = read_wcs1800_current();
+  live.batteryVoltage = read_battery_voltage();
+  live.freeHeap = ESP.getFreeHeap();
+  live.trip = pump_protection_last_trip();
+}
 
-  if (!uiDirty) return;
+// Draws one frame with a fresh snapshot of the live values
+void renderScreen(display_draw_fn_t draw) {
+  snapshotLiveValues();
+  display_render(draw);
+}
 
-  // Draw the current UI state to the canvas
+// Draws the current UI state to the canvas. Replayed once per display band,
+// so the draw functions below must not change state, and read live values
+// only through `live`.
+void drawCurrentState() {
   switch (currentState) {
     case STATE_MAIN_MENU:       drawMainMenu(); break;
     case STATE_CYCLES_MENU:     drawCyclesMenu(); break;
@@ -459,6 +689,7 @@ void render() {
     case STATE_WIFI_RESET:      drawWiFiResetMenu(); break;
     case STATE_SYSTEM_INFO:     drawSystemInfoMenu(); break;
     case STATE_RESTART_DEVICE:  drawRestartDeviceMenu(); break;
+    case STATE_PUMP_TRIPPED:    drawPumpTrippedMenu(); break;
     default:
       // Draw an error screen or something
       canvas.fillScreen(COLOR_ERROR);
@@ -468,11 +699,30 @@ void render() {
       canvas.println("Unknown UI State!");
       break;
   }
+}
 
-  // Push the canvas to the screen
-  updateScreen();
-  
-  uiDirty = false; // Reset the flag
+void render() {
+  if (isScreenDimmed) {
+    frame_discard();
+    return;
+  }
+
+  // Input frames go out within FRAME_INPUT_INTERVAL_MS; clock and sensor
+  // refreshes wait for the screen's periodic interval and are batched.
+  if (!frame_due(millis())) return;
+
+  // The previous frame's last band is still streaming out. The first band
+  // of a new frame can be drawn meanwhile, but its push would block until
+  // the DMA is done; keep the request pending instead.
+  if (st7789_frame_in_flight()) return;
+
+  uint32_t start = micros();
+  frame_begin(millis());
+
+  // Draw the current UI state, one band at a time
+  renderScreen(drawCurrentState);
+
+  frame_end(micros() - start);
 }
 
 // -----------------------------------------------------------------------------
@@ -486,6 +736,30 @@ void loop() {
     DEBUG_PRINTLN("!!! PUMP SAFETY ALERT !!! Pump was on without an active zone. Forcing OFF.");
     setPumpState(false);
   }
+
+  // The sampler task has already switched the pump off; stop whatever was
+  // driving it and show why
+  static uint32_t lastTripCount = 0;
+  uint32_t tripCount = pump_protection_trip_count();
+  if (tripCount != lastTripCount) {
+    lastTripCount = tripCount;
+    [[maybe_unused]] PumpTripInfo trip = pump_protection_last_trip(); // Only logged
+    DEBUG_PRINTF("!!! PUMP PROTECTION TRIP !!! %s at %.2f A\n", pump_trip_reason_name(trip.reason), trip.current);
+    if (testModeActive) {
+      stopTestMode();
+    } else {
+      stopAllActivity();
+    }
+    lastActivityTime = millis();
+    if (isScreenDimmed) {
+      st7789_set_backlight(true);
+      isScreenDimmed = false;
+    }
+    navigateTo(STATE_PUMP_TRIPPED);
+  } else if (currentState == STATE_PUMP_TRIPPED && !pump_protection_tripped()) {
+    // Reset from the web interface
+    navigateTo(STATE_MAIN_MENU);
+  }
   // --------------------------------------------------------
 
   // Handle WiFi and NTP updates
@@ -503,13 +777,49 @@ void loop() {
   // Update the current history
   update_current_history();
 
+  // Compare each new current window against the running zone's baseline
+  static uint32_t lastStatsWindow = 0;
+  CurrentSensorStats currentStats;
+  if (read_wcs1800_stats(currentStats) && currentStats.window != lastStatsWindow) {
+    lastStatsWindow = currentStats.window;
+    ZoneAnomalyType anomaly = zone_monitor_update(getPumpedZone(), testModeActive, currentStats.rms);
+    spectrum_set_run(getPumpedZone());
+#if ZONE_ANOMALY_AUTO_STOP
+    if (anomaly != ZONE_ANOMALY_NONE) {
+      DEBUG_PRINTF("Zone anomaly (%s) - stopping all activity\n", zone_anomaly_name(anomaly));
+      stopAllActivity();
+      navigateTo(STATE_MAIN_MENU);
+    }
+#else
+    (void)anomaly;
+#endif
+  }
+
   // --- Read battery level ---
   static unsigned long lastBatteryRead = 0;
   if (millis() - lastBatteryRead > 5000) { // Read every 5 seconds
     batteryLevel = read_battery_level();
     DEBUG_PRINTF("[BATTERY] Level: %d%%\n", batteryLevel);
     lastBatteryRead = millis();
-    uiDirty = true; // Redraw header with new level
+    frame_invalidate(FRAME_REASON_LIVE); // Redraw header with new level
+  }
+  // ----------------------------------------------------
+
+  // Zone starts and stops from the web UI
+  web_server_handle();
+  // Push what changed to open web pages
+  web_events_handle();
+  // Rebuild the shared /api/status response
+  status_snapshot_handle();
+
+  // --- DEBUG: Frame scheduler statistics ---
+  static unsigned long lastFrameStats = 0;
+  if (millis() - lastFrameStats > 60000) {
+    FrameStats stats;
+    frame_get_stats(stats);
+    DEBUG_PRINTF("[FRAMES] requested %u, rendered %u, skipped %u, last %u us, max %u us\n",
+                 stats.requests, stats.rendered, stats.skipped, stats.lastRenderUs, stats.maxRenderUs);
+    lastFrameStats = millis();
   }
   // ----------------------------------------------------
   
@@ -563,7 +873,7 @@ void loop() {
     static unsigned long lastDisplayUpdate = 0;
     if (millis() - lastDisplayUpdate > 5000) {
       lastDisplayUpdate = millis();
-      uiDirty = true;
+      frame_invalidate(FRAME_REASON_LIVE);
     }
     
     if (isTimedRun && zoneDuration > 0) {
@@ -593,7 +903,7 @@ void IRAM_ATTR isrPinA() {
     encoderValue = encoderValue + 1;
   }
   encoderMoved = true;
-  uiDirty = true;
+  frame_invalidate(FRAME_REASON_INPUT);
 }
 
 // -----------------------------------------------------------------------------
@@ -616,11 +926,11 @@ void handleEncoderMovement() {
   if (isScreenDimmed) {
     st7789_set_backlight(true); // Full brightness
     isScreenDimmed = false;
-    uiDirty = true; // Redraw the screen
+    frame_invalidate(FRAME_REASON_INPUT); // Redraw the screen
     DEBUG_PRINTLN("Screen woken up by encoder movement.");
     return; // Ignore the first input
   }
-  uiDirty = true;
+  frame_invalidate(FRAME_REASON_INPUT);
 
   DEBUG_PRINTF("Encoder moved: diff=%ld, state=%d\n", diff, currentState);
 
@@ -700,11 +1010,11 @@ void handleButtonPress() {
       if (isScreenDimmed) {
         st7789_set_backlight(true); // Full brightness
         isScreenDimmed = false;
-        uiDirty = true; // Redraw the screen
+        frame_invalidate(FRAME_REASON_INPUT); // Redraw the screen
         DEBUG_PRINTLN("Screen woken up by button press.");
         return; // Ignore the first input
       }
-      uiDirty = true;
+      frame_invalidate(FRAME_REASON_INPUT);
 
       // State-Specific Handling
       switch (currentState) {
@@ -835,6 +1145,12 @@ void handleButtonPress() {
           goBack();
           break;
 
+        case STATE_PUMP_TRIPPED:
+          DEBUG_PRINTLN("Resetting pump protection trip");
+          pump_protection_reset();
+          navigateTo(STATE_MAIN_MENU);
+          break;
+
         default:
           DEBUG_PRINTF("Button press in unknown state: %d\n", currentState);
           break;
@@ -864,7 +1180,7 @@ void navigateTo(UIState newState, bool isNavigatingBack) {
   const char* stateNames[] = {
     "MAIN_MENU", "MANUAL_RUN", "CYCLES_MENU", "CYCLE_A_MENU", "CYCLE_B_MENU", "CYCLE_C_MENU",
     "SETTINGS", "SET_SYSTEM_TIME", "WIFI_SETUP_LAUNCHER", "WIFI_RESET", "SYSTEM_INFO",
-    "PROG_A", "PROG_B", "PROG_C", "RUNNING_ZONE", "CYCLE_RUNNING", "TEST_MODE"
+    "PROG_A", "PROG_B", "PROG_C", "RUNNING_ZONE", "CYCLE_RUNNING", "TEST_MODE", "PUMP_TRIPPED"
   };
   
   DEBUG_PRINTF("State transition: %s -> %s\n", 
@@ -882,7 +1198,15 @@ void navigateTo(UIState newState, bool isNavigatingBack) {
   }
   
   currentState = newState;
-  uiDirty = true;
+  frame_invalidate(FRAME_REASON_STATE);
+
+  // Screens with running timers refresh every second; the rest only show
+  // the clock to the minute, so their periodic redraws are batched further.
+  if (currentState == STATE_RUNNING_ZONE || currentState == STATE_CYCLE_RUNNING || currentState == STATE_TEST_MODE) {
+    frame_set_periodic_interval(FRAME_PERIODIC_INTERVAL_MS);
+  } else {
+    frame_set_periodic_interval(5000);
+  }
 
   switch (currentState) {
     case STATE_MAIN_MENU:
@@ -1008,7 +1332,18 @@ void navigateTo(UIState newState, bool isNavigatingBack) {
       DEBUG_PRINTLN("Entering WiFi Setup Launcher");
       break;
     case STATE_WIFI_RESET:
-      drawWiFiResetMenu();
+      renderScreen(drawWiFiResetMenu);
+      st7789_wait_for_frame();
+      delay(3000);
+      current_log_flush();
+      wifi_manager_reset_credentials();
+      break;
+    case STATE_RESTART_DEVICE:
+      renderScreen(drawRestartDeviceMenu);
+      st7789_wait_for_frame();
+      delay(2000);
+      current_log_flush();
+      ESP.restart();
       break;
     case STATE_SYSTEM_INFO:
       DEBUG_PRINTLN("Displaying system information");
@@ -1041,7 +1376,7 @@ void navigateTo(UIState newState, bool isNavigatingBack) {
         cycleZonesScrollList.x = 0;
         cycleZonesScrollList.y = 160;
         cycleZonesScrollList.width = 320;
-        cycleZonesScrollList.height = 95;
+        cycleZonesScrollList.height = 240 - 160;
         cycleZonesScrollList.item_text_size = 2;
         cycleZonesScrollList.title = "Zone Durations (min)";
         cycleZonesScrollList.title_text_size = 2;
@@ -1062,6 +1397,9 @@ void navigateTo(UIState newState, bool isNavigatingBack) {
       DEBUG_PRINTLN("Starting test mode");
       startTestMode();
       break;
+    case STATE_PUMP_TRIPPED:
+      DEBUG_PRINTLN("Entering pump tripped state");
+      break;
     default:
       DEBUG_PRINTF("Unknown state entered: %d\n", currentState);
       break;
@@ -1073,13 +1411,13 @@ void navigateTo(UIState newState, bool isNavigatingBack) {
 // -----------------------------------------------------------------------------
 void drawMainMenu() {
   canvas.fillScreen(COLOR_BACKGROUND);
-  drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), wifi_manager_get_ip(), batteryLevel, wifi_manager_get_rssi());
+  drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), live.ip, batteryLevel, live.rssi);
   drawScrollableList(canvas, mainMenuScrollList, true);
 
   // Draw the logo in the bottom right corner
   int16_t logo_x = SCREEN_WIDTH - LOGO_WIDTH - 5;
   int16_t logo_y = SCREEN_HEIGHT - LOGO_HEIGHT - 5;
-  canvas.drawRGBBitmap(logo_x, logo_y, logo_data, LOGO_WIDTH, LOGO_HEIGHT);
+  canvas.drawImage(logo_x, logo_y, logo_data, LOGO_WIDTH, LOGO_HEIGHT);
 }
 
 // -----------------------------------------------------------------------------
@@ -1087,7 +1425,7 @@ void drawMainMenu() {
 // -----------------------------------------------------------------------------
 void drawCyclesMenu() {
   canvas.fillScreen(COLOR_BACKGROUND);
-  drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), wifi_manager_get_ip(), batteryLevel, wifi_manager_get_rssi());
+  drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), live.ip, batteryLevel, live.rssi);
   drawScrollableList(canvas, cyclesMenuScrollList, true);
 }
 
@@ -1096,7 +1434,7 @@ void drawCyclesMenu() {
 // -----------------------------------------------------------------------------
 void drawCycleSubMenu(const char* label) {
   canvas.fillScreen(COLOR_BACKGROUND);
-  drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), wifi_manager_get_ip(), batteryLevel, wifi_manager_get_rssi());
+  drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), live.ip, batteryLevel, live.rssi);
   cycleSubMenuScrollList.title = label;
   drawScrollableList(canvas, cycleSubMenuScrollList, true);
 }
@@ -1105,8 +1443,17 @@ void drawCycleSubMenu(const char* label) {
 //                           LOGO DISPLAY
 // -----------------------------------------------------------------------------
 
-void updateScreen() {
-  st7789_push_canvas(canvas.getBuffer(), 320, 240);
+void drawBlankScreen() {
+  canvas.fillScreen(COLOR_BACKGROUND);
+}
+
+// Clears the screen through the canvas, then streams the logo straight into
+// its window on the panel. Returns without waiting for the logo.
+void showSplash() {
+  renderScreen(drawBlankScreen);
+  int16_t logo_x = (SCREEN_WIDTH - LOGO_WIDTH) / 2;
+  int16_t logo_y = (SCREEN_HEIGHT - LOGO_HEIGHT) / 2;
+  display_show_image(logo_x, logo_y, logo_data, LOGO_WIDTH, LOGO_HEIGHT);
 }
 // -----------------------------------------------------------------------------
 //                         SIMPLE SOFTWARE CLOCK
@@ -1118,7 +1465,7 @@ void updateSoftwareClock() {
     incrementOneSecond();
 
     if (currentState == STATE_MAIN_MENU || currentState == STATE_CYCLE_RUNNING || currentState == STATE_RUNNING_ZONE) {
-      uiDirty = true;
+      frame_invalidate(FRAME_REASON_CLOCK);
     }
   }
 }
@@ -1148,7 +1495,7 @@ DayOfWeek getCurrentDayOfWeek() {
 // -----------------------------------------------------------------------------
 void drawManualRunMenu() {
   canvas.fillScreen(COLOR_BACKGROUND);
-  drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), wifi_manager_get_ip(), batteryLevel, wifi_manager_get_rssi());
+  drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), live.ip, batteryLevel, live.rssi);
 
   if (selectingDuration) {
     canvas.setTextSize(2);
@@ -1185,8 +1532,7 @@ void startManualZone(int zoneIdx) {
   stopAllActivity();
 
   DEBUG_PRINTF("Activating zone %d relay (pin %d)\n", zoneIdx, relayPins[zoneIdx]);
-  relayStates[zoneIdx] = true;
-  digitalWrite(relayPins[zoneIdx], HIGH);
+  setRelayState(zoneIdx, true);
 
   // Use the new centralized function to control the pump
   setPumpState(true);
@@ -1207,14 +1553,14 @@ void startManualZone(int zoneIdx) {
 
 void drawRunningZoneMenu() {
   canvas.fillScreen(COLOR_BACKGROUND);
-  drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), wifi_manager_get_ip(), batteryLevel, wifi_manager_get_rssi());
+  drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), live.ip, batteryLevel, live.rssi);
 
   canvas.setTextSize(2);
   canvas.setTextColor(COLOR_ACCENT_SECONDARY);
   canvas.setCursor(LEFT_PADDING, HEADER_HEIGHT + 10);
   canvas.println("Zone Running");
 
-  unsigned long elapsed = millis() - zoneStartTime;
+  unsigned long elapsed = live.nowMs - zoneStartTime;
   unsigned long elapsedSeconds = elapsed / 1000;
   unsigned long elapsedMinutes = elapsedSeconds / 60;
   unsigned long remainingSeconds = elapsedSeconds % 60;
@@ -1267,8 +1613,7 @@ void stopAllActivity() {
     if (relayStates[i]) {
       DEBUG_PRINTF("Deactivating zone %d (%s) on pin %d\n", i, systemConfig.zoneNames[i-1], relayPins[i]);
     }
-    relayStates[i] = false;
-    digitalWrite(relayPins[i], LOW);
+    setRelayState(i, false);
   }
   
   // Now that all zones are off, turn off the pump.
@@ -1297,7 +1642,7 @@ char setTimeDisplayStrings[7][32];
 const char* setTimeDisplayPointers[7];
 
 void drawSetSystemTimeMenu() {
-    drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), wifi_manager_get_ip(), batteryLevel, wifi_manager_get_rssi());
+    drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), live.ip, batteryLevel, live.rssi);
     
     // Set the background color based on editing state
     if (editingTimeField) {
@@ -1360,7 +1705,7 @@ void handleSetSystemTimeEncoder(long diff) {
     handleScrollableListInput(setTimeScrollList, diff);
   }
   
-  uiDirty = true;
+  frame_invalidate(FRAME_REASON_INPUT);
 }
 
 void handleSetSystemTimeButton() {
@@ -1378,7 +1723,7 @@ void handleSetSystemTimeButton() {
     }
   }
   
-  uiDirty = true;
+  frame_invalidate(FRAME_REASON_INPUT);
 }
 
 // -----------------------------------------------------------------------------
@@ -1386,7 +1731,7 @@ void handleSetSystemTimeButton() {
 // -----------------------------------------------------------------------------
 void drawCycleConfigMenu(const char* label, CycleConfig& cfg) {
   canvas.fillScreen(COLOR_BACKGROUND);
-  drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), wifi_manager_get_ip(), batteryLevel, wifi_manager_get_rssi());
+  drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), live.ip, batteryLevel, live.rssi);
 
   // Update the display strings for the zone list before drawing
   for (int i = 0; i < ZONE_COUNT; i++) {
@@ -1503,6 +1848,8 @@ void handleCycleEditEncoder(long diff, CycleConfig &cfg, const char* progLabel)
           break;
       }
     }
+    // Edits take effect in memory at once; the save comes on leaving the field
+    if (diff != 0) markConfigChanged();
   } else {
     // Not in edit mode, so navigate between fields
     if (cycleEditFieldIndex == 11) {
@@ -1514,7 +1861,7 @@ void handleCycleEditEncoder(long diff, CycleConfig &cfg, const char* progLabel)
       if (cycleEditFieldIndex >= num_fields) cycleEditFieldIndex = 0;
     }
   }
-  uiDirty = true;
+  frame_invalidate(FRAME_REASON_INPUT);
 }
 
 void handleCycleEditButton(CycleConfig &cfg, UIState thisState, const char* progLabel) {
@@ -1540,7 +1887,7 @@ void handleCycleEditButton(CycleConfig &cfg, UIState thisState, const char* prog
     saveConfig();
   }
   
-  uiDirty = true;
+  frame_invalidate(FRAME_REASON_INPUT);
 }
 
 void startCycleRun(int cycleIndex, ActiveOperationType type) {
@@ -1581,8 +1928,7 @@ void updateCycleRun() {
       if (!relayStates[zoneToRun]) {
         // A zone is not running, so let's start it.
         DEBUG_PRINTF("Activating cycle zone %d (%s) and pump\n", zoneToRun, systemConfig.zoneNames[zoneToRun-1]);
-        relayStates[zoneToRun] = true;
-        digitalWrite(relayPins[zoneToRun], HIGH);
+        setRelayState(zoneToRun, true);
         
         // Now that a zone is on, activate the pump.
         setPumpState(true);
@@ -1593,8 +1939,7 @@ void updateCycleRun() {
       unsigned long elapsedZoneTime = currentTime - cycleZoneStartTime;
       if (elapsedZoneTime >= zoneRunDuration) {
         DEBUG_PRINTF("Cycle %s, Zone %d finished. Starting inter-zone delay.\n", cfg->name, zoneToRun);
-        relayStates[zoneToRun] = false;
-        digitalWrite(relayPins[zoneToRun], LOW);
+        setRelayState(zoneToRun, false);
         
         // If there's a delay, turn off the pump.
         if (cfg->interZoneDelay > 0) {
@@ -1614,7 +1959,7 @@ void updateCycleRun() {
   static unsigned long lastDisplayUpdate = 0;
   if (millis() - lastDisplayUpdate > 5000) {
     lastDisplayUpdate = millis();
-    uiDirty = true;
+    frame_invalidate(FRAME_REASON_LIVE);
   }
 }
 
@@ -1623,7 +1968,7 @@ void updateCycleRun() {
 void drawCycleRunningMenu() {
   canvas.fillScreen(COLOR_BACKGROUND);
 
-  drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), wifi_manager_get_ip(), batteryLevel, wifi_manager_get_rssi());
+  drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), live.ip, batteryLevel, live.rssi);
   canvas.setTextSize(2);
   canvas.setTextColor(COLOR_ACCENT_SECONDARY);
 
@@ -1637,7 +1982,7 @@ void drawCycleRunningMenu() {
     if (inInterZoneDelay) {
       canvas.setTextColor(COLOR_ACCENT_PRIMARY);
       canvas.setCursor(LEFT_PADDING, 110);
-      unsigned long elapsedDelay = (millis() - cycleInterZoneDelayStartTime) / 1000;
+      unsigned long elapsedDelay = (live.nowMs - cycleInterZoneDelayStartTime) / 1000;
       unsigned long remainingDelay = (unsigned long)cfg->interZoneDelay * 60 - elapsedDelay;
       canvas.printf("Delay: %02lu:%02lu", remainingDelay / 60, remainingDelay % 60);
       canvas.setCursor(LEFT_PADDING, 140);
@@ -1646,7 +1991,7 @@ void drawCycleRunningMenu() {
     } else if (currentCycleZoneIndex < ZONE_COUNT) {
       int zoneToRun = currentCycleZoneIndex + 1;
       unsigned long zoneRunDuration = (unsigned long)cfg->zoneDurations[currentCycleZoneIndex] * 60000;
-      unsigned long elapsedZoneTime = millis() - cycleZoneStartTime;
+      unsigned long elapsedZoneTime = live.nowMs - cycleZoneStartTime;
       unsigned long remainingZoneTime = (zoneRunDuration - elapsedZoneTime) / 1000;
 
       canvas.setTextColor(COLOR_ACCENT_PRIMARY);
@@ -1663,18 +2008,16 @@ void drawCycleRunningMenu() {
     canvas.setCursor(LEFT_PADDING, 170);
     canvas.setTextColor(relayStates[PUMP_IDX] ? COLOR_SUCCESS : COLOR_ERROR);
     canvas.printf("Pump: %s", relayStates[PUMP_IDX] ? "ON" : "OFF");
-
-    canvas.setTextSize(1);
-    canvas.setTextColor(COLOR_TEXT_PRIMARY);
-    canvas.setCursor(LEFT_PADDING, 200);
   } else {
     canvas.setTextColor(COLOR_ERROR);
     canvas.setCursor(LEFT_PADDING, 80);
     canvas.println("No Cycle Active");
   }
 
+  // Bottom hint, placed like the one on the system info screen
+  canvas.setTextSize(1);
   canvas.setTextColor(COLOR_ACCENT_SECONDARY);
-  canvas.setCursor(LEFT_PADDING, 300);
+  canvas.setCursor(LEFT_PADDING, 225);
   canvas.println("Press button to stop cycle");
 }
 
@@ -1684,7 +2027,7 @@ void drawCycleRunningMenu() {
 // -----------------------------------------------------------------------------
 void drawSettingsMenu() {
   canvas.fillScreen(COLOR_BACKGROUND);
-  drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), wifi_manager_get_ip(), batteryLevel, wifi_manager_get_rssi());
+  drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), live.ip, batteryLevel, live.rssi);
   
   canvas.setTextSize(1);
   int yPos = HEADER_HEIGHT + 10;
@@ -1722,13 +2065,13 @@ void drawSettingsMenu() {
 
 void drawWiFiSetupLauncherMenu() {
   canvas.fillScreen(COLOR_BACKGROUND);
-  drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), wifi_manager_get_ip(), batteryLevel, wifi_manager_get_rssi());
+  drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), live.ip, batteryLevel, live.rssi);
   drawScrollableList(canvas, wifiSetupLauncherScrollList, true);
 }
 
 void drawWiFiResetMenu() {
   canvas.fillScreen(COLOR_BACKGROUND);
-  drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), wifi_manager_get_ip(), batteryLevel, wifi_manager_get_rssi());
+  drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), live.ip, batteryLevel, live.rssi);
   canvas.setTextSize(2);
   canvas.setTextColor(COLOR_ACCENT_SECONDARY);
   canvas.setCursor(LEFT_PADDING, HEADER_HEIGHT + 10);
@@ -1739,16 +2082,11 @@ void drawWiFiResetMenu() {
   canvas.println("Clearing saved WiFi");
   canvas.println("credentials and");
   canvas.println("restarting device...");
-
-  st7789_push_canvas(canvas.getBuffer(), 320, 240);
-  delay(3000);
-
-  wifi_manager_reset_credentials();
 }
 
 void drawSystemInfoMenu() {
   canvas.fillScreen(COLOR_BACKGROUND);
-  drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), wifi_manager_get_ip(), batteryLevel, wifi_manager_get_rssi());
+  drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), live.ip, batteryLevel, live.rssi);
   canvas.setTextSize(2);
   canvas.setTextColor(COLOR_ACCENT_SECONDARY);
   canvas.setCursor(LEFT_PADDING, HEADER_HEIGHT + 10);
@@ -1767,11 +2105,11 @@ void drawSystemInfoMenu() {
   y += 12;
   
   canvas.setCursor(LEFT_PADDING, y);
-  canvas.printf("Free Heap: %d bytes", ESP.getFreeHeap());
+  canvas.printf("Free Heap: %lu bytes", (unsigned long)live.freeHeap);
   y += 12;
 
   canvas.setCursor(LEFT_PADDING, y);
-  canvas.printf("Battery: %.2fV (%d%%)", read_battery_voltage(), batteryLevel);
+  canvas.printf("Battery: %.2fV (%d%%)", live.batteryVoltage, batteryLevel);
   y += 20;
 
   canvas.setCursor(LEFT_PADDING, y);
@@ -1788,7 +2126,7 @@ void drawSystemInfoMenu() {
     y += 12;
     
     canvas.setCursor(LEFT_PADDING, y);
-    canvas.printf("Signal: %d dBm", wifi_manager_get_rssi());
+    canvas.printf("Signal: %d dBm", live.rssi);
     y += 12;
     
     canvas.setCursor(LEFT_PADDING, y);
@@ -1811,7 +2149,7 @@ void drawSystemInfoMenu() {
     canvas.setCursor(LEFT_PADDING, y);
     unsigned long lastSyncMillis = wifi_manager_get_last_ntp_sync();
     if (lastSyncMillis > 0) {
-        canvas.printf("Last Sync: %lu min ago", (millis() - lastSyncMillis) / 60000);
+        canvas.printf("Last Sync: %lu min ago", (live.nowMs - lastSyncMillis) / 60000);
     } else {
         canvas.print("Last Sync: Never");
     }
@@ -1826,7 +2164,7 @@ void drawSystemInfoMenu() {
 
 void drawRestartDeviceMenu() {
   canvas.fillScreen(COLOR_BACKGROUND);
-  drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), wifi_manager_get_ip(), batteryLevel, wifi_manager_get_rssi());
+  drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), live.ip, batteryLevel, live.rssi);
   canvas.setTextSize(2);
   canvas.setTextColor(COLOR_ACCENT_SECONDARY);
   canvas.setCursor(LEFT_PADDING, HEADER_HEIGHT + 10);
@@ -1835,11 +2173,34 @@ void drawRestartDeviceMenu() {
   canvas.setTextColor(COLOR_TEXT_PRIMARY);
   canvas.setCursor(LEFT_PADDING, HEADER_HEIGHT + 50);
   canvas.println("Device is restarting...");
+}
 
-  st7789_push_canvas(canvas.getBuffer(), 320, 240);
-  delay(2000);
+void drawPumpTrippedMenu() {
+  const PumpTripInfo& trip = live.trip;
+
+  canvas.fillScreen(COLOR_BACKGROUND);
+  drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), live.ip, batteryLevel, live.rssi);
+  canvas.setTextSize(2);
+  canvas.setTextColor(COLOR_ERROR);
+  canvas.setCursor(LEFT_PADDING, HEADER_HEIGHT + 10);
+  canvas.println("Pump Tripped");
 
-  ESP.restart();
+  canvas.setTextColor(COLOR_TEXT_PRIMARY);
+  canvas.setCursor(LEFT_PADDING, HEADER_HEIGHT + 50);
+  if (trip.reason == PUMP_TRIP_OVERCURRENT) {
+    canvas.println("Overcurrent");
+  } else {
+    canvas.println("Running dry");
+  }
+  canvas.setCursor(LEFT_PADDING, HEADER_HEIGHT + 75);
+  canvas.printf("%.2f A", trip.current);
+  canvas.setCursor(LEFT_PADDING, HEADER_HEIGHT + 100);
+  canvas.printf("%lu min ago", (unsigned long)((live.nowMs - trip.timestamp) / 60000));
+
+  canvas.setTextColor(COLOR_ACCENT_SECONDARY);
+  canvas.setCursor(LEFT_PADDING, 225);
+  canvas.setTextSize(1);
+  canvas.println("Press button to reset");
 }
 
 // -----------------------------------------------------------------------------
@@ -1855,11 +2216,10 @@ void startTestMode() {
   stopAllActivity();
   
   DEBUG_PRINTF("Testing Zone %d. Turning on relay %d and pump.\n", currentTestRelay, currentTestRelay);
-  relayStates[currentTestRelay] = true;
-  digitalWrite(relayPins[currentTestRelay], HIGH);
+  setRelayState(currentTestRelay, true);
   setPumpState(true); // This will turn on the pump because a zone is active
   
-  uiDirty = true;
+  frame_invalidate(FRAME_REASON_STATE);
   
   DEBUG_PRINTLN("Test mode initialized - Zone 1 and pump are now ON");
 }
@@ -1871,7 +2231,7 @@ void updateTestMode() {
   static unsigned long lastDisplayUpdate = 0;
   if (millis() - lastDisplayUpdate > 1000) { // Update every second
     lastDisplayUpdate = millis();
-    uiDirty = true;
+    frame_invalidate(FRAME_REASON_LIVE);
   }
   
   unsigned long currentTime = millis();
@@ -1881,8 +2241,7 @@ void updateTestMode() {
     // Turn off the current zone and the pump
     if (currentTestRelay < NUM_RELAYS) {
       DEBUG_PRINTF("Turning off Zone %d (relay %d).\n", currentTestRelay, currentTestRelay);
-      relayStates[currentTestRelay] = false;
-      digitalWrite(relayPins[currentTestRelay], LOW);
+      setRelayState(currentTestRelay, false);
       setPumpState(false);
     }
     
@@ -1897,19 +2256,18 @@ void updateTestMode() {
     
     // Turn on the next zone and the pump
     DEBUG_PRINTF("Testing Zone %d. Turning on relay %d and pump.\n", currentTestRelay, currentTestRelay);
-    relayStates[currentTestRelay] = true;
-    digitalWrite(relayPins[currentTestRelay], HIGH);
+    setRelayState(currentTestRelay, true);
     setPumpState(true);
     
     testModeStartTime = currentTime;
     
-    uiDirty = true;
+    frame_invalidate(FRAME_REASON_STATE);
   }
 }
 
 void drawTestModeMenu() {
   canvas.fillScreen(COLOR_BACKGROUND);
-  drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), wifi_manager_get_ip(), batteryLevel, wifi_manager_get_rssi());
+  drawHeader(canvas, LEFT_PADDING, 10, currentDateTime, getCurrentDayOfWeek(), live.ip, batteryLevel, live.rssi);
   
   canvas.setTextSize(2);
   canvas.setTextColor(COLOR_ACCENT_SECONDARY);
@@ -1923,7 +2281,7 @@ void drawTestModeMenu() {
   if (currentTestRelay > 0 && currentTestRelay < NUM_RELAYS) {
     canvas.printf("Testing: %s", systemConfig.zoneNames[currentTestRelay-1]);
     
-    unsigned long elapsed = millis() - testModeStartTime;
+    unsigned long elapsed = live.nowMs - testModeStartTime;
     unsigned long remaining = (TEST_INTERVAL - elapsed) / 1000;
     
     canvas.setNewLine();
@@ -1935,10 +2293,9 @@ void drawTestModeMenu() {
     canvas.printf("Zone %d of %d", currentTestRelay, ZONE_COUNT);
 
     // Display the current reading
-    float current = read_wcs1800_current();
     canvas.setNewLine();
     canvas.setTextColor(COLOR_WARNING); // Use a different color for the current
-    canvas.printf("Current: %.2f A", current);
+    canvas.printf("Current: %.2f A", live.current);
 
   } else {
     canvas.print("Test Complete!");
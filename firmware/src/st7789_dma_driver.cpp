@@ -1,9 +1,242 @@
 #include "st7789_dma_driver.h"
 #include <SPI.h>
+#include <esp_heap_caps.h>
+#include "driver/spi_master.h"
+#include "driver/gpio.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// SPI settings for the pixel stream. The Adafruit driver only sends the
+// panel init sequence; after that the bus is handed over to the ESP-IDF
+// SPI master so pixel data can be queued for DMA.
+#define ST7789_SPI_HOST       SPI2_HOST
+#define ST7789_SPI_CLOCK_HZ   40000000
+#define ST7789_CHUNK_PIXELS   (320 * 2) // Two full display lines per DMA transfer
+#define ST7789_PUSH_TASK_PRIO 2
+
+// ST7789 commands used for partial window writes
+#define ST7789_CASET 0x2A
+#define ST7789_RASET 0x2B
+#define ST7789_RAMWR 0x2C
 
 // Global pointer to the display object
 static Adafruit_ST7789* tft = nullptr;
 static int8_t _bl_pin = -1;
+static int8_t _dc_pin = -1;
+
+// DMA state
+static spi_device_handle_t spi_dev = nullptr;
+static TaskHandle_t push_task = nullptr;
+static uint16_t* chunk_buf[2] = {nullptr, nullptr}; // Ping-pong line buffers
+static spi_transaction_t chunk_trans[2];
+static volatile bool frame_in_flight = false;
+static st7789_frame_done_cb_t frame_done_cb = nullptr;
+
+// Palette with every entry already byte-swapped for the panel
+static uint16_t palette_lut[256];
+
+// The frame currently owned by the push task
+static const uint8_t* job_buffer = nullptr;
+static int16_t job_stride = 0;
+static int16_t job_origin_y = 0;
+static DisplayRect job_rects[ST7789_MAX_RECTS];
+static uint8_t job_rect_count = 0;
+static st7789_pixel_source_t job_source = nullptr; // Set instead of job_buffer
+static void* job_source_ctx = nullptr;
+
+// Runs before every SPI transaction to drive the D/C line: t->user is 0 for
+// command bytes and 1 for parameter/pixel data.
+static void IRAM_ATTR st7789_spi_pre_cb(spi_transaction_t* t) {
+    gpio_set_level((gpio_num_t)_dc_pin, (uint32_t)(uintptr_t)t->user);
+}
+
+static void st7789_send_command(uint8_t cmd, const uint8_t* data, uint8_t len) {
+    spi_transaction_t t = {};
+    t.flags = SPI_TRANS_USE_TXDATA;
+    t.length = 8;
+    t.tx_data[0] = cmd;
+    t.user = (void*)0;
+    spi_device_polling_transmit(spi_dev, &t);
+
+    if (len > 0) {
+        spi_transaction_t d = {};
+        d.length = len * 8;
+        d.tx_buffer = data;
+        d.user = (void*)1;
+        spi_device_polling_transmit(spi_dev, &d);
+    }
+}
+
+static void st7789_set_window(int16_t x, int16_t y, int16_t w, int16_t h) {
+    uint16_t x1 = x + w - 1;
+    uint16_t y1 = y + h - 1;
+    uint8_t caset[4] = {(uint8_t)(x >> 8), (uint8_t)x, (uint8_t)(x1 >> 8), (uint8_t)x1};
+    uint8_t raset[4] = {(uint8_t)(y >> 8), (uint8_t)y, (uint8_t)(y1 >> 8), (uint8_t)y1};
+    st7789_send_command(ST7789_CASET, caset, 4);
+    st7789_send_command(ST7789_RASET, raset, 4);
+    st7789_send_command(ST7789_RAMWR, nullptr, 0);
+}
+
+// Expands palette indices to big-endian RGB565, four pixels per load. This
+// runs once per pixel sent, so it has to keep ahead of the SPI clock.
+static void IRAM_ATTR st7789_expand_line(uint16_t* dst, const uint8_t* src, int n) {
+    const uint16_t* lut = palette_lut;
+    while (n > 0 && ((uintptr_t)src & 3)) {
+        *dst++ = lut[*src++];
+        n--;
+    }
+    if (((uintptr_t)dst & 3) == 0) {
+        const uint32_t* s4 = (const uint32_t*)src;
+        uint32_t* d2 = (uint32_t*)dst;
+        for (; n >= 4; n -= 4) {
+            uint32_t q = *s4++;
+            d2[0] = lut[q & 0xFF] | ((uint32_t)lut[(q >> 8) & 0xFF] << 16);
+            d2[1] = lut[(q >> 16) & 0xFF] | ((uint32_t)lut[q >> 24] << 16);
+            d2 += 2;
+        }
+        src = (const uint8_t*)s4;
+        dst = (uint16_t*)d2;
+    }
+    while (n-- > 0) {
+        *dst++ = lut[*src++];
+    }
+}
+
+// Streams one window of the current job through the two line buffers: while
+// one buffer is being clocked out by DMA the other is filled with the next
+// lines, expanded from the job buffer or taken from the job's pixel source.
+static void st7789_stream_rect(const DisplayRect& r) {
+    st7789_set_window(r.x, r.y, r.w, r.h);
+
+    const int rows_per_chunk = ST7789_CHUNK_PIXELS / r.w;
+    int queued = 0;
+    int slot = 0;
+    for (int row = 0; row < r.h; row += rows_per_chunk) {
+        int rows = (r.h - row < rows_per_chunk) ? r.h - row : rows_per_chunk;
+
+        if (queued == 2) {
+            spi_transaction_t* done;
+            spi_device_get_trans_result(spi_dev, &done, portMAX_DELAY);
+            queued--;
+        }
+
+        uint16_t* dst = chunk_buf[slot];
+        if (job_source) {
+            int n = rows * r.w;
+            job_source(dst, n, job_source_ctx);
+            for (int i = 0; i < n; i++) {
+                dst[i] = __builtin_bswap16(dst[i]);
+            }
+        } else {
+            for (int j = 0; j < rows; j++) {
+                st7789_expand_line(dst, job_buffer + (size_t)(r.y - job_origin_y + row + j) * job_stride + r.x, r.w);
+                dst += r.w;
+            }
+        }
+
+        spi_transaction_t* t = &chunk_trans[slot];
+        *t = {};
+        t->length = (size_t)rows * r.w * 16;
+        t->tx_buffer = chunk_buf[slot];
+        t->user = (void*)1;
+        spi_device_queue_trans(spi_dev, t, portMAX_DELAY);
+        queued++;
+        slot ^= 1;
+    }
+
+    // Drain the queue so the next window's commands can use polling mode
+    while (queued > 0) {
+        spi_transaction_t* done;
+        spi_device_get_trans_result(spi_dev, &done, portMAX_DELAY);
+        queued--;
+    }
+}
+
+static void st7789_push_task(void* arg) {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        for (uint8_t i = 0; i < job_rect_count; i++) {
+            st7789_stream_rect(job_rects[i]);
+        }
+        frame_in_flight = false;
+        if (frame_done_cb) {
+            frame_done_cb();
+        }
+    }
+}
+
+// Undoes a st7789_start_dma() that failed part way: removes the device,
+// frees the IDF bus if it was taken, hands the pins back to the Arduino
+// driver if it was ended, and frees the line buffers, so the blocking
+// pushes get a working SPIClass
+static void st7789_abort_dma(SPIClass* spi_bus, bool bus_ended, bool bus_initialized) {
+    if (spi_dev) {
+        spi_bus_remove_device(spi_dev);
+        spi_dev = nullptr;
+    }
+    if (bus_initialized) {
+        spi_bus_free(ST7789_SPI_HOST);
+    }
+    if (bus_ended) {
+        spi_bus->begin();
+    }
+    for (int i = 0; i < 2; i++) {
+        heap_caps_free(chunk_buf[i]);
+        chunk_buf[i] = nullptr;
+    }
+    push_task = nullptr;
+}
+
+// Hands the SPI bus over from the Arduino driver to the ESP-IDF SPI master
+// and starts the push task. Returns false if DMA could not be set up, in
+// which case everything is released again and pushes fall back to the
+// blocking Adafruit path.
+static bool st7789_start_dma(int8_t cs_pin, SPIClass* spi_bus) {
+    chunk_buf[0] = (uint16_t*)heap_caps_malloc(ST7789_CHUNK_PIXELS * sizeof(uint16_t), MALLOC_CAP_DMA);
+    chunk_buf[1] = (uint16_t*)heap_caps_malloc(ST7789_CHUNK_PIXELS * sizeof(uint16_t), MALLOC_CAP_DMA);
+    if (!chunk_buf[0] || !chunk_buf[1]) {
+        Serial.println("ST7789: failed to allocate DMA line buffers");
+        st7789_abort_dma(spi_bus, false, false);
+        return false;
+    }
+
+    spi_bus->end();
+
+    spi_bus_config_t buscfg = {};
+    buscfg.mosi_io_num = MOSI;
+    buscfg.miso_io_num = -1;
+    buscfg.sclk_io_num = SCK;
+    buscfg.quadwp_io_num = -1;
+    buscfg.quadhd_io_num = -1;
+    buscfg.max_transfer_sz = ST7789_CHUNK_PIXELS * sizeof(uint16_t);
+    esp_err_t err = spi_bus_initialize(ST7789_SPI_HOST, &buscfg, SPI_DMA_CH_AUTO);
+    if (err != ESP_OK) {
+        Serial.printf("ST7789: spi_bus_initialize failed (%s)\n", esp_err_to_name(err));
+        st7789_abort_dma(spi_bus, true, false);
+        return false;
+    }
+
+    spi_device_interface_config_t devcfg = {};
+    devcfg.mode = 0;
+    devcfg.clock_speed_hz = ST7789_SPI_CLOCK_HZ;
+    devcfg.spics_io_num = cs_pin;
+    devcfg.queue_size = 2;
+    devcfg.pre_cb = st7789_spi_pre_cb;
+    err = spi_bus_add_device(ST7789_SPI_HOST, &devcfg, &spi_dev);
+    if (err != ESP_OK) {
+        Serial.printf("ST7789: spi_bus_add_device failed (%s)\n", esp_err_to_name(err));
+        spi_dev = nullptr;
+        st7789_abort_dma(spi_bus, true, true);
+        return false;
+    }
+
+    if (xTaskCreate(st7789_push_task, "st7789_push", 3072, nullptr, ST7789_PUSH_TASK_PRIO, &push_task) != pdPASS) {
+        Serial.println("ST7789: failed to start push task");
+        st7789_abort_dma(spi_bus, true, true);
+        return false;
+    }
+    return true;
+}
 
 // Initialize the display
 void st7789_init_display(int8_t dc_pin, int8_t cs_pin, int8_t rst_pin, int8_t bl_pin, SPIClass* spi_bus) {
@@ -12,21 +245,112 @@ void st7789_init_display(int8_t dc_pin, int8_t cs_pin, int8_t rst_pin, int8_t bl
     }
     tft = new Adafruit_ST7789(spi_bus, cs_pin, dc_pin, rst_pin);
     _bl_pin = bl_pin;
+    _dc_pin = dc_pin;
 
     tft->init(240, 320); // Initialize with ST7789 chip resolution
     tft->setRotation(1); // Set rotation for 320x240 display
     tft->fillScreen(ST77XX_BLACK);
 
+    if (!push_task && !st7789_start_dma(cs_pin, spi_bus)) {
+        Serial.println("ST7789: DMA unavailable, using blocking pushes");
+    }
+
     if (_bl_pin >= 0) {
         pinMode(_bl_pin, OUTPUT);
         digitalWrite(_bl_pin, HIGH); // Turn backlight on
     }
 }
 
-// Push the canvas buffer to the display
-void st7789_push_canvas(const uint16_t* buffer, int16_t w, int16_t h) {
-    if (!tft) return;
-    tft->drawRGBBitmap(0, 0, (uint16_t*)buffer, w, h);
+// Queue the canvas buffer for DMA transfer and return immediately
+bool st7789_push_canvas_async(const uint8_t* buffer, int16_t w, int16_t h) {
+    DisplayRect full = {0, 0, w, h};
+    return st7789_push_canvas_rects_async(buffer, w, 0, &full, 1);
+}
+
+bool st7789_push_canvas_rects_async(const uint8_t* buffer, int16_t stride, int16_t origin_y, const DisplayRect* rects, uint8_t count) {
+    if (!tft) return false;
+    if (count > ST7789_MAX_RECTS) count = ST7789_MAX_RECTS;
+
+    if (!push_task) {
+        uint16_t line[ST7789_CHUNK_PIXELS / 2]; // One display line
+        for (uint8_t i = 0; i < count; i++) {
+            const DisplayRect& r = rects[i];
+            for (int16_t row = 0; row < r.h; row++) {
+                const uint8_t* src = buffer + (size_t)(r.y - origin_y + row) * stride + r.x;
+                for (int16_t x = 0; x < r.w; x++) {
+                    line[x] = __builtin_bswap16(palette_lut[src[x]]);
+                }
+                tft->drawRGBBitmap(r.x, r.y + row, line, r.w, 1);
+            }
+        }
+        if (frame_done_cb) frame_done_cb();
+        return true;
+    }
+
+    if (frame_in_flight) return false;
+
+    job_buffer = buffer;
+    job_source = nullptr;
+    job_stride = stride;
+    job_origin_y = origin_y;
+    memcpy(job_rects, rects, count * sizeof(DisplayRect));
+    job_rect_count = count;
+    frame_in_flight = true;
+    xTaskNotifyGive(push_task);
+    return true;
+}
+
+bool st7789_push_pixels_async(const DisplayRect& rect, st7789_pixel_source_t source, void* ctx) {
+    if (!tft) return false;
+
+    if (!push_task) {
+        uint16_t line[ST7789_CHUNK_PIXELS / 2]; // One display line
+        for (int16_t row = 0; row < rect.h; row++) {
+            source(line, rect.w, ctx);
+            tft->drawRGBBitmap(rect.x, rect.y + row, line, rect.w, 1);
+        }
+        if (frame_done_cb) frame_done_cb();
+        return true;
+    }
+
+    if (frame_in_flight) return false;
+
+    job_buffer = nullptr;
+    job_source = source;
+    job_source_ctx = ctx;
+    job_rects[0] = rect;
+    job_rect_count = 1;
+    frame_in_flight = true;
+    xTaskNotifyGive(push_task);
+    return true;
+}
+
+bool st7789_frame_in_flight() {
+    return frame_in_flight;
+}
+
+void st7789_wait_for_frame() {
+    while (frame_in_flight) {
+        vTaskDelay(1);
+    }
+}
+
+void st7789_set_palette(const uint16_t* palette) {
+    for (int i = 0; i < 256; i++) {
+        palette_lut[i] = __builtin_bswap16(palette[i]);
+    }
+}
+
+void st7789_set_frame_done_callback(st7789_frame_done_cb_t cb) {
+    frame_done_cb = cb;
+}
+
+// Push the canvas buffer to the display and wait for the transfer to finish
+void st7789_push_canvas(const uint8_t* buffer, int16_t w, int16_t h) {
+    st7789_wait_for_frame();
+    if (st7789_push_canvas_async(buffer, w, h)) {
+        st7789_wait_for_frame();
+    }
 }
 
 // Control backlight
@@ -3,10 +3,41 @@
 
 #include <Adafruit_ST7789.h>
 
+#define ST7789_MAX_RECTS 16
 
+// A window on the panel, in display coordinates
+struct DisplayRect {
+    int16_t x, y, w, h;
+};
+
+// Called from the push task once the last pixel of a frame has left the SPI bus.
+typedef void (*st7789_frame_done_cb_t)(void);
 
 void st7789_init_display(int8_t dc_pin, int8_t cs_pin, int8_t rst_pin, int8_t bl_pin, SPIClass* spi_bus);
-void st7789_push_canvas(const uint16_t* buffer, int16_t w, int16_t h);
+void st7789_push_canvas(const uint8_t* buffer, int16_t w, int16_t h);
 void st7789_set_backlight(bool on);
 
+// Pushed buffers hold 8-bit palette indices; each is expanded to RGB565
+// through this 256-entry table while streaming. Takes effect from the next
+// push, so a frame already in flight keeps its colours.
+void st7789_set_palette(const uint16_t* palette);
+
+// Asynchronous frame push. The buffer is streamed out over SPI DMA by a
+// background task and must not be modified until st7789_frame_in_flight()
+// returns false. Returns false if a previous frame is still being sent.
+bool st7789_push_canvas_async(const uint8_t* buffer, int16_t w, int16_t h);
+// Partial update: only the given windows are sent, each through its own
+// ST7789 address window. The buffer holds display rows from origin_y onwards
+// (row stride in pixels), so a band buffer can be pushed in place.
+bool st7789_push_canvas_rects_async(const uint8_t* buffer, int16_t stride, int16_t origin_y, const DisplayRect* rects, uint8_t count);
+// Fills one window from a pixel source instead of a buffer, e.g. an image
+// decoded on the fly. The source is called from the push task with
+// consecutive runs of native RGB565 pixels in row-major order; it and ctx
+// must stay valid until st7789_frame_in_flight() returns false.
+typedef void (*st7789_pixel_source_t)(uint16_t* dst, int n, void* ctx);
+bool st7789_push_pixels_async(const DisplayRect& rect, st7789_pixel_source_t source, void* ctx);
+bool st7789_frame_in_flight();
+void st7789_wait_for_frame();
+void st7789_set_frame_done_callback(st7789_frame_done_cb_t cb);
+
 #endif // ST7789_DMA_DRIVER_H
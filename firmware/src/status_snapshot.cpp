@@ -0,0 +1,94 @@
+#include "status_snapshot.h"
+#include "web_server.h"
+#include "config_manager.h"
+#include "pump_protection.h"
+#include <ArduinoJson.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+// The state that is shown at once rather than on the next periodic build
+struct StatusSignature {
+    uint32_t relays; // Bit per relay
+    int operation;
+    int zone;
+    int cycle;
+    int cycle_zone;
+    int delay;
+    uint32_t config_revision;
+    uint32_t trips;
+    int tripped;
+};
+
+static SemaphoreHandle_t snapshot_mutex = nullptr; // Guards latest
+static std::shared_ptr<const StatusSnapshot> latest;
+static uint32_t version = 0;
+
+// Loop state
+static StatusSignature published;
+static unsigned long last_build = 0;
+
+static StatusSignature current_signature() {
+    StatusSignature signature;
+    signature.relays = 0;
+    for (int i = 0; i < NUM_RELAYS; i++) {
+        if (relayStates[i]) signature.relays |= 1UL << i;
+    }
+    signature.operation = currentOperation;
+    signature.zone = currentRunningZone;
+    signature.cycle = currentRunningCycle;
+    signature.cycle_zone = currentCycleZoneIndex;
+    signature.delay = inInterZoneDelay;
+    signature.config_revision = configRevision;
+    signature.trips = pump_protection_trip_count();
+    signature.tripped = pump_protection_tripped();
+    return signature;
+}
+
+static void publish() {
+    static StaticJsonDocument<STATUS_JSON_SIZE> doc;
+    doc.clear();
+    buildStatus(doc);
+
+    size_t length = measureJson(doc);
+    StatusSnapshot* snapshot = (StatusSnapshot*)malloc(sizeof(StatusSnapshot) + length + 1);
+    if (!snapshot) return; // Requests keep getting the previous one
+    serializeJson(doc, snapshot->json, length + 1);
+    snapshot->version = ++version;
+    snapshot->built_ms = millis();
+    snapshot->length = length;
+
+    std::shared_ptr<const StatusSnapshot> next(snapshot, free);
+    xSemaphoreTake(snapshot_mutex, portMAX_DELAY);
+    latest.swap(next);
+    xSemaphoreGive(snapshot_mutex);
+    // `next` now holds the previous snapshot, freed here unless a response
+    // is still sending it
+}
+
+void status_snapshot_init() {
+    if (snapshot_mutex) return;
+    snapshot_mutex = xSemaphoreCreateMutex();
+    published = current_signature();
+    last_build = millis();
+    publish();
+}
+
+void status_snapshot_handle() {
+    if (!snapshot_mutex) return;
+    StatusSignature signature = current_signature();
+    if (memcmp(&signature, &published, sizeof(signature)) == 0 &&
+        millis() - last_build < STATUS_SNAPSHOT_INTERVAL_MS) {
+        return;
+    }
+    published = signature;
+    last_build = millis();
+    publish();
+}
+
+std::shared_ptr<const StatusSnapshot> status_snapshot_latest() {
+    if (!snapshot_mutex) return nullptr;
+    xSemaphoreTake(snapshot_mutex, portMAX_DELAY);
+    std::shared_ptr<const StatusSnapshot> snapshot = latest;
+    xSemaphoreGive(snapshot_mutex);
+    return snapshot;
+}
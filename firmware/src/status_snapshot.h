@@ -0,0 +1,33 @@
+#ifndef STATUS_SNAPSHOT_H
+#define STATUS_SNAPSHOT_H
+
+#include <Arduino.h>
+#include <memory>
+
+// The /api/status response, built by the loop and shared by every request.
+// It is rebuilt as soon as what it shows of the relays, the operation, the
+// config revision or the pump protection changes, and otherwise once a
+// second for the clock and timers. A published snapshot is never changed:
+// a request keeps its reference until the response has been sent, while
+// newer snapshots replace it for later requests.
+#define STATUS_SNAPSHOT_INTERVAL_MS 1000
+
+struct StatusSnapshot {
+  uint32_t version;  // Snapshots published since boot
+  uint32_t built_ms; // millis() when it was built
+  size_t length;
+  char json[];       // `length` bytes, then a terminator
+};
+
+// Builds the first snapshot. Call once the configuration is loaded.
+void status_snapshot_init();
+
+// Rebuilds the snapshot when it is due. Call from the loop, which owns the
+// state it is built from.
+void status_snapshot_handle();
+
+// The newest snapshot; null before status_snapshot_init(). Safe from any
+// task.
+std::shared_ptr<const StatusSnapshot> status_snapshot_latest();
+
+#endif // STATUS_SNAPSHOT_H
@@ -4,24 +4,22 @@
 #include "wifi_manager.h" // For wifi_manager_get_rssi()
 #include <Arduino.h>
 
+// Number of filled bars the WiFi icon shows for this signal strength
+static int wifiSignalBars(int8_t rssi) {
+    if (!wifi_manager_is_connected()) return 0;
+    if (rssi >= -60) return 4;
+    if (rssi >= -70) return 3;
+    if (rssi >= -80) return 2;
+    return 1; // rssi < -80 but connected
+}
+
 // Function to draw the WiFi signal strength icon
 void drawWifiIcon(CustomCanvas& canvas, int x, int y, int8_t rssi) {
     const int barHeightMax = 12;
     const int barWidth = 3;
     const int barSpacing = 2;
 
-    int num_filled_bars = 0;
-    if (wifi_manager_is_connected()) {
-        if (rssi >= -60) {
-            num_filled_bars = 4;
-        } else if (rssi >= -70) {
-            num_filled_bars = 3;
-        } else if (rssi >= -80) {
-            num_filled_bars = 2;
-        } else { // rssi < -80 but connected
-            num_filled_bars = 1;
-        }
-    }
+    int num_filled_bars = wifiSignalBars(rssi);
 
     // Draw 4 bars for the icon
     for (int i = 0; i < 4; i++) {
@@ -43,6 +41,13 @@ void drawWifiIcon(CustomCanvas& canvas, int x, int y, int8_t rssi) {
     }
 }
 
+// Battery icon fill colour for a charge level
+static uint16_t batteryFillColor(int level) {
+    if (level > 50) return COLOR_SUCCESS;
+    if (level > 20) return COLOR_WARNING;
+    return COLOR_ERROR;
+}
+
 // Function to draw the battery icon
 void drawBatteryIcon(CustomCanvas& canvas, int x, int y, int level) {
     const int iconWidth = 22;
@@ -54,14 +59,7 @@ void drawBatteryIcon(CustomCanvas& canvas, int x, int y, int level) {
     canvas.drawRect(x, y, iconWidth, iconHeight, COLOR_TEXT_SECONDARY);
     canvas.fillRect(x + iconWidth, y + (iconHeight / 2) - (terminalHeight / 2), terminalWidth, terminalHeight, COLOR_TEXT_SECONDARY);
 
-    uint16_t fillColor;
-    if (level > 50) {
-        fillColor = COLOR_SUCCESS;
-    } else if (level > 20) {
-        fillColor = COLOR_WARNING;
-    } else {
-        fillColor = COLOR_ERROR;
-    }
+    uint16_t fillColor = batteryFillColor(level);
 
     int levelWidth = (level * (iconWidth - 2 * borderWidth)) / 100;
     if (levelWidth > 0) {
@@ -69,7 +67,34 @@ void drawBatteryIcon(CustomCanvas& canvas, int x, int y, int level) {
     }
 }
 
-void drawHeader(CustomCanvas& canvas, int x, int y, const SystemDateTime& dt, DayOfWeek dow, String ipAddress, int batteryLevel, int8_t rssi) {
+// FNV-1a step for building the header key
+static uint32_t hashField(uint32_t h, uint32_t v) {
+    for (int i = 0; i < 4; i++, v >>= 8) {
+        h = (h ^ (v & 0xFF)) * 16777619u;
+    }
+    return h;
+}
+
+void drawHeader(CustomCanvas& canvas, int x, int y, const SystemDateTime& dt, DayOfWeek dow, uint32_t ipAddress, int batteryLevel, int8_t rssi) {
+    // The header only changes when something it shows changes: the minute,
+    // the IP, the battery icon's fill (one step per pixel) or the WiFi bars.
+    uint32_t key = 2166136261u;
+    key = hashField(key, x | (y << 16));
+    key = hashField(key, (dt.year << 16) | (dt.month << 8) | dt.day);
+    key = hashField(key, (dt.hour << 16) | (dt.minute << 8) | dow);
+    key = hashField(key, ipAddress);
+    key = hashField(key, ((batteryLevel / 5) << 16) | batteryFillColor(batteryLevel));
+    key = hashField(key, wifiSignalBars(rssi));
+
+    if (canvas.reuseLayer(0, HEADER_HEIGHT, key)) {
+        // Leave the text state as drawing would have; some screens carry on
+        // printing below the header.
+        canvas.setTextSize(1);
+        canvas.setTextColor(COLOR_TEXT_SECONDARY);
+        canvas.setCursor(0, y + 20 + 8);
+        return;
+    }
+
     canvas.setCursor(x, y);
     canvas.setTextColor(COLOR_DATETIME_TEXT);
     canvas.setTextSize(2);
@@ -94,7 +119,13 @@ void drawHeader(CustomCanvas& canvas, int x, int y, const SystemDateTime& dt, Da
     canvas.setTextSize(1);
     canvas.setCursor(x, y + 20);
     canvas.setTextColor(COLOR_TEXT_SECONDARY);
-    canvas.println(ipAddress);
+    if (ipAddress != 0) {
+        snprintf(buf, sizeof(buf), "%u.%u.%u.%u", (unsigned)(ipAddress & 0xFF), (unsigned)((ipAddress >> 8) & 0xFF),
+                 (unsigned)((ipAddress >> 16) & 0xFF), (unsigned)(ipAddress >> 24));
+        canvas.println(buf);
+    } else {
+        canvas.println("---.---.---.---");
+    }
 
     drawBatteryIcon(canvas, SCREEN_WIDTH - 33, y , batteryLevel);
     drawWifiIcon(canvas, SCREEN_WIDTH - 60, y , rssi);
@@ -115,7 +146,11 @@ void setupScrollableListMetrics(ScrollableList& list, CustomCanvas& canvas) {
     list.top_visible_index = 0;
 }
 
-// Helper function to draw a scrollable list
+// Helper function to draw a scrollable list.
+// Scrolling is redrawn in software: the ST7789 scroll area (VSCRDEF/VSCRSADD)
+// runs along the panel's 320-line axis, which is horizontal in rotation 1.
+// Moving the selection within the view only changes the two highlighted
+// rows, and damage tracking sends just those.
 void drawScrollableList(CustomCanvas& canvas, ScrollableList& list, bool is_active) {
     canvas.fillRect(list.x, list.y, list.width, list.height, COLOR_LIST_BACKGROUND);
 
@@ -143,11 +178,17 @@ void drawScrollableList(CustomCanvas& canvas, ScrollableList& list, bool is_acti
 
     canvas.setTextSize(list.item_text_size);
 
+    // Item text starts 5px down and can overhang the row by a pixel
+    int item_span = max(list.item_render_height, 5 + 8 * list.item_text_size);
+
     for (int i = 0; i < list.max_items_in_view; i++) {
         int current_item_index = list.top_visible_index + i;
         if (current_item_index >= total_items) break;
 
         int yPos = list.list_items_area_y + (i * list.item_render_height);
+        // The list is replayed once per display band; rows outside this
+        // band would be clipped anyway.
+        if (!canvas.bandIntersects(yPos, item_span)) continue;
         
         if (is_active && current_item_index == *list.selected_index_ptr) {
             canvas.fillRect(list.x, yPos, list.width, list.item_render_height, list.selected_bg_color);
@@ -95,8 +95,10 @@ void setupScrollableListMetrics(ScrollableList& list, CustomCanvas& canvas);
 void drawScrollableList(CustomCanvas& canvas, ScrollableList& list, bool is_active);
 void handleScrollableListInput(ScrollableList& list, long encoder_diff);
 
-// Header Display Component
-void drawHeader(CustomCanvas& canvas, int x, int y, const SystemDateTime& dt, DayOfWeek dow, String ipAddress, int batteryLevel, int8_t rssi);
+// Header Display Component. Kept on the panel as a retained layer and only
+// redrawn when the minute, IP, battery or WiFi bucket changes.
+// ipAddress is as returned by wifi_manager_get_ip_raw() (0 = not connected).
+void drawHeader(CustomCanvas& canvas, int x, int y, const SystemDateTime& dt, DayOfWeek dow, uint32_t ipAddress, int batteryLevel, int8_t rssi);
 void drawWifiIcon(CustomCanvas& canvas, int x, int y, int8_t rssi);
 
 // General UI Helpers
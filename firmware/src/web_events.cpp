@@ -0,0 +1,157 @@
+#include "web_events.h"
+#include "web_server.h"
+#include "config_manager.h"
+#include "wifi_manager.h"
+#include "current_sensor.h"
+#include <ArduinoJson.h>
+
+static AsyncEventSource events("/api/events");
+static uint32_t event_id = 0;
+
+// What was last sent, or would have been had a client been connected
+static bool sent_valid = false;
+static uint32_t sent_relays = 0; // Bit per relay
+static ActiveOperationType sent_operation;
+static int sent_zone, sent_cycle, sent_cycle_zone;
+static bool sent_delay;
+static int sent_battery;
+static int sent_rssi;
+static uint32_t sent_config_revision;
+static int64_t sent_history_ts;
+
+static void send_event(const char* name, const JsonDocument& doc) {
+    char buffer[1024];
+    if (measureJson(doc) >= sizeof(buffer)) return;
+    serializeJson(doc, buffer, sizeof(buffer));
+    events.send(buffer, name, ++event_id);
+}
+
+static uint32_t relay_bits() {
+    uint32_t bits = 0;
+    for (int i = 0; i < NUM_RELAYS; i++) {
+        if (relayStates[i]) bits |= 1UL << i;
+    }
+    return bits;
+}
+
+static void publish_relays(bool clients) {
+    uint32_t bits = relay_bits();
+    uint32_t changed = bits ^ sent_relays;
+    sent_relays = bits;
+    if (!clients) return;
+
+    for (int i = 0; i < NUM_RELAYS; i++) {
+        if (!(changed & (1UL << i))) continue;
+        StaticJsonDocument<64> doc;
+        doc["index"] = i;
+        doc["state"] = relayStates[i];
+        send_event("relay", doc);
+    }
+}
+
+static void publish_operation(bool clients) {
+    if (currentOperation == sent_operation && currentRunningZone == sent_zone &&
+        currentRunningCycle == sent_cycle && currentCycleZoneIndex == sent_cycle_zone &&
+        inInterZoneDelay == sent_delay) {
+        return;
+    }
+    sent_operation = currentOperation;
+    sent_zone = currentRunningZone;
+    sent_cycle = currentRunningCycle;
+    sent_cycle_zone = currentCycleZoneIndex;
+    sent_delay = inInterZoneDelay;
+    if (!clients) return;
+
+    StaticJsonDocument<512> doc;
+    addRunningInfo(doc.to<JsonObject>());
+    doc["currentOperation"] = currentOperation;
+    send_event("operation", doc);
+}
+
+static void publish_device(bool clients) {
+    int rssi = wifi_manager_get_rssi();
+    if (batteryLevel == sent_battery && abs(rssi - sent_rssi) < WEB_EVENTS_RSSI_STEP) return;
+    sent_battery = batteryLevel;
+    sent_rssi = rssi;
+    if (!clients) return;
+
+    StaticJsonDocument<64> doc;
+    doc["batteryLevel"] = batteryLevel;
+    doc["wifiRSSI"] = rssi;
+    send_event("device", doc);
+}
+
+static void publish_config(bool clients) {
+    if (configRevision == sent_config_revision) return;
+    sent_config_revision = configRevision;
+    if (!clients) return;
+
+    StaticJsonDocument<64> doc;
+    doc["revision"] = configRevision;
+    send_event("config", doc);
+}
+
+// New history points, WEB_EVENTS_MAX_POINTS to an event
+static void publish_current(bool clients) {
+    const CurrentHistory& history = get_current_history();
+    int64_t newest = history.newestTimestamp();
+    if (history.empty() || newest <= sent_history_ts) return;
+    if (!clients) {
+        sent_history_ts = newest;
+        return;
+    }
+
+    bool done = false;
+    while (!done) {
+        StaticJsonDocument<JSON_ARRAY_SIZE(WEB_EVENTS_MAX_POINTS) + WEB_EVENTS_MAX_POINTS * JSON_OBJECT_SIZE(2)> doc;
+        JsonArray points = doc.to<JsonArray>();
+        uint32_t count = 0;
+        done = history.forEachSinceWhile(sent_history_ts, [&](int64_t timestamp, float current) {
+            if (count == WEB_EVENTS_MAX_POINTS) return false;
+            JsonObject point = points.createNestedObject();
+            point["timestamp"] = get_unix_time_ms_from_millis(timestamp);
+            point["current"] = current;
+            sent_history_ts = timestamp;
+            count++;
+            return true;
+        });
+        if (count > 0) send_event("current", doc);
+    }
+}
+
+void web_events_init(AsyncWebServer& server) {
+    events.onConnect([](AsyncEventSourceClient *client) {
+        // Sets how soon the browser reconnects after losing the stream
+        client->send("hello", NULL, 0, WEB_EVENTS_RECONNECT_MS);
+    });
+    server.addHandler(&events);
+}
+
+void web_events_handle() {
+    static unsigned long last_check = 0;
+    if (sent_valid && millis() - last_check < WEB_EVENTS_INTERVAL_MS) return;
+    last_check = millis();
+
+    if (!sent_valid) {
+        // Clients take their first state from /api/status
+        sent_relays = relay_bits();
+        sent_operation = currentOperation;
+        sent_zone = currentRunningZone;
+        sent_cycle = currentRunningCycle;
+        sent_cycle_zone = currentCycleZoneIndex;
+        sent_delay = inInterZoneDelay;
+        sent_battery = batteryLevel;
+        sent_rssi = wifi_manager_get_rssi();
+        sent_config_revision = configRevision;
+        sent_history_ts = get_current_history().empty() ? INT64_MIN : get_current_history().newestTimestamp();
+        sent_valid = true;
+        return;
+    }
+
+    bool clients = events.count() > 0;
+    publish_relays(clients);
+    publish_operation(clients);
+    publish_current(clients);
+    publish_device(clients);
+    publish_config(clients);
+}
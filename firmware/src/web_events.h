@@ -0,0 +1,31 @@
+#ifndef WEB_EVENTS_H
+#define WEB_EVENTS_H
+
+#include <ESPAsyncWebServer.h>
+
+// Server-Sent Events at /api/events, so open pages are told about changes
+// instead of polling /api/status and /api/current_history. Only what
+// changed is sent, as small JSON events:
+//
+//   relay      {"index": 2, "state": true}
+//   operation  /api/status's runningInfo plus "currentOperation"
+//   current    [{"timestamp": <unix ms>, "current": <A>}, ...], new points
+//   device     {"batteryLevel": 80, "wifiRSSI": -61}
+//   config     {"revision": 3}, after the zone names or a cycle were saved
+//
+// A client fetches /api/status once the stream opens and applies the
+// events to that; the elapsed time of a running operation is counted on
+// the client. Nothing is serialised while no client is connected.
+#define WEB_EVENTS_INTERVAL_MS   200 // How often the state is compared
+#define WEB_EVENTS_RECONNECT_MS  3000
+#define WEB_EVENTS_RSSI_STEP     5   // dB the RSSI must move to be sent
+#define WEB_EVENTS_MAX_POINTS    16  // History points per current event
+
+// Registers /api/events with the server. Call before server.begin().
+void web_events_init(AsyncWebServer& server);
+
+// Compares the state with what was last sent and sends the differences.
+// Call from the loop, which owns the state.
+void web_events_handle();
+
+#endif // WEB_EVENTS_H
@@ -3,6 +3,13 @@
 #include "wifi_manager.h"
 #include "battery.h"
 #include "current_sensor.h"
+#include "current_log.h"
+#include "zone_monitor.h"
+#include "pump_protection.h"
+#include "burst_capture.h"
+#include "spectrum.h"
+#include "web_events.h"
+#include "status_snapshot.h"
 #include <ESPAsyncWebServer.h>
 #include <ArduinoJson.h>
 #include "LittleFS.h"
@@ -10,6 +17,8 @@
 // Define the web server object
 AsyncWebServer server(80);
 
+#define CYCLES_JSON_SIZE 1024
+
 // All the HTML and JS is now served from LittleFS.
 // Create a 'data' folder in the root of your Arduino project,
 // and place your 'index.html', 'plot.html', 'plot.js', and any other
@@ -29,19 +38,55 @@ AsyncWebServer server(80);
 // as the C++ preprocessor won't replace it in a separate file.
 // You can get the zone count from the '/api/status' endpoint's 'relays' array length.
 
-String dayOfWeekToString(uint8_t days) {
-    String daysString = "";
-    if (days & 0b00000001) daysString += "Su,";
-    if (days & 0b00000010) daysString += "Mo,";
-    if (days & 0b00000100) daysString += "Tu,";
-    if (days & 0b00001000) daysString += "We,";
-    if (days & 0b00010000) daysString += "Th,";
-    if (days & 0b00100000) daysString += "Fr,";
-    if (days & 0b01000000) daysString += "Sa,";
-    if (daysString.length() > 0) {
-        daysString.remove(daysString.length() - 1); // Remove last comma
-    }
-    return daysString;
+void dayOfWeekToString(uint8_t days, char* buffer) {
+    static const char* const names[] = { "Su", "Mo", "Tu", "We", "Th", "Fr", "Sa" };
+    char* p = buffer;
+    for (int i = 0; i < 7; i++) {
+        if (!(days & (1 << i))) continue;
+        if (p != buffer) *p++ = ',';
+        *p++ = names[i][0];
+        *p++ = names[i][1];
+    }
+    *p = '\0';
+}
+
+// Serialises straight into the response's buffer, allocated once at the
+// document's exact size, instead of through a String that grows as it is
+// written and is then copied into the response
+static void sendJson(AsyncWebServerRequest *request, const JsonDocument& doc, const char* etag = nullptr) {
+    AsyncResponseStream *response = request->beginResponseStream("application/json", measureJson(doc));
+    if (etag) {
+        response->addHeader("ETag", etag);
+        response->addHeader("Cache-Control", "no-cache");
+    }
+    serializeJson(doc, *response);
+    request->send(response);
+}
+
+// Random on every boot. The stored revision can come back after a restart
+// with different contents (changes made in memory and never saved), so it
+// is only unique together with this.
+static uint32_t configEpoch = 0;
+
+// Responses built from the configuration carry the boot's epoch and the
+// revision as a strong ETag, and browsers revalidate them on every use.
+// Answers 304 and returns true when the client already has this revision,
+// before any JSON is built.
+static bool configNotModified(AsyncWebServerRequest *request, char* etag, size_t size) {
+    snprintf(etag, size, "\"%08lx-%lu\"", (unsigned long)configEpoch, (unsigned long)configRevision);
+    if (!request->hasHeader("If-None-Match") || request->getHeader("If-None-Match")->value() != etag) {
+        return false;
+    }
+    AsyncWebServerResponse *response = request->beginResponse(304);
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
+    return true;
+}
+
+// "12m 5s"
+static void formatMinutes(char* buffer, size_t size, unsigned long seconds) {
+    snprintf(buffer, size, "%lum %lus", seconds / 60, seconds % 60);
 }
 
 // handleRoot and handlePlot are no longer needed as files are served statically.
@@ -51,77 +96,50 @@ void handleNotFound(AsyncWebServerRequest *request) {
     request->send(404, "text/plain", "Not found");
 }
 
-void handleGetStatus(AsyncWebServerRequest *request) {
-    Serial.println("Handling get status request.");
-    StaticJsonDocument<1024> doc;
-    doc["firmwareVersion"] = "1.0";
-
-    JsonObject dateTimeObj = doc.createNestedObject("dateTime");
-    dateTimeObj["year"] = currentDateTime.year;
-    dateTimeObj["month"] = currentDateTime.month;
-    dateTimeObj["day"] = currentDateTime.day;
-    dateTimeObj["hour"] = currentDateTime.hour;
-    dateTimeObj["minute"] = currentDateTime.minute;
-    dateTimeObj["second"] = currentDateTime.second;
-    
-    doc["dayOfWeek"] = dayOfWeekToString(getCurrentDayOfWeek());
-    doc["batteryLevel"] = batteryLevel;
-    doc["wifiRSSI"] = wifi_manager_get_rssi();
-
-    JsonArray relayStatusArray = doc.createNestedArray("relays");
-    for (int i = 0; i < NUM_RELAYS; i++) {
-        JsonObject relayObj = relayStatusArray.createNestedObject();
-        if (i == 0) {
-            relayObj["name"] = "Pump";
-        } else {
-            relayObj["name"] = systemConfig.zoneNames[i-1];
-        }
-        relayObj["state"] = relayStates[i];
-    }
-    doc["currentOperation"] = currentOperation;
-
-    JsonObject runningInfo = doc.createNestedObject("runningInfo");
-    String operation_description = "Idle";
-    String time_elapsed_str = "";
-    String time_remaining_str = "";
+// Formatted fields are written through stack buffers rather than built up
+// as Strings. They are char arrays, which the document copies.
+void addRunningInfo(JsonObject runningInfo) {
+    char operation_description[96] = "Idle";
+    char time_elapsed_str[24] = "";
+    char time_remaining_str[24] = "";
     unsigned long elapsed_s = 0;
     unsigned long total_duration_s = 0;
 
     switch(currentOperation) {
         case OP_MANUAL_ZONE: {
-            operation_description = "Manual Zone Running: " + String(systemConfig.zoneNames[currentRunningZone-1]);
+            snprintf(operation_description, sizeof(operation_description), "Manual Zone Running: %s", systemConfig.zoneNames[currentRunningZone-1]);
             elapsed_s = (millis() - zoneStartTime) / 1000;
             total_duration_s = zoneDuration / 1000;
             unsigned long remaining_s = total_duration_s - elapsed_s;
-            time_elapsed_str = String(elapsed_s / 60) + "m " + String(elapsed_s % 60) + "s";
-            time_remaining_str = String(remaining_s / 60) + "m " + String(remaining_s % 60) + "s";
+            formatMinutes(time_elapsed_str, sizeof(time_elapsed_str), elapsed_s);
+            formatMinutes(time_remaining_str, sizeof(time_remaining_str), remaining_s);
             break;
         }
         case OP_MANUAL_CYCLE:
         case OP_SCHEDULED_CYCLE: {
             if (currentRunningCycle != -1) {
                 CycleConfig* cfg = cycles[currentRunningCycle];
-                operation_description = String(cfg->name) + ": Running";
+                snprintf(operation_description, sizeof(operation_description), "%s: Running", cfg->name);
                 if (inInterZoneDelay) {
                     elapsed_s = (millis() - cycleInterZoneDelayStartTime) / 1000;
                     total_duration_s = (unsigned long)cfg->interZoneDelay * 60;
                     unsigned long remaining_s = total_duration_s - elapsed_s;
-                    time_elapsed_str = String(elapsed_s / 60) + "m " + String(elapsed_s % 60) + "s";
-                    time_remaining_str = String(remaining_s / 60) + "m " + String(remaining_s % 60) + "s";
+                    formatMinutes(time_elapsed_str, sizeof(time_elapsed_str), elapsed_s);
+                    formatMinutes(time_remaining_str, sizeof(time_remaining_str), remaining_s);
                     runningInfo["is_delay"] = true; // Indicate it's a delay
                     // Add next zone info to description
                     if (currentCycleZoneIndex + 1 < ZONE_COUNT) { // Check if there's a next zone
-                        operation_description = String(cfg->name) + ": Delaying " + String(systemConfig.zoneNames[currentCycleZoneIndex + 1]) ;
+                        snprintf(operation_description, sizeof(operation_description), "%s: Delaying %s", cfg->name, systemConfig.zoneNames[currentCycleZoneIndex + 1]);
                     } else {
-                        operation_description = String(cfg->name) + ": Delaying Cycle end";
+                        snprintf(operation_description, sizeof(operation_description), "%s: Delaying Cycle end", cfg->name);
                     }
                 } else if (currentCycleZoneIndex < ZONE_COUNT) {
                     elapsed_s = (millis() - cycleZoneStartTime) / 1000;
                     total_duration_s = (unsigned long)cfg->zoneDurations[currentCycleZoneIndex] * 60;
                     unsigned long remaining_s = total_duration_s - elapsed_s;
-                    time_elapsed_str = String(elapsed_s / 60) + "m " + String(elapsed_s % 60) + "s";
-                    time_remaining_str = String(remaining_s / 60) + "m " + String(remaining_s % 60) + "s";
-                    operation_description = String(cfg->name) + ": Running " + String(systemConfig.zoneNames[currentCycleZoneIndex + 1]);
+                    formatMinutes(time_elapsed_str, sizeof(time_elapsed_str), elapsed_s);
+                    formatMinutes(time_remaining_str, sizeof(time_remaining_str), remaining_s);
+                    snprintf(operation_description, sizeof(operation_description), "%s: Running %s", cfg->name, systemConfig.zoneNames[currentCycleZoneIndex + 1]);
                     runningInfo["is_delay"] = false; // Indicate it's not a delay
 
                 }
@@ -139,51 +157,386 @@ void handleGetStatus(AsyncWebServerRequest *request) {
     runningInfo["time_remaining"] = time_remaining_str;
     runningInfo["elapsed_s"] = elapsed_s;
     runningInfo["total_duration_s"] = total_duration_s;
+}
+
+void buildStatus(JsonDocument& doc) {
+    doc["firmwareVersion"] = "1.0";
+
+    JsonObject dateTimeObj = doc.createNestedObject("dateTime");
+    dateTimeObj["year"] = currentDateTime.year;
+    dateTimeObj["month"] = currentDateTime.month;
+    dateTimeObj["day"] = currentDateTime.day;
+    dateTimeObj["hour"] = currentDateTime.hour;
+    dateTimeObj["minute"] = currentDateTime.minute;
+    dateTimeObj["second"] = currentDateTime.second;
+    
+    char days[DAYS_STRING_SIZE];
+    dayOfWeekToString(getCurrentDayOfWeek(), days);
+    doc["dayOfWeek"] = days;
+    doc["batteryLevel"] = batteryLevel;
+    doc["wifiRSSI"] = wifi_manager_get_rssi();
 
-    String output;
-    serializeJson(doc, output);
-    request->send(200, "application/json", output);
+    JsonArray relayStatusArray = doc.createNestedArray("relays");
+    for (int i = 0; i < NUM_RELAYS; i++) {
+        JsonObject relayObj = relayStatusArray.createNestedObject();
+        if (i == 0) {
+            relayObj["name"] = "Pump";
+        } else {
+            relayObj["name"] = systemConfig.zoneNames[i-1];
+        }
+        relayObj["state"] = relayStates[i];
+    }
+    doc["currentOperation"] = currentOperation;
+    doc["configRevision"] = configRevision; // In the ETag of /api/cycles and /api/zonenames
+
+    addRunningInfo(doc.createNestedObject("runningInfo"));
+
+    // Learned steady current per zone and recent anomalies, newest last
+    JsonArray baselineArray = doc.createNestedArray("zoneBaselines");
+    for (int zone = 1; zone <= ZONE_COUNT; zone++) {
+        const ZoneBaseline& baseline = zone_monitor_baseline(zone);
+        JsonObject baselineObj = baselineArray.createNestedObject();
+        baselineObj["samples"] = baseline.count;
+        baselineObj["mean"] = baseline.mean;
+        baselineObj["stddev"] = sqrtf(baseline.variance);
+    }
+
+    JsonArray anomalyArray = doc.createNestedArray("anomalies");
+    for (const ZoneEvent& event : zone_monitor_events()) {
+        JsonObject anomalyObj = anomalyArray.createNestedObject();
+        anomalyObj["timestamp"] = get_unix_time_ms_from_millis(event.timestamp);
+        anomalyObj["zone"] = systemConfig.zoneNames[event.zone - 1];
+        anomalyObj["type"] = zone_anomaly_name(event.type);
+        anomalyObj["current"] = event.current;
+        anomalyObj["expected"] = event.expected;
+    }
+
+    // Latched pump trip, or the last one once reset
+    PumpTripInfo trip = pump_protection_last_trip();
+    JsonObject protectionObj = doc.createNestedObject("protection");
+    protectionObj["tripped"] = pump_protection_tripped();
+    protectionObj["trips"] = pump_protection_trip_count();
+    if (trip.reason != PUMP_TRIP_NONE) {
+        protectionObj["reason"] = pump_trip_reason_name(trip.reason);
+        protectionObj["current"] = trip.current;
+        protectionObj["timestamp"] = get_unix_time_ms_from_millis(trip.timestamp);
+    }
+}
+
+void handleGetStatus(AsyncWebServerRequest *request) {
+    Serial.println("Handling get status request.");
+    std::shared_ptr<const StatusSnapshot> snapshot = status_snapshot_latest();
+    if (!snapshot) {
+        AsyncWebServerResponse *response = request->beginResponse(503, "application/json", "{\"success\":false, \"message\":\"Starting up\"}");
+        response->addHeader("Retry-After", "1");
+        request->send(response);
+        return;
+    }
+    // Copied out as the send buffer drains; the response holds its
+    // reference until then, however many newer snapshots are published
+    AsyncWebServerResponse *response = request->beginResponse("application/json", snapshot->length,
+        [snapshot](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+            size_t len = min(maxLen, snapshot->length - index);
+            memcpy(buffer, snapshot->json + index, len);
+            return len;
+        });
+    request->send(response);
 }
 
 void handleGetCurrent(AsyncWebServerRequest *request) {
     // No need to log this every few seconds
     // Serial.println("Handling get current request.");
-    StaticJsonDocument<64> doc;
+    StaticJsonDocument<128> doc;
     doc["current"] = read_wcs1800_current();
-    String output;
-    serializeJson(doc, output);
-    request->send(200, "application/json", output);
+    CurrentSensorStats stats;
+    if (read_wcs1800_stats(stats)) {
+        doc["mean"] = stats.mean;
+        doc["peak"] = stats.peak;
+        doc["crest"] = stats.crest;
+    }
+    sendJson(request, doc);
+}
+
+// Closed buckets of a rollup tier newer than `since`. "current" is the
+// bucket mean so clients can plot any tier the same way.
+static void sendCurrentRollup(AsyncWebServerRequest *request, CurrentHistoryTier tier, uint64_t since) {
+    const CurrentRollupHistory& buckets = get_current_rollup(tier);
+
+    size_t first = buckets.partitionPoint([since](const CurrentRollupEntry& entry) {
+        return get_unix_time_ms_from_millis((int64_t)entry.start_s * 1000) <= since;
+    });
+    size_t count = buckets.size() - first;
+
+    const size_t capacity = JSON_OBJECT_SIZE(2) + JSON_ARRAY_SIZE(count) + count * JSON_OBJECT_SIZE(4);
+    DynamicJsonDocument doc(capacity);
+
+    doc["period_s"] = get_current_rollup_period_s(tier);
+    JsonArray points = doc.createNestedArray("points");
+    for (size_t i = first; i < buckets.size(); i++) {
+        const CurrentRollupEntry& entry = buckets[i];
+        JsonObject obj = points.createNestedObject();
+        obj["timestamp"] = get_unix_time_ms_from_millis((int64_t)entry.start_s * 1000);
+        obj["current"] = entry.mean;
+        obj["min"] = entry.min;
+        obj["max"] = entry.max;
+    }
+
+    sendJson(request, doc);
+}
+
+// Raw history formats, picked with `format` or, for bin, the Accept header
+enum CurrentHistoryFormat {
+    HISTORY_FORMAT_JSON,   // [{"timestamp": <unix ms>, "current": <A>}, ...]
+    HISTORY_FORMAT_BIN,    // CurrentHistoryRecord after CurrentHistoryRecord
+    HISTORY_FORMAT_SERIES  // The compressed blocks themselves (series_codec.h)
+};
+
+// One point of format=bin, little endian with no padding
+struct __attribute__((packed)) CurrentHistoryRecord {
+    uint64_t timestamp; // Unix time in milliseconds
+    int16_t current;    // 1/SERIES_VALUE_SCALE A
+};
+
+static_assert(sizeof(CurrentHistoryRecord) == 10, "CurrentHistoryRecord must have no padding");
+
+// Where a streamed history response has got to. Points and blocks are
+// found again by timestamp on every call, so the ring may take new points
+// or drop its oldest block between calls.
+struct CurrentHistoryCursor {
+    CurrentHistoryFormat format;
+    int64_t since;    // History time of the last point or block written
+    uint32_t written; // Points or blocks written
+    bool opened;      // JSON: the opening bracket is out
+    bool finished;
+};
+
+// Formats one point of format=bin or JSON into `out`; returns its length
+static size_t formatHistoryPoint(const CurrentHistoryCursor& cursor, int64_t timestamp, float current, char* out,
+                                 size_t size) {
+    if (cursor.format == HISTORY_FORMAT_BIN) {
+        CurrentHistoryRecord record;
+        record.timestamp = get_unix_time_ms_from_millis(timestamp);
+        record.current = (int16_t)lroundf(current * SERIES_VALUE_SCALE);
+        memcpy(out, &record, sizeof(record));
+        return sizeof(record);
+    }
+    return snprintf(out, size, "%s{\"timestamp\":%llu,\"current\":%.2f}", cursor.written ? "," : "",
+                    (unsigned long long)get_unix_time_ms_from_millis(timestamp), current);
+}
+
+// Fills `buffer` with as many whole points or blocks as fit. Block times
+// are milliseconds since boot; X-Time-Offset carries the boot time.
+// This runs on the async TCP task while the loop adds to the history, so
+// every block is copied out under the history lock and read from the copy.
+static size_t fillCurrentHistory(CurrentHistoryCursor& cursor, uint8_t *buffer, size_t maxLen) {
+    // Stream callbacks run one at a time on the async TCP task, and the
+    // block is done with before returning, so one copy serves every response
+    static SeriesBlock block;
+    size_t len = 0;
+    bool done = false;
+    bool full = false;
+
+    if (cursor.finished) return 0;
+    if (cursor.format == HISTORY_FORMAT_JSON && !cursor.opened && len < maxLen) {
+        buffer[len++] = '[';
+        cursor.opened = true;
+    }
+
+    while (!full) {
+        if (!current_history_block_since(cursor.since, block)) {
+            done = true;
+            break;
+        }
+        if (cursor.format == HISTORY_FORMAT_SERIES) {
+            if (len + sizeof(block) > maxLen) break;
+            memcpy(buffer + len, &block, sizeof(block));
+            len += sizeof(block);
+            cursor.since = block.header.last_ts;
+            cursor.written++;
+            continue;
+        }
+
+        SeriesDecoder dec;
+        series_decoder_begin(dec, &block);
+        int64_t timestamp;
+        float current;
+        while (series_decoder_next(dec, timestamp, current)) {
+            if (timestamp <= cursor.since) continue;
+            char point[64];
+            size_t n = formatHistoryPoint(cursor, timestamp, current, point, sizeof(point));
+            if (len + n > maxLen) {
+                full = true;
+                break;
+            }
+            memcpy(buffer + len, point, n);
+            len += n;
+            cursor.since = timestamp;
+            cursor.written++;
+        }
+        // A block that stops decoding early is not asked for again
+        if (!full) cursor.since = block.header.last_ts;
+    }
+
+    if (cursor.format == HISTORY_FORMAT_JSON) {
+        if (done && len < maxLen) {
+            buffer[len++] = ']';
+        } else {
+            done = false;
+        }
+    }
+
+    cursor.finished = done;
+    // A point that did not fit in what is left of the send buffer is
+    // retried once the buffer drains; 0 ends the response
+    return len == 0 && !done ? RESPONSE_TRY_AGAIN : len;
+}
+
+// Streams the raw history newer than `since` (history time) with chunked
+// encoding. The send buffer is filled straight from the compressed blocks
+// as it drains, so memory use does not grow with the history.
+static void streamCurrentHistory(AsyncWebServerRequest *request, CurrentHistoryFormat format, int64_t since) {
+    CurrentHistoryCursor cursor = { format, since, 0, false, false };
+    AsyncWebServerResponse *response = request->beginChunkedResponse(
+        format == HISTORY_FORMAT_JSON ? "application/json" : "application/octet-stream",
+        [cursor](uint8_t *buffer, size_t maxLen, size_t) mutable -> size_t {
+            return fillCurrentHistory(cursor, buffer, maxLen);
+        });
+
+    if (format == HISTORY_FORMAT_SERIES) {
+        char offset[24];
+        snprintf(offset, sizeof(offset), "%llu", (unsigned long long)get_unix_time_ms_from_millis(0));
+        response->addHeader("X-Time-Offset", offset);
+    }
+    request->send(response);
+}
+
+// GET /api/capture[?id=<n>]
+// A burst capture of the current around relay switching (see
+// burst_capture.h): the header as is, then `count` samples. The newest
+// capture without `id`. X-Time-Offset is the Unix time of boot in
+// milliseconds, for the header's trigger_ms.
+void handleGetCapture(AsyncWebServerRequest *request) {
+    // Handlers run one at a time on the async TCP task, and the response
+    // stream copies what it is given, so one buffer serves every request
+    static BurstCapture capture;
+
+    uint32_t id = 0;
+    if (request->hasParam("id")) {
+        id = strtoul(request->getParam("id")->value().c_str(), NULL, 10);
+    }
+    if (!burst_capture_copy(id, capture)) {
+        request->send(404, "application/json", "{\"success\":false, \"message\":\"No such capture\"}");
+        return;
+    }
+
+    AsyncResponseStream *response = request->beginResponseStream("application/octet-stream");
+    char offset[24];
+    snprintf(offset, sizeof(offset), "%llu", (unsigned long long)get_unix_time_ms_from_millis(0));
+    response->addHeader("X-Time-Offset", offset);
+    response->write((const uint8_t*)&capture.header, sizeof(capture.header));
+    response->write((const uint8_t*)capture.samples, capture.header.count * sizeof(capture.samples[0]));
+    request->send(response);
+}
+
+// GET /api/spectrum
+// The last analysed window of the pump current (see spectrum.h): the
+// metrics and the RMS amplitude of every bin in mA, DC first
+void handleGetSpectrum(AsyncWebServerRequest *request) {
+    static SpectrumResult result; // Too big for the async TCP task's stack
+    if (!spectrum_latest(result)) {
+        request->send(404, "application/json", "{\"success\":false, \"message\":\"No spectrum yet\"}");
+        return;
+    }
+
+    const size_t bins = sizeof(result.amplitude_ma) / sizeof(result.amplitude_ma[0]);
+    DynamicJsonDocument doc(JSON_OBJECT_SIZE(9) + JSON_ARRAY_SIZE(bins));
+    doc["timestamp"] = get_unix_time_ms_from_millis(result.timestamp);
+    doc["zone"] = result.zone;
+    doc["binHz"] = spectrum_bin_dhz(SPECTRUM_SIZE) / (float)(SPECTRUM_SIZE * 10);
+    doc["f0"] = result.metrics.f0_dhz / 10.0f;
+    doc["thd"] = result.metrics.thd;
+    doc["h3"] = result.metrics.h3;
+    doc["sideband"] = result.metrics.sideband;
+    doc["noise"] = result.metrics.noise;
+    JsonArray amplitudes = doc.createNestedArray("amplitudes");
+    for (size_t k = 0; k < bins; k++) {
+        amplitudes.add(result.amplitude_ma[k]);
+    }
+
+    sendJson(request, doc);
 }
 
+// GET /api/spectrum/trend
+// Spectral metrics averaged over each recent zone run, oldest first, with
+// the ones that rose well above the zone's earlier runs flagged
+void handleGetSpectrumTrend(AsyncWebServerRequest *request) {
+    static SpectrumTrend trend;
+    spectrum_trend(trend);
+
+    DynamicJsonDocument doc(JSON_ARRAY_SIZE(trend.size()) + trend.size() * (JSON_OBJECT_SIZE(9) + JSON_ARRAY_SIZE(3)));
+    JsonArray runs = doc.to<JsonArray>();
+    for (const SpectrumRun& run : trend) {
+        JsonObject obj = runs.createNestedObject();
+        obj["timestamp"] = get_unix_time_ms_from_millis(run.timestamp);
+        obj["zone"] = run.zone;
+        obj["windows"] = run.windows;
+        obj["f0"] = run.metrics.f0_dhz / 10.0f;
+        obj["thd"] = run.metrics.thd;
+        obj["h3"] = run.metrics.h3;
+        obj["sideband"] = run.metrics.sideband;
+        obj["noise"] = run.metrics.noise;
+        JsonArray flags = obj.createNestedArray("flags");
+        for (uint8_t flag = SPECTRUM_FLAG_HARMONICS; flag <= SPECTRUM_FLAG_NOISE; flag <<= 1) {
+            if (run.flags & flag) flags.add(spectrum_flag_name(flag));
+        }
+    }
+
+    sendJson(request, doc);
+}
+
+// GET /api/current_history[?since=<unix ms>][&span=<seconds>][&format=series|bin]
+// Without `span` this streams the raw change-of-value points as a JSON
+// array, with format=bin (or Accept: application/octet-stream) as packed
+// CurrentHistoryRecords, or with format=series as compressed blocks. With
+// `span`, the tier fine enough to still cover the span is picked; rolled
+// up tiers come back as {"period_s": n, "points": [...]}.
 void handleGetCurrentHistory(AsyncWebServerRequest *request) {
     uint64_t since = 0;
     if (request->hasParam("since")) {
         since = strtoull(request->getParam("since")->value().c_str(), NULL, 10);
     }
 
-    const std::vector<CurrentHistoryEntry>& history = get_current_history();
-    
-    const size_t capacity = JSON_ARRAY_SIZE(history.size()) + history.size() * JSON_OBJECT_SIZE(2);
-    DynamicJsonDocument doc(capacity);
-
-    JsonArray historyArray = doc.to<JsonArray>();
-    for (const auto& entry : history) {
-        uint64_t unix_time_ms = get_unix_time_ms_from_millis(entry.timestamp);
-        if (unix_time_ms > since) {
-            JsonObject obj = historyArray.createNestedObject();
-            obj["timestamp"] = unix_time_ms;
-            obj["current"] = entry.current;
+    if (request->hasParam("span")) {
+        uint32_t span_s = strtoul(request->getParam("span")->value().c_str(), NULL, 10);
+        CurrentHistoryTier tier = current_history_tier_for_span(span_s);
+        if (tier != CURRENT_TIER_RAW) {
+            sendCurrentRollup(request, tier, since);
+            return;
         }
     }
 
-    String output;
-    serializeJson(doc, output);
-    request->send(200, "application/json", output);
+    // `since` on the history's own time base. Before the clock is synced
+    // every point reports time 0, so none is newer than a nonzero `since`.
+    int64_t since_ms = INT64_MIN;
+    if (since > 0) {
+        uint64_t boot_ms = get_unix_time_ms_from_millis(0);
+        since_ms = boot_ms == 0 ? INT64_MAX : (int64_t)since - (int64_t)boot_ms;
+    }
+
+    CurrentHistoryFormat format = HISTORY_FORMAT_JSON;
+    if (request->hasParam("format")) {
+        const String& name = request->getParam("format")->value();
+        if (name == "series") format = HISTORY_FORMAT_SERIES;
+        else if (name == "bin") format = HISTORY_FORMAT_BIN;
+    } else if (request->hasHeader("Accept") &&
+               request->getHeader("Accept")->value().indexOf("application/octet-stream") >= 0) {
+        format = HISTORY_FORMAT_BIN;
+    }
+    streamCurrentHistory(request, format, since_ms);
 }
 
-void handleGetCycles(AsyncWebServerRequest *request) {
-    Serial.println("Handling get cycles request.");
-    StaticJsonDocument<1024> doc;
+static void buildCycles(JsonDocument& doc) {
+    char days[DAYS_STRING_SIZE];
     JsonArray cyclesArray = doc.createNestedArray("cycles");
 
     for (int i = 0; i < NUM_CYCLES; i++) {
@@ -196,7 +549,8 @@ void handleGetCycles(AsyncWebServerRequest *request) {
         startTimeObj["minute"] = cycles[i]->startTime.minute;
         
         cycleObj["daysActive"] = cycles[i]->daysActive;
-        cycleObj["daysActiveString"] = dayOfWeekToString(cycles[i]->daysActive);
+        dayOfWeekToString(cycles[i]->daysActive, days);
+        cycleObj["daysActiveString"] = days; // Copied, so the buffer can be reused
         cycleObj["interZoneDelay"] = cycles[i]->interZoneDelay;
         
         JsonArray durations = cycleObj.createNestedArray("zoneDurations");
@@ -204,9 +558,55 @@ void handleGetCycles(AsyncWebServerRequest *request) {
             durations.add(cycles[i]->zoneDurations[j]);
         }
     }
-    String output;
-    serializeJson(doc, output);
-    request->send(200, "application/json", output);
+}
+
+void handleGetCycles(AsyncWebServerRequest *request) {
+    Serial.println("Handling get cycles request.");
+    char etag[24];
+    if (configNotModified(request, etag, sizeof(etag))) return;
+
+    static StaticJsonDocument<CYCLES_JSON_SIZE> doc;
+    doc.clear();
+    buildCycles(doc);
+    sendJson(request, doc, etag);
+}
+
+void web_server_benchmark(uint32_t iterations, uint32_t& string_us, uint32_t& stream_us, size_t& bytes) {
+    static StaticJsonDocument<STATUS_JSON_SIZE> status;
+    static StaticJsonDocument<CYCLES_JSON_SIZE> cyclesDoc;
+    JsonDocument* docs[] = { &status, &cyclesDoc };
+
+    // As the handlers used to: into a String, then copied by send()
+    uint32_t start = micros();
+    for (uint32_t i = 0; i < iterations; i++) {
+        status.clear();
+        buildStatus(status);
+        cyclesDoc.clear();
+        buildCycles(cyclesDoc);
+        for (JsonDocument* doc : docs) {
+            String output;
+            serializeJson(*doc, output);
+            String sent = output;
+        }
+    }
+    string_us = micros() - start;
+
+    // As they do now
+    start = micros();
+    for (uint32_t i = 0; i < iterations; i++) {
+        status.clear();
+        buildStatus(status);
+        cyclesDoc.clear();
+        buildCycles(cyclesDoc);
+        for (JsonDocument* doc : docs) {
+            AsyncResponseStream *response = new AsyncResponseStream("application/json", measureJson(*doc));
+            serializeJson(*doc, *response);
+            delete response;
+        }
+    }
+    stream_us = micros() - start;
+
+    bytes = measureJson(status) + measureJson(cyclesDoc);
 }
 
 void handleSetCycle(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
@@ -253,6 +653,70 @@ void handleSetCycle(AsyncWebServerRequest *request, uint8_t *data, size_t len, s
     }
 }
 
+// Relay actions from /api/manual. Handlers run on the async TCP task, but
+// relays, the pump protection and the burst capture triggers are only
+// driven from the loop, so the handler queues the action here and
+// web_server_handle() carries it out. One writer (the async TCP task,
+// which runs handlers one at a time), one reader (the loop).
+#define WEB_ACTION_QUEUE 4 // Must stay a power of two
+
+enum WebActionType {
+    WEB_ACTION_START_ZONE,
+    WEB_ACTION_START_CYCLE,
+    WEB_ACTION_STOP_ALL
+};
+
+struct WebAction {
+    uint8_t type;     // WebActionType
+    uint8_t index;    // Zone (1-based) or cycle
+    uint8_t duration; // Minutes, for a zone
+};
+
+static WebAction web_actions[WEB_ACTION_QUEUE];
+static volatile uint32_t web_action_head = 0; // Written by the async TCP task
+static volatile uint32_t web_action_tail = 0; // Written by the loop
+
+// Returns false if the loop has not caught up with the queue
+static bool queueWebAction(uint8_t type, uint8_t index, uint8_t duration) {
+    uint32_t head = web_action_head;
+    if (head - __atomic_load_n(&web_action_tail, __ATOMIC_ACQUIRE) == WEB_ACTION_QUEUE) {
+        return false;
+    }
+    web_actions[head % WEB_ACTION_QUEUE] = {type, index, duration};
+    __atomic_store_n(&web_action_head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+void web_server_handle() {
+    uint32_t head = __atomic_load_n(&web_action_head, __ATOMIC_ACQUIRE);
+    uint32_t tail = web_action_tail;
+    for (; tail != head; tail++) {
+        const WebAction& action = web_actions[tail % WEB_ACTION_QUEUE];
+        switch (action.type) {
+            case WEB_ACTION_START_ZONE:
+                selectedManualDuration = action.duration;
+                startManualZone(action.index);
+                break;
+            case WEB_ACTION_START_CYCLE:
+                startCycleRun(action.index, OP_MANUAL_CYCLE);
+                break;
+            case WEB_ACTION_STOP_ALL:
+                stopAllActivity();
+                break;
+        }
+    }
+    __atomic_store_n(&web_action_tail, tail, __ATOMIC_RELEASE);
+}
+
+// Answers a queued /api/manual action
+static void sendQueued(AsyncWebServerRequest *request, bool queued, const char* accepted) {
+    if (queued) {
+        request->send(200, "application/json", accepted);
+    } else {
+        request->send(503, "application/json", "{\"success\":false, \"message\":\"Busy, try again\"}");
+    }
+}
+
 void handleManualControl(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
     Serial.println("Handling manual control request.");
     if (index == 0) {
@@ -268,23 +732,22 @@ void handleManualControl(AsyncWebServerRequest *request, uint8_t *data, size_t l
             int zone = doc["zone"];
             int duration = doc["duration"];
             if (zone >= 1 && zone <= ZONE_COUNT && duration > 0 && duration <= 120) {
-                selectedManualDuration = duration;
-                startManualZone(zone);
-                request->send(200, "application/json", "{\"success\":true, \"message\":\"Manual zone start requested\"}");
+                sendQueued(request, queueWebAction(WEB_ACTION_START_ZONE, zone, duration),
+                           "{\"success\":true, \"message\":\"Manual zone start requested\"}");
             } else {
                 request->send(400, "application/json", "{\"success\":false, \"message\":\"Invalid zone or duration\"}");
             }
         } else if (strcmp(action, "start_cycle") == 0) {
             int cycleIdx = doc["cycle"];
             if (cycleIdx >= 0 && cycleIdx < NUM_CYCLES) {
-                startCycleRun(cycleIdx, OP_MANUAL_CYCLE);
-                request->send(200, "application/json", "{\"success\":true, \"message\":\"Cycle start requested\"}");
+                sendQueued(request, queueWebAction(WEB_ACTION_START_CYCLE, cycleIdx, 0),
+                           "{\"success\":true, \"message\":\"Cycle start requested\"}");
             } else {
                 request->send(400, "application/json", "{\"success\":false, \"message\":\"Invalid cycle index\"}");
             }
         } else if (strcmp(action, "stop_all") == 0) {
-            stopAllActivity();
-            request->send(200, "application/json", "{\"success\":true, \"message\":\"Stop all requested\"}");
+            sendQueued(request, queueWebAction(WEB_ACTION_STOP_ALL, 0, 0),
+                       "{\"success\":true, \"message\":\"Stop all requested\"}");
         } else {
             request->send(400, "application/json", "{\"success\":false, \"message\":\"Unknown action\"}");
         }
@@ -294,14 +757,15 @@ void handleManualControl(AsyncWebServerRequest *request, uint8_t *data, size_t l
 
 void handleGetZoneNames(AsyncWebServerRequest *request) {
     Serial.println("Handling get zone names request.");
+    char etag[24];
+    if (configNotModified(request, etag, sizeof(etag))) return;
+
     StaticJsonDocument<512> doc;
     JsonArray zoneNamesArray = doc.createNestedArray("zoneNames");
     for (int i = 0; i < ZONE_COUNT; i++) {
         zoneNamesArray.add(systemConfig.zoneNames[i]);
     }
-    String output;
-    serializeJson(doc, output);
-    request->send(200, "application/json", output);
+    sendJson(request, doc, etag);
 }
 
 
@@ -334,11 +798,19 @@ void handleSetZoneNames(AsyncWebServerRequest *request, uint8_t *data, size_t le
 void handleReset(AsyncWebServerRequest *request) {
     request->send(200, "application/json", "{\"success\":true, \"message\":\"Restarting...\"}");
     delay(100); // Give the response time to send
+    current_log_flush();
     ESP.restart();
 }
 
+// Clears a pump protection trip. The pump stays off until a zone is started.
+void handleProtectionReset(AsyncWebServerRequest *request) {
+    pump_protection_reset();
+    request->send(200, "application/json", "{\"success\":true, \"message\":\"Protection trip cleared\"}");
+}
+
 void initWebServer() {
     Serial.println("Initializing web server...");
+    configEpoch = esp_random();
 
     // Initialize LittleFS
     if(!LittleFS.begin(true)){
@@ -361,13 +833,18 @@ void initWebServer() {
     // API Handlers
     server.on("/api/status", HTTP_GET, handleGetStatus);
     server.on("/api/reset", HTTP_POST, handleReset);
+    server.on("/api/protection/reset", HTTP_POST, handleProtectionReset);
     server.on("/api/cycles", HTTP_GET, handleGetCycles);
     server.on("/api/current", HTTP_GET, handleGetCurrent);
     server.on("/api/current_history", HTTP_GET, handleGetCurrentHistory);
+    server.on("/api/capture", HTTP_GET, handleGetCapture);
+    server.on("/api/spectrum/trend", HTTP_GET, handleGetSpectrumTrend);
+    server.on("/api/spectrum", HTTP_GET, handleGetSpectrum);
     server.on("/api/zonenames", HTTP_GET, handleGetZoneNames);
     server.on("/api/manual", HTTP_POST, [](AsyncWebServerRequest * request){}, NULL, handleManualControl);
     server.on("/api/cycles", HTTP_POST, [](AsyncWebServerRequest * request){}, NULL, handleSetCycle);
     server.on("/api/zonenames", HTTP_POST, [](AsyncWebServerRequest * request){}, NULL, handleSetZoneNames);
+    web_events_init(server);
 
     // Serve static files from LittleFS.
     // This handler will serve 'index.html' for requests to the root ('/'),
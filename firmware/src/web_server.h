@@ -38,6 +38,9 @@ extern int batteryLevel;
 
 // Web server functions
 void initWebServer();
+// Carries out the relay actions the web handlers queued. Relays are only
+// switched from the loop; call it from there.
+void web_server_handle();
 void handleRoot(AsyncWebServerRequest *request);
 void handlePlot(AsyncWebServerRequest *request);
 void handleNotFound(AsyncWebServerRequest *request);
@@ -46,6 +49,9 @@ void handleNotFound(AsyncWebServerRequest *request);
 void handleGetStatus(AsyncWebServerRequest *request);
 void handleGetCurrent(AsyncWebServerRequest *request);
 void handleGetCurrentHistory(AsyncWebServerRequest *request);
+void handleGetCapture(AsyncWebServerRequest *request);
+void handleGetSpectrum(AsyncWebServerRequest *request);
+void handleGetSpectrumTrend(AsyncWebServerRequest *request);
 void handleGetTime(AsyncWebServerRequest *request);
 void handleSetTime(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total);
 void handleGetCycles(AsyncWebServerRequest *request);
@@ -54,8 +60,23 @@ void handleManualControl(AsyncWebServerRequest *request, uint8_t *data, size_t l
 void handleGetZoneNames(AsyncWebServerRequest *request);
 void handleSetZoneNames(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total);
 
+// /api/status, as built into each snapshot by status_snapshot.cpp
+#define STATUS_JSON_SIZE 3072
+void buildStatus(JsonDocument& doc);
+
+// Builds and serialises the /api/status and /api/cycles responses
+// `iterations` times, through a String as the handlers used to and into a
+// response stream as they do now. Reports the total microseconds of each
+// and the bytes of one status plus cycles response.
+void web_server_benchmark(uint32_t iterations, uint32_t& string_us, uint32_t& stream_us, size_t& bytes);
+
+// Fills in what is running, how far along and what is left, as in
+// /api/status's runningInfo
+void addRunningInfo(JsonObject runningInfo);
+
 // Helper to convert DayOfWeek bitmask to string
-String dayOfWeekToString(uint8_t daysActive);
+#define DAYS_STRING_SIZE 21 // "Su,Mo,Tu,We,Th,Fr,Sa"
+void dayOfWeekToString(uint8_t daysActive, char* buffer);
 // Helper to parse DayOfWeek string to bitmask
 uint8_t stringToDayOfWeek(String daysString);
 
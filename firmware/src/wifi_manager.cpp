@@ -8,6 +8,7 @@
 #include "styling.h"
 #include "st7789_dma_driver.h"
 #include "CustomCanvas.h"
+#include "display_renderer.h"
 
 #define DEBUG_ENABLED true
 
@@ -159,6 +160,10 @@ String wifi_manager_get_ip() {
     return wifiConnected ? WiFi.localIP().toString() : "---.---.---.---";
 }
 
+uint32_t wifi_manager_get_ip_raw() {
+    return wifiConnected ? (uint32_t)WiFi.localIP() : 0;
+}
+
 String wifi_manager_get_mac_address() {
     return WiFi.macAddress();
 }
@@ -236,7 +241,7 @@ void wifi_manager_update_system_time(SystemDateTime& dateTime) {
     dateTime.second = timeinfo.tm_sec;
 }
 
-uint64_t get_unix_time_ms_from_millis(uint32_t millis_val) {
+uint64_t get_unix_time_ms_from_millis(int64_t millis_val) {
     if (time_offset_ms == 0) {
         return 0; // Return 0 if time has not been synced yet
     }
@@ -266,7 +271,7 @@ static void sync_time_with_ntp() {
     }
 }
 
-static void display_wifi_info() {
+static void draw_wifi_info() {
     canvas.fillScreen(COLOR_BACKGROUND);
     canvas.setTextSize(2);
     canvas.setTextColor(COLOR_WARNING);
@@ -281,10 +286,9 @@ static void display_wifi_info() {
     canvas.setCursor(10, 100);
     canvas.setTextColor(COLOR_ACCENT_PRIMARY);
     canvas.println("Press encoder to cancel");
-    st7789_push_canvas(canvas.getBuffer(), 320, 240);
 }
 
-static void display_portal_info() {
+static void draw_portal_info() {
     canvas.fillScreen(COLOR_BACKGROUND);
     canvas.setTextSize(2);
     canvas.setTextColor(COLOR_WARNING);
@@ -303,10 +307,9 @@ static void display_portal_info() {
     canvas.setCursor(10, 140);
     canvas.setTextColor(COLOR_ACCENT_PRIMARY);
     canvas.println("Press encoder to cancel");
-    st7789_push_canvas(canvas.getBuffer(), 320, 240);
 }
 
-static void display_connection_success() {
+static void draw_connection_success() {
     canvas.fillScreen(COLOR_BACKGROUND);
     canvas.setTextSize(2);
     canvas.setTextColor(COLOR_SUCCESS);
@@ -318,11 +321,11 @@ static void display_connection_success() {
     canvas.printf("SSID: %s", WiFi.SSID().c_str());
     canvas.setCursor(10, 70);
     canvas.printf("IP: %s", WiFi.localIP().toString().c_str());
-    st7789_push_canvas(canvas.getBuffer(), 320, 240);
-    delay(2000);
 }
 
-static void display_connection_failure(const char* reason) {
+static const char* failure_reason = "";
+
+static void draw_connection_failure() {
     canvas.fillScreen(COLOR_BACKGROUND);
     canvas.setTextSize(2);
     canvas.setTextColor(COLOR_ERROR);
@@ -331,7 +334,24 @@ static void display_connection_failure(const char* reason) {
     canvas.setTextSize(1);
     canvas.setTextColor(COLOR_TEXT_PRIMARY);
     canvas.setCursor(10, 50);
-    canvas.printf("Reason: %s", reason);
-    st7789_push_canvas(canvas.getBuffer(), 320, 240);
+    canvas.printf("Reason: %s", failure_reason);
+}
+
+static void display_wifi_info() {
+    display_render(draw_wifi_info);
+}
+
+static void display_portal_info() {
+    display_render(draw_portal_info);
+}
+
+static void display_connection_success() {
+    display_render(draw_connection_success);
+    delay(2000);
+}
+
+static void display_connection_failure(const char* reason) {
+    failure_reason = reason;
+    display_render(draw_connection_failure);
     delay(2000);
 }
@@ -15,6 +15,7 @@ bool wifi_manager_is_connected();
 bool wifi_manager_is_connecting();
 String wifi_manager_get_ssid();
 String wifi_manager_get_ip();
+uint32_t wifi_manager_get_ip_raw(); // IPv4 address as stored by IPAddress, 0 if not connected
 String wifi_manager_get_mac_address();
 int8_t wifi_manager_get_rssi();
 String wifi_manager_get_portal_ssid();
@@ -29,6 +30,8 @@ void wifi_manager_cancel_connection();
 
 // Time synchronization
 void wifi_manager_update_system_time(SystemDateTime& dateTime);
-uint64_t get_unix_time_ms_from_millis(uint32_t millis_val);
+// Converts milliseconds since boot (negative for times before this boot) to
+// Unix time in milliseconds; 0 until the clock has been synced
+uint64_t get_unix_time_ms_from_millis(int64_t millis_val);
 
 #endif // WIFI_MANAGER_H
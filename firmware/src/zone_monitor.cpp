@@ -0,0 +1,184 @@
+#include "zone_monitor.h"
+#include <LittleFS.h>
+#include <ArduinoJson.h>
+
+// Learned baselines, rewritten when a run that changed them ends
+static const char* baselineFile = "/zones.json";
+
+static ZoneBaseline baselines[ZONE_COUNT];
+static ZoneEventLog events;
+
+// The run being watched
+static int active_zone = 0;
+static bool active_commissioning = false;
+static unsigned long run_start_ms = 0;
+static bool run_flagged = false;
+static bool run_learned = false;
+
+// Consecutive windows deviating the same way
+static uint8_t deviation_count = 0;
+static ZoneAnomalyType deviation_type = ZONE_ANOMALY_NONE;
+static float deviation_sum = 0.0f;
+
+static void save_baselines() {
+    File file = LittleFS.open(baselineFile, "w");
+    if (!file) {
+        Serial.println("Failed to open zone baseline file for writing");
+        return;
+    }
+
+    StaticJsonDocument<1024> doc;
+    JsonArray zonesArray = doc.createNestedArray("zones");
+    for (int i = 0; i < ZONE_COUNT; i++) {
+        JsonObject zoneObj = zonesArray.createNestedObject();
+        zoneObj["count"] = baselines[i].count;
+        zoneObj["mean"] = baselines[i].mean;
+        zoneObj["variance"] = baselines[i].variance;
+    }
+
+    if (serializeJson(doc, file) == 0) {
+        Serial.println("Failed to write zone baseline file");
+    }
+    file.close();
+}
+
+void zone_monitor_init() {
+    memset(baselines, 0, sizeof(baselines));
+
+    File file = LittleFS.open(baselineFile, "r");
+    if (!file) {
+        return; // Nothing learned yet
+    }
+
+    StaticJsonDocument<1024> doc;
+    DeserializationError error = deserializeJson(doc, file);
+    file.close();
+    if (error) {
+        Serial.println("Failed to parse zone baseline file, relearning.");
+        return;
+    }
+
+    JsonArrayConst zonesArray = doc["zones"];
+    for (int i = 0; i < ZONE_COUNT && i < (int)zonesArray.size(); i++) {
+        JsonObjectConst zoneObj = zonesArray[i];
+        baselines[i].count = zoneObj["count"];
+        baselines[i].mean = zoneObj["mean"];
+        baselines[i].variance = zoneObj["variance"];
+    }
+}
+
+// Running mean and variance. Until the cap this is exactly Welford's
+// update; past it each window keeps a fixed weight, so the baseline follows
+// slow changes such as pump wear.
+static void learn(ZoneBaseline& baseline, float current) {
+    if (baseline.count < ZONE_MONITOR_MAX_SAMPLES) {
+        baseline.count++;
+    }
+    float weight = 1.0f / baseline.count;
+    float delta = current - baseline.mean;
+    baseline.mean += weight * delta;
+    baseline.variance = (1.0f - weight) * (baseline.variance + weight * delta * delta);
+}
+
+static ZoneAnomalyType classify(const ZoneBaseline& baseline, float current, unsigned long elapsed) {
+    float limit = max(ZONE_MONITOR_SIGMA * sqrtf(baseline.variance), ZONE_MONITOR_MIN_DEVIATION_A);
+    float delta = current - baseline.mean;
+
+    if (delta > limit) {
+        return ZONE_ANOMALY_BURST;
+    }
+    if (delta < -limit) {
+        if (elapsed < ZONE_MONITOR_VALVE_CHECK_MS) {
+            return ZONE_ANOMALY_VALVE_CLOSED;
+        }
+        if (current < baseline.mean * ZONE_MONITOR_DRY_FRACTION) {
+            return ZONE_ANOMALY_DRY_RUN;
+        }
+        return ZONE_ANOMALY_BLOCKED;
+    }
+    return ZONE_ANOMALY_NONE;
+}
+
+ZoneAnomalyType zone_monitor_update(int zone, bool commissioning, float current_rms) {
+    if (zone != active_zone || commissioning != active_commissioning) {
+        if (run_learned) {
+            save_baselines();
+        }
+        active_zone = zone;
+        active_commissioning = commissioning;
+        run_start_ms = millis();
+        run_flagged = false;
+        run_learned = false;
+        deviation_count = 0;
+
+        if (commissioning && zone >= 1 && zone <= ZONE_COUNT) {
+            baselines[zone - 1] = {0, 0.0f, 0.0f};
+            run_learned = true;
+        }
+    }
+
+    if (zone < 1 || zone > ZONE_COUNT) return ZONE_ANOMALY_NONE;
+
+    unsigned long elapsed = millis() - run_start_ms;
+    if (elapsed < ZONE_MONITOR_SETTLE_MS) return ZONE_ANOMALY_NONE;
+
+    ZoneBaseline& baseline = baselines[zone - 1];
+    if (commissioning || baseline.count < ZONE_MONITOR_MIN_SAMPLES) {
+        learn(baseline, current_rms);
+        run_learned = true;
+        return ZONE_ANOMALY_NONE;
+    }
+
+    ZoneAnomalyType type = classify(baseline, current_rms, elapsed);
+    if (type == ZONE_ANOMALY_NONE) {
+        deviation_count = 0;
+        // A run that has gone wrong once teaches nothing
+        if (!run_flagged) {
+            learn(baseline, current_rms);
+            run_learned = true;
+        }
+        return ZONE_ANOMALY_NONE;
+    }
+
+    if (deviation_count == 0 || type != deviation_type) {
+        deviation_type = type;
+        deviation_count = 0;
+        deviation_sum = 0.0f;
+    }
+    if (deviation_count < ZONE_MONITOR_PERSIST) {
+        deviation_count++;
+        deviation_sum += current_rms;
+    }
+    if (deviation_count < ZONE_MONITOR_PERSIST || run_flagged) return ZONE_ANOMALY_NONE;
+
+    run_flagged = true;
+    ZoneEvent event;
+    event.timestamp = millis();
+    event.zone = zone;
+    event.type = type;
+    event.current = deviation_sum / deviation_count;
+    event.expected = baseline.mean;
+    events.push(event);
+
+    Serial.printf("Zone %d anomaly: %s (%.2f A, expected %.2f A)\n",
+                  zone, zone_anomaly_name(type), event.current, event.expected);
+    return type;
+}
+
+const ZoneBaseline& zone_monitor_baseline(int zone) {
+    return baselines[zone - 1];
+}
+
+const ZoneEventLog& zone_monitor_events() {
+    return events;
+}
+
+const char* zone_anomaly_name(uint8_t type) {
+    switch (type) {
+        case ZONE_ANOMALY_VALVE_CLOSED: return "valve_closed";
+        case ZONE_ANOMALY_BLOCKED:      return "blocked";
+        case ZONE_ANOMALY_DRY_RUN:      return "dry_run";
+        case ZONE_ANOMALY_BURST:        return "burst";
+        default:                        return "none";
+    }
+}
@@ -0,0 +1,60 @@
+#ifndef ZONE_MONITOR_H
+#define ZONE_MONITOR_H
+
+#include <Arduino.h>
+#include "ui_components.h" // For ZONE_COUNT
+#include "ring_buffer.h"
+
+// Learns each zone's steady pump current and flags runs that stray from it.
+// The baseline is a running mean and variance per zone, updated in O(1) for
+// every statistics window once the zone has settled after starting. Zones
+// are numbered like the relays (1..ZONE_COUNT).
+#define ZONE_MONITOR_SETTLE_MS       3000  // Ignore inrush and valve travel after a zone starts
+#define ZONE_MONITOR_VALVE_CHECK_MS  10000 // Low current before this means the valve did not open
+#define ZONE_MONITOR_MIN_SAMPLES     25    // Windows learned before a baseline is trusted (5 s)
+#define ZONE_MONITOR_MAX_SAMPLES     3000  // Older runs fade out beyond this many windows
+#define ZONE_MONITOR_SIGMA           4.0f  // Deviation, in standard deviations, that counts
+#define ZONE_MONITOR_MIN_DEVIATION_A 0.2f  // ...but never less than this
+#define ZONE_MONITOR_DRY_FRACTION    0.6f  // Below this share of the baseline the pump runs dry
+#define ZONE_MONITOR_PERSIST         10    // Consecutive deviating windows before flagging (2 s)
+#define ZONE_MONITOR_EVENT_CAPACITY  16    // Must stay a power of two
+
+enum ZoneAnomalyType {
+  ZONE_ANOMALY_NONE,
+  ZONE_ANOMALY_VALVE_CLOSED, // Low current right after start
+  ZONE_ANOMALY_BLOCKED,      // Low current later in the run
+  ZONE_ANOMALY_DRY_RUN,      // Far below the baseline
+  ZONE_ANOMALY_BURST         // Above the baseline
+};
+
+struct ZoneBaseline {
+  uint32_t count; // Windows learned, capped at ZONE_MONITOR_MAX_SAMPLES
+  float mean;     // A
+  float variance; // A^2
+};
+
+struct ZoneEvent {
+  uint32_t timestamp; // millis()
+  uint8_t zone;
+  uint8_t type;       // ZoneAnomalyType
+  float current;      // Mean of the deviating windows, A
+  float expected;     // Baseline mean, A
+};
+
+typedef RingBuffer<ZoneEvent, ZONE_MONITOR_EVENT_CAPACITY> ZoneEventLog;
+
+// Loads the learned baselines. Call after LittleFS is mounted.
+void zone_monitor_init();
+
+// Feeds one statistics window. `zone` is the single zone running with the
+// pump on, or 0 for none. While `commissioning` (the test mode sweep) each
+// zone's baseline is relearned from scratch and nothing is flagged.
+// Returns the anomaly raised by this window, if any; a run is flagged at
+// most once.
+ZoneAnomalyType zone_monitor_update(int zone, bool commissioning, float current_rms);
+
+const ZoneBaseline& zone_monitor_baseline(int zone);
+const ZoneEventLog& zone_monitor_events();
+const char* zone_anomaly_name(uint8_t type);
+
+#endif // ZONE_MONITOR_H
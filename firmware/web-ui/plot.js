@@ -2,6 +2,136 @@ import { Chart, registerables } from 'chart.js';
 import 'chartjs-adapter-date-fns';
 Chart.register(...registerables);
 
+// Decodes the compressed history blocks served with format=series (see
+// series_codec.h). Blocks are 256 bytes: a 24-byte little-endian header
+// (magic, count, first value, reserved, first and last timestamp) and an
+// MSB-first bitstream of timestamp delta-of-deltas and value deltas.
+const SERIES_BLOCK_BYTES = 256;
+const SERIES_HEADER_BYTES = 24;
+const SERIES_BLOCK_MAGIC = 0x5342;
+const SERIES_VALUE_SCALE = 100;
+const SERIES_TS_BITS = [0, 7, 9, 12, 32];
+const SERIES_VALUE_BITS = [0, 7, 10, 17];
+
+function decodeSeriesBlocks(buffer, timeOffsetMs) {
+  const view = new DataView(buffer);
+  const bytes = new Uint8Array(buffer);
+  const points = [];
+
+  for (let base = 0; base + SERIES_BLOCK_BYTES <= buffer.byteLength; base += SERIES_BLOCK_BYTES) {
+    if (view.getUint16(base, true) !== SERIES_BLOCK_MAGIC) continue;
+    const count = view.getUint16(base + 2, true);
+    let value = view.getInt16(base + 4, true);
+    let ts = Number(view.getBigInt64(base + 8, true));
+    let delta = 0;
+    let bitPos = (base + SERIES_HEADER_BYTES) * 8;
+    const endBit = (base + SERIES_BLOCK_BYTES) * 8;
+    let overrun = false;
+
+    // A count larger than the bits can hold must not read into the next block
+    const readBits = (n) => {
+      if (bitPos + n > endBit) {
+        overrun = true;
+        return 0;
+      }
+      let v = 0;
+      for (let i = 0; i < n; i++, bitPos++) {
+        v = v * 2 + ((bytes[bitPos >> 3] >> (7 - (bitPos & 7))) & 1);
+      }
+      return v;
+    };
+    const readSigned = (n) => {
+      const v = readBits(n);
+      return v >= 2 ** (n - 1) ? v - 2 ** n : v;
+    };
+    const readClass = (max) => {
+      let ones = 0;
+      while (ones < max && readBits(1)) ones++;
+      return ones;
+    };
+
+    for (let i = 0; i < count; i++) {
+      if (i > 0) {
+        const tsClass = readClass(4);
+        if (tsClass > 0) delta += readSigned(SERIES_TS_BITS[tsClass]);
+        ts += delta;
+        const valueClass = readClass(3);
+        if (valueClass > 0) value += readSigned(SERIES_VALUE_BITS[valueClass]);
+        if (overrun) break;
+      }
+      points.push({ timestamp: ts + timeOffsetMs, current: value / SERIES_VALUE_SCALE });
+    }
+  }
+  return points;
+}
+
+// Decodes the packed records served with format=bin: a little-endian
+// uint64 Unix timestamp in milliseconds and an int16 current in
+// centiamps, 10 bytes each
+const HISTORY_RECORD_BYTES = 10;
+
+function decodeHistoryRecords(buffer) {
+  const count = Math.floor(buffer.byteLength / HISTORY_RECORD_BYTES);
+  // Copied into columns first; the records themselves are not aligned
+  const timestamps = new Float64Array(count);
+  const currents = new Int16Array(count);
+  const view = new DataView(buffer);
+  for (let i = 0; i < count; i++) {
+    const base = i * HISTORY_RECORD_BYTES;
+    timestamps[i] = view.getUint32(base, true) + view.getUint32(base + 4, true) * 2 ** 32;
+    currents[i] = view.getInt16(base + 8, true);
+  }
+  const points = new Array(count);
+  for (let i = 0; i < count; i++) {
+    points[i] = { timestamp: timestamps[i], current: currents[i] / SERIES_VALUE_SCALE };
+  }
+  return points;
+}
+
+// Decodes a burst capture from /api/capture (see burst_capture.h): a
+// 56-byte little-endian header (magic, rate, count, pre-trigger samples,
+// id, trigger millis, Amperes per unit, events) and int16 samples. Times
+// come back in milliseconds from the first relay switch.
+const CAPTURE_MAGIC = 0x4342;
+const CAPTURE_MAX_EVENTS = 8;
+const CAPTURE_HEADER_BYTES = 24 + 4 * CAPTURE_MAX_EVENTS;
+
+function decodeBurstCapture(buffer, timeOffsetMs) {
+  const view = new DataView(buffer);
+  if (buffer.byteLength < CAPTURE_HEADER_BYTES || view.getUint16(0, true) !== CAPTURE_MAGIC) {
+    return null;
+  }
+  const rate = view.getUint16(2, true);
+  const count = view.getUint16(4, true);
+  const pre = view.getUint16(6, true);
+  const ampsPerUnit = view.getFloat32(16, true);
+  const timeOf = (index) => (index - pre) * 1000 / rate;
+
+  const points = [];
+  for (let i = 0; i < count; i++) {
+    points.push({ x: timeOf(i), y: view.getInt16(CAPTURE_HEADER_BYTES + 2 * i, true) * ampsPerUnit });
+  }
+
+  const events = [];
+  const eventCount = Math.min(view.getUint8(20), CAPTURE_MAX_EVENTS);
+  for (let e = 0; e < eventCount; e++) {
+    const index = view.getUint16(24 + 4 * e, true);
+    events.push({
+      x: timeOf(index),
+      y: index < count ? points[index].y : 0,
+      relay: view.getUint8(26 + 4 * e),
+      on: view.getUint8(27 + 4 * e) !== 0
+    });
+  }
+
+  return {
+    id: view.getUint32(8, true),
+    triggerTime: view.getUint32(12, true) + timeOffsetMs,
+    points,
+    events
+  };
+}
+
 document.addEventListener('DOMContentLoaded', () => {
   const ctx = document.getElementById('currentChart').getContext('2d');
   const currentChart = new Chart(ctx, {
@@ -12,6 +142,18 @@ document.addEventListener('DOMContentLoaded', () => {
         data: [],
         borderColor: '#7eb659',
         tension: 0.1
+      }, {
+        label: 'Min [A]',
+        data: [],
+        borderColor: '#b8d9a3',
+        pointRadius: 0,
+        hidden: true
+      }, {
+        label: 'Max [A]',
+        data: [],
+        borderColor: '#e0a060',
+        pointRadius: 0,
+        hidden: true
       }]
     },
     options: {
@@ -31,24 +173,60 @@ document.addEventListener('DOMContentLoaded', () => {
   });
 
   let lastTimestamp = 0;
+  // Requested time span in seconds; 0 asks for the raw change-of-value points
+  let spanSeconds = 0;
+
+  // Raw points come as compressed blocks on the first load and as packed
+  // records when polling, which only carry the new points; rolled-up tiers
+  // as JSON {period_s, points}
+  function requestHistory(url, rolledUp, incremental) {
+    if (rolledUp) {
+      return fetch(url).then(response => response.json()).then(response => response.points);
+    }
+    if (incremental) {
+      return fetch(url).then(response => response.arrayBuffer()).then(decodeHistoryRecords);
+    }
+    return fetch(url).then(response => {
+      const offset = Number(response.headers.get('X-Time-Offset') || 0);
+      return response.arrayBuffer().then(buffer => decodeSeriesBlocks(buffer, offset));
+    });
+  }
 
   function fetchHistoryData(isInitialLoad = false) {
-    const url = isInitialLoad ? '/api/current_history' : `/api/current_history?since=${lastTimestamp}`;
-    
-    fetch(url)
-      .then(response => response.json())
-      .then(apiData => {
-        if (apiData.length === 0) return;
+    const rolledUp = spanSeconds > 0;
+    const params = new URLSearchParams();
+    if (!isInitialLoad) params.set('since', lastTimestamp);
+    if (rolledUp) {
+      params.set('span', spanSeconds);
+    } else {
+      params.set('format', isInitialLoad ? 'series' : 'bin');
+    }
+    const url = `/api/current_history?${params.toString()}`;
+
+    requestHistory(url, rolledUp, !isInitialLoad)
+      .then(points => {
+        // Whole blocks come back, and pushed points may have arrived
+        // meanwhile, so drop what the chart already has
+        const since = isInitialLoad ? -Infinity : lastTimestamp;
+        const apiData = points.filter(entry => entry.timestamp > since);
+        if (isInitialLoad) {
+          currentChart.data.datasets.forEach(dataset => { dataset.data = []; });
+          currentChart.data.datasets[1].hidden = !rolledUp;
+          currentChart.data.datasets[2].hidden = !rolledUp;
+        }
+        if (apiData.length === 0) {
+          currentChart.update();
+          return;
+        }
 
         const newData = apiData.map(entry => ({
           x: entry.timestamp,
           y: entry.current
         }));
-
-        if (isInitialLoad) {
-          currentChart.data.datasets[0].data = newData;
-        } else {
-          currentChart.data.datasets[0].data.push(...newData);
+        currentChart.data.datasets[0].data.push(...newData);
+        if (rolledUp) {
+          currentChart.data.datasets[1].data.push(...apiData.map(entry => ({ x: entry.timestamp, y: entry.min })));
+          currentChart.data.datasets[2].data.push(...apiData.map(entry => ({ x: entry.timestamp, y: entry.max })));
         }
         
         currentChart.update();
@@ -61,12 +239,7 @@ document.addEventListener('DOMContentLoaded', () => {
 
   const autoRefreshCheckbox = document.getElementById('autoRefreshCheckbox');
   let refreshInterval;
-
-  function startAutoRefresh() {
-    if (!refreshInterval) {
-      refreshInterval = setInterval(() => fetchHistoryData(false), 5000);
-    }
-  }
+  let eventsConnected = false;
 
   function stopAutoRefresh() {
     if (refreshInterval) {
@@ -75,15 +248,121 @@ document.addEventListener('DOMContentLoaded', () => {
     }
   }
 
+  // Raw points are pushed by /api/events while it is connected and polled
+  // otherwise. The rolled-up tiers gain at most a bucket a minute.
+  function updateAutoRefresh() {
+    stopAutoRefresh();
+    if (!autoRefreshCheckbox.checked) return;
+    if (spanSeconds > 0) {
+      refreshInterval = setInterval(() => fetchHistoryData(false), 60000);
+    } else if (!eventsConnected) {
+      refreshInterval = setInterval(() => fetchHistoryData(false), 5000);
+    }
+  }
+
+  function connectEvents() {
+    if (!window.EventSource) return;
+    const eventSource = new EventSource('/api/events');
+    eventSource.onopen = () => {
+      eventsConnected = true;
+      updateAutoRefresh();
+      // Points missed while the stream was down
+      if (spanSeconds === 0 && lastTimestamp > 0) fetchHistoryData(false);
+    };
+    eventSource.onerror = () => {
+      // The browser keeps reconnecting; poll until it gets through
+      eventsConnected = false;
+      updateAutoRefresh();
+    };
+    eventSource.addEventListener('current', event => {
+      if (spanSeconds > 0 || !autoRefreshCheckbox.checked) return;
+      const points = JSON.parse(event.data).filter(entry => entry.timestamp > lastTimestamp);
+      if (points.length === 0) return;
+      currentChart.data.datasets[0].data.push(...points.map(entry => ({ x: entry.timestamp, y: entry.current })));
+      currentChart.update();
+      lastTimestamp = points[points.length - 1].timestamp;
+    });
+  }
+
+  const rangeSelect = document.getElementById('rangeSelect');
+  rangeSelect.addEventListener('change', () => {
+    spanSeconds = parseInt(rangeSelect.value, 10);
+    currentChart.options.scales.x.time.unit = spanSeconds > 0 ? false : 'second';
+    lastTimestamp = 0;
+    fetchHistoryData(true);
+    updateAutoRefresh();
+  });
+
   autoRefreshCheckbox.addEventListener('change', () => {
-    if (autoRefreshCheckbox.checked) {
-      startAutoRefresh();
-    } else {
-      stopAutoRefresh();
+    // Catch up on what was skipped while paused
+    if (autoRefreshCheckbox.checked && lastTimestamp > 0) fetchHistoryData(false);
+    updateAutoRefresh();
+  });
+
+  const captureChart = new Chart(document.getElementById('captureChart').getContext('2d'), {
+    type: 'line',
+    data: {
+      datasets: [{
+        label: 'Current [A]',
+        data: [],
+        borderColor: '#4f8cb6',
+        borderWidth: 1,
+        pointRadius: 0
+      }, {
+        label: 'Relay switch',
+        data: [],
+        borderColor: '#e0a060',
+        backgroundColor: '#e0a060',
+        pointStyle: 'triangle',
+        pointRadius: 6,
+        showLine: false
+      }]
+    },
+    options: {
+      maintainAspectRatio: false,
+      animation: false,
+      parsing: false,
+      scales: {
+        x: { type: 'linear', title: { display: true, text: 'ms from switch' } },
+        y: { beginAtZero: false }
+      }
     }
   });
+  const captureInfo = document.getElementById('captureInfo');
+  // Shown capture; 0 follows the newest
+  let captureId = 0;
+
+  function fetchCapture(id) {
+    const url = id > 0 ? `/api/capture?id=${id}` : '/api/capture';
+    fetch(url)
+      .then(response => {
+        if (!response.ok) throw new Error(id > 0 ? `Capture ${id} is no longer kept` : 'No capture yet');
+        const offset = Number(response.headers.get('X-Time-Offset') || 0);
+        return response.arrayBuffer().then(buffer => decodeBurstCapture(buffer, offset));
+      })
+      .then(capture => {
+        if (!capture) throw new Error('Unreadable capture');
+        captureId = capture.id;
+        captureChart.data.datasets[0].data = capture.points;
+        captureChart.data.datasets[1].data = capture.events;
+        captureChart.update();
+
+        const switches = capture.events.map(event =>
+          `${event.x.toFixed(0)} ms: ${event.relay === 0 ? 'Pump' : `Zone ${event.relay}`} ${event.on ? 'on' : 'off'}`);
+        captureInfo.textContent = `#${capture.id} at ${new Date(capture.triggerTime).toLocaleString()} | ${switches.join(', ')}`;
+      })
+      .catch(err => { captureInfo.textContent = err.message; });
+  }
+
+  document.getElementById('captureOlder').addEventListener('click', () => {
+    if (captureId > 1) fetchCapture(captureId - 1);
+  });
+  document.getElementById('captureNewer').addEventListener('click', () => fetchCapture(captureId + 1));
+  document.getElementById('captureLatest').addEventListener('click', () => fetchCapture(0));
 
-  // Fetch full history initially and start polling
+  // Fetch full history initially, then follow it
   fetchHistoryData(true);
-  startAutoRefresh();
+  updateAutoRefresh();
+  connectEvents();
+  fetchCapture(0);
 });
@@ -3,15 +3,95 @@ let zoneNames = [];
 let autoRefreshInterval = null;
 let zoneCount = 0; // Will be updated from API
 
-function toggleAutoRefresh(is_enabled) {
-  if (is_enabled && !autoRefreshInterval) {
+// Live updates come pushed from /api/events; /api/status is polled only
+// while the stream is down. Events are applied to the last full status,
+// and the clock and progress are counted here in between.
+let eventSource = null;
+let clockInterval = null;
+let status = null;
+let statusReceivedAt = 0;  // Date.now() when status.dateTime was current
+let runningReceivedAt = 0; // ...and status.runningInfo
+// Revision of the zone names and cycles shown. Those responses are cached
+// by ETag and revalidated, so reloading an unchanged config is a 304.
+let configRevision = null;
+
+function checkConfigRevision(revision) {
+  if (revision === undefined || revision === configRevision) return;
+  const stale = configRevision !== null;
+  configRevision = revision;
+  if (stale) fetchZoneNames().then(() => fetchCycles());
+}
+
+function startPolling() {
+  if (!autoRefreshInterval) {
     autoRefreshInterval = setInterval(fetchStatus, 5000);
-  } else if (!is_enabled && autoRefreshInterval) {
+  }
+}
+
+function stopPolling() {
+  if (autoRefreshInterval) {
     clearInterval(autoRefreshInterval);
     autoRefreshInterval = null;
   }
 }
 
+function applyEvent(type, handler) {
+  eventSource.addEventListener(type, event => {
+    if (status) handler(JSON.parse(event.data));
+  });
+}
+
+function connectEvents() {
+  if (!window.EventSource) return;
+  eventSource = new EventSource('/api/events');
+  eventSource.onopen = () => {
+    // Anything missed while disconnected is in a fresh snapshot
+    stopPolling();
+    fetchStatus();
+    if (!clockInterval) clockInterval = setInterval(() => { if (status) renderStatus(); }, 1000);
+  };
+  eventSource.onerror = () => {
+    // The browser keeps reconnecting; poll until it gets through
+    startPolling();
+  };
+  applyEvent('relay', data => {
+    status.relays[data.index].state = data.state;
+    renderStatus();
+  });
+  applyEvent('operation', data => {
+    status.currentOperation = data.currentOperation;
+    status.runningInfo = data;
+    runningReceivedAt = Date.now();
+    renderStatus();
+  });
+  applyEvent('device', data => {
+    updateBatteryIcon(data.batteryLevel);
+    updateWifiIcon(data.wifiRSSI);
+  });
+  applyEvent('config', data => checkConfigRevision(data.revision));
+}
+
+function toggleAutoRefresh(is_enabled) {
+  if (is_enabled && !eventSource && !autoRefreshInterval) {
+    startPolling();
+    connectEvents();
+  } else if (!is_enabled) {
+    stopPolling();
+    if (eventSource) {
+      eventSource.close();
+      eventSource = null;
+    }
+    if (clockInterval) {
+      clearInterval(clockInterval);
+      clockInterval = null;
+    }
+  }
+}
+
+function formatMinutes(seconds) {
+  return `${Math.floor(seconds / 60)}m ${seconds % 60}s`;
+}
+
 function showMessage(text, type) {
   const msgDiv = document.getElementById('message');
   msgDiv.textContent = text;
@@ -35,73 +115,13 @@ function fetchStatus() {
   fetch('/api/status')
     .then(response => response.json())
     .then(data => {
+      status = data;
+      statusReceivedAt = runningReceivedAt = Date.now();
       zoneCount = data.relays.length - 1; // Update zone count, excluding pump
-      const dt = data.dateTime;
-      document.getElementById('time-display').textContent = 
-        `${dt.year}-${String(dt.month).padStart(2,'0')}-${String(dt.day).padStart(2,'0')} ${String(dt.hour).padStart(2,'0')}:${String(dt.minute).padStart(2,'0')}:${String(dt.second).padStart(2,'0')} (${data.dayOfWeek})`;
-      
+      checkConfigRevision(data.configRevision);
       updateBatteryIcon(data.batteryLevel);
       updateWifiIcon(data.wifiRSSI);
-
-      const runningStatusDiv = document.getElementById('runningStatus');
-      const runningDescription = document.getElementById('runningDescription');
-      const runningProgressBar = document.getElementById('runningProgressBar');
-      const runningTimeInfo = document.getElementById('runningTimeInfo');
-
-      if (data.runningInfo.operation !== "OP_NONE") {
-        runningDescription.textContent = data.runningInfo.description;
-        
-        if (data.runningInfo.total_duration_s > 0) {
-          const progress = (data.runningInfo.elapsed_s / data.runningInfo.total_duration_s) * 100;
-          runningProgressBar.style.width = `${progress}%`;
-          runningProgressBar.textContent = `${Math.round(progress)}%`;
-          runningProgressBar.parentElement.style.display = 'block'; // Show container
-          
-          if (data.runningInfo.is_delay) {
-            runningProgressBar.style.backgroundColor = '#ffc107'; // Yellow for delay
-          } else {
-            runningProgressBar.style.backgroundColor = '#4f8cb6'; // Blue for regular zone
-          }
-
-        } else {
-          runningProgressBar.style.width = '0%';
-          runningProgressBar.textContent = '';
-          runningProgressBar.parentElement.style.display = 'none'; // Hide container if no duration
-        }
-
-        let timeInfoText = '';
-        if (data.runningInfo.time_elapsed) {
-          timeInfoText += `Elapsed: ${data.runningInfo.time_elapsed}`;
-        }
-        if (data.runningInfo.time_remaining) {
-          if (timeInfoText) timeInfoText += ' | ';
-          timeInfoText += `Remaining: ${data.runningInfo.time_remaining}`;
-        }
-        runningTimeInfo.textContent = timeInfoText;
-        runningStatusDiv.style.display = 'block';
-      } else {
-        runningStatusDiv.style.display = 'none';
-      }
-
-      const relaysDiv = document.getElementById('statusRelays');
-      relaysDiv.innerHTML = '';
-      data.relays.forEach(relay => {
-        const d = document.createElement('div');
-        d.className = 'zone' + (relay.state ? ' active' : '');
-        d.textContent = `${relay.name}: ${relay.state ? 'ON' : 'OFF'}`;
-        relaysDiv.appendChild(d);
-      });
-      // Populate manual zone select
-      const manualZoneSelect = document.getElementById('manualZone');
-      if (manualZoneSelect.options.length <= 1) { // Populate only if not already done
-          manualZoneSelect.innerHTML = '<option value="-1">Select Zone</option>'; // Default option
-          data.relays.slice(1).forEach((relay, index) => { // Skip pump
-              const option = document.createElement('option');
-              option.value = index + 1; // Zone index 1-7
-              option.textContent = relay.name;
-              manualZoneSelect.appendChild(option);
-          });
-      }
+      renderStatus();
     })
     .catch(err => {
       console.error('Error fetching status:', err);
@@ -109,6 +129,78 @@ function fetchStatus() {
     });
 }
 
+// Renders `status`, advanced by the time since it arrived
+function renderStatus() {
+  const data = status;
+  const dt = data.dateTime;
+  const now = new Date(Date.UTC(dt.year, dt.month - 1, dt.day, dt.hour, dt.minute, dt.second) + Date.now() - statusReceivedAt);
+  const dayOfWeek = ["Su", "Mo", "Tu", "We", "Th", "Fr", "Sa"][now.getUTCDay()];
+  document.getElementById('time-display').textContent = 
+    `${now.getUTCFullYear()}-${String(now.getUTCMonth() + 1).padStart(2,'0')}-${String(now.getUTCDate()).padStart(2,'0')} ${String(now.getUTCHours()).padStart(2,'0')}:${String(now.getUTCMinutes()).padStart(2,'0')}:${String(now.getUTCSeconds()).padStart(2,'0')} (${dayOfWeek})`;
+
+  const runningStatusDiv = document.getElementById('runningStatus');
+  const runningDescription = document.getElementById('runningDescription');
+  const runningProgressBar = document.getElementById('runningProgressBar');
+  const runningTimeInfo = document.getElementById('runningTimeInfo');
+
+  if (data.runningInfo.operation !== "OP_NONE") {
+    runningDescription.textContent = data.runningInfo.description;
+
+    const total = data.runningInfo.total_duration_s;
+    const elapsed = Math.min(total, data.runningInfo.elapsed_s + Math.floor((Date.now() - runningReceivedAt) / 1000));
+    if (total > 0) {
+      const progress = (elapsed / total) * 100;
+      runningProgressBar.style.width = `${progress}%`;
+      runningProgressBar.textContent = `${Math.round(progress)}%`;
+      runningProgressBar.parentElement.style.display = 'block'; // Show container
+      
+      if (data.runningInfo.is_delay) {
+        runningProgressBar.style.backgroundColor = '#ffc107'; // Yellow for delay
+      } else {
+        runningProgressBar.style.backgroundColor = '#4f8cb6'; // Blue for regular zone
+      }
+
+    } else {
+      runningProgressBar.style.width = '0%';
+      runningProgressBar.textContent = '';
+      runningProgressBar.parentElement.style.display = 'none'; // Hide container if no duration
+    }
+
+    let timeInfoText = '';
+    if (data.runningInfo.time_elapsed) {
+      timeInfoText += `Elapsed: ${formatMinutes(elapsed)}`;
+    }
+    if (data.runningInfo.time_remaining) {
+      if (timeInfoText) timeInfoText += ' | ';
+      timeInfoText += `Remaining: ${formatMinutes(total - elapsed)}`;
+    }
+    runningTimeInfo.textContent = timeInfoText;
+    runningStatusDiv.style.display = 'block';
+  } else {
+    runningStatusDiv.style.display = 'none';
+  }
+
+  const relaysDiv = document.getElementById('statusRelays');
+  relaysDiv.innerHTML = '';
+  data.relays.forEach(relay => {
+    const d = document.createElement('div');
+    d.className = 'zone' + (relay.state ? ' active' : '');
+    d.textContent = `${relay.name}: ${relay.state ? 'ON' : 'OFF'}`;
+    relaysDiv.appendChild(d);
+  });
+  // Populate manual zone select
+  const manualZoneSelect = document.getElementById('manualZone');
+  if (manualZoneSelect.options.length <= 1) { // Populate only if not already done
+      manualZoneSelect.innerHTML = '<option value="-1">Select Zone</option>'; // Default option
+      data.relays.slice(1).forEach((relay, index) => { // Skip pump
+          const option = document.createElement('option');
+          option.value = index + 1; // Zone index 1-7
+          option.textContent = relay.name;
+          manualZoneSelect.appendChild(option);
+      });
+  }
+}
+
 function fetchCycles() {
   fetch('/api/cycles')
     .then(response => response.json())